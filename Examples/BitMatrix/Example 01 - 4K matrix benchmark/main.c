@@ -0,0 +1,182 @@
+//! Example 01 - 4K matrix benchmark
+/*!
+  This simply example uses a 4096x4096 bit matrix (an adjacency matrix, for
+  example) and compares bit-by-bit loops with the BitMatrix functions: row
+  OR, transpose, matrix-vector product over GF(2) and column counts.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define MATRIX_SIZE 4096
+
+/*!
+  Bit matrices and vectors.
+*/
+newStaticBitMatrix(bmAdjacency, MATRIX_SIZE, MATRIX_SIZE);
+newStaticBitMatrix(bmTransposed, MATRIX_SIZE, MATRIX_SIZE);
+newStaticBitMatrix(bmReachable, MATRIX_SIZE, MATRIX_SIZE);
+newStaticBitVector(bvVector, MATRIX_SIZE);
+newStaticBitVector(bvResult, MATRIX_SIZE);
+static uint32_t ui32Counts[MATRIX_SIZE];
+
+/*!
+  Pseudo-random number generator.
+*/
+static uint32_t ui32Seed = 12345;
+static uint32_t getRandom(){
+  ui32Seed = ui32Seed * 1103515245 + 12345;
+  return ui32Seed >> 16;
+}
+
+/*!
+  Elapsed time in milliseconds.
+*/
+static double getElapsedTime(clock_t ckStart){
+  return 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Row = 0;
+  uint32_t ui32Column = 0;
+  uint32_t ui32Errors = 0;
+  clock_t ckStart = 0;
+
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+    for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+      if ((getRandom() & 7) == 0){
+        BitMatrix_setBit(bmAdjacency, ui32Row, ui32Column);
+      }
+    }
+    if ((getRandom() & 1) == 0){
+      BitVector_setBit(bvVector, ui32Row);
+    }
+  }
+
+  /*!
+    Row OR: each row receives the neighbours of its next row...
+  */
+  ckStart = clock();
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+    for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+      if (BitMatrix_readBit(bmAdjacency, ui32Row, ui32Column) == 1 || BitMatrix_readBit(bmAdjacency, (ui32Row + 1) % MATRIX_SIZE, ui32Column) == 1){
+        BitMatrix_setBit(bmReachable, ui32Row, ui32Column);
+      }
+    }
+  }
+  printf("Row OR bit loop:          %8.2f ms\n", getElapsedTime(ckStart));
+  ckStart = clock();
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+    BitVector_or(BitMatrix_getRow(bmReachable, ui32Row), BitMatrix_getRow(bmAdjacency, ui32Row), BitMatrix_getRow(bmAdjacency, (ui32Row + 1) % MATRIX_SIZE), MATRIX_SIZE);
+  }
+  printf("Row OR BitVector_or:      %8.2f ms\n", getElapsedTime(ckStart));
+
+  /*!
+    Transpose...
+  */
+  ckStart = clock();
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+    for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+      if (BitMatrix_readBit(bmAdjacency, ui32Row, ui32Column) == 1){
+        BitMatrix_setBit(bmTransposed, ui32Column, ui32Row);
+      }
+    }
+  }
+  printf("Transpose bit loop:       %8.2f ms\n", getElapsedTime(ckStart));
+  BitMatrix_clear(bmTransposed);
+  ckStart = clock();
+  BitMatrix_transpose(bmTransposed, bmAdjacency);
+  printf("BitMatrix_transpose:      %8.2f ms\n", getElapsedTime(ckStart));
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row = ui32Row + 97){
+    for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+      ui32Errors = ui32Errors + (BitMatrix_readBit(bmTransposed, ui32Column, ui32Row) != BitMatrix_readBit(bmAdjacency, ui32Row, ui32Column));
+    }
+  }
+
+  /*!
+    Matrix-vector product over GF(2)...
+  */
+  ckStart = clock();
+  for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+    uint8_t ui8Parity = 0;
+    for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+      ui8Parity = ui8Parity ^ (BitMatrix_readBit(bmAdjacency, ui32Row, ui32Column) & BitVector_readBit(bvVector, ui32Column));
+    }
+    if (ui8Parity == 1){
+      BitVector_setBit(bvResult, ui32Row);
+    }
+    else{
+      BitVector_clearBit(bvResult, ui32Row);
+    }
+  }
+  printf("Product bit loop:         %8.2f ms\n", getElapsedTime(ckStart));
+  ui32Column = BitVector_countOnes(bvResult, MATRIX_SIZE);
+  ckStart = clock();
+  BitMatrix_multiplyVector(bmAdjacency, bvVector, bvResult);
+  printf("BitMatrix_multiplyVector: %8.2f ms\n", getElapsedTime(ckStart));
+  ui32Errors = ui32Errors + (ui32Column != BitVector_countOnes(bvResult, MATRIX_SIZE));
+
+  /*!
+    Column counts...
+  */
+  ckStart = clock();
+  for (ui32Column = 0 ; ui32Column < MATRIX_SIZE ; ui32Column++){
+    ui32Counts[ui32Column] = 0;
+    for (ui32Row = 0 ; ui32Row < MATRIX_SIZE ; ui32Row++){
+      ui32Counts[ui32Column] = ui32Counts[ui32Column] + BitMatrix_readBit(bmAdjacency, ui32Row, ui32Column);
+    }
+  }
+  printf("Column count bit loop:    %8.2f ms\n", getElapsedTime(ckStart));
+  ui32Row = ui32Counts[MATRIX_SIZE - 1];
+  ckStart = clock();
+  BitMatrix_countColumns(bmAdjacency, ui32Counts);
+  printf("BitMatrix_countColumns:   %8.2f ms\n", getElapsedTime(ckStart));
+  ui32Errors = ui32Errors + (ui32Row != ui32Counts[MATRIX_SIZE - 1]);
+
+  if (ui32Errors != 0){
+    printf("ERROR: The results are different!");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,113 @@
+//! Example 03 - Bit scan benchmark
+/*!
+  This simply example compares the word scan functions of a bit vector
+  (BitVector_findFirstClear, BitVector_findNextSet and BitVector_countOnes)
+  with the classic BitVector_readBit loops. Change __BIT_VECTOR_WORD_SIZE__
+  in Configs.h to compare the word sizes.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Benchmark parameters.
+*/
+#define AMOUNT_OF_BITS 65536
+#define AMOUNT_OF_ROUNDS 200
+
+/*!
+  Bit vector: every bit is set except the last one.
+*/
+newStaticBitVector(bvBenchmark, AMOUNT_OF_BITS);
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Round = 0;
+  volatile uint32_t ui32Result = 0;
+  clock_t ckStart = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS - 1 ; ui32Counter++){
+    BitVector_setBit(bvBenchmark, ui32Counter);
+  }
+
+  /*!
+    Finding the first clear bit with BitVector_readBit...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS && BitVector_readBit(bvBenchmark, ui32Counter) == 1 ; ui32Counter++){
+    }
+    ui32Result = ui32Counter;
+  }
+  printf("Bit loop find first clear:  %8.3f ms (position %u)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS, (unsigned int) ui32Result);
+
+  /*!
+    Finding the first clear bit with BitVector_findFirstClear...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    ui32Result = BitVector_findFirstClear(bvBenchmark, AMOUNT_OF_BITS);
+  }
+  printf("Word scan find first clear: %8.3f ms (position %u)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS, (unsigned int) ui32Result);
+
+  /*!
+    Counting the set bits with BitVector_readBit...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    uint32_t ui32AmountOfOnes = 0;
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS ; ui32Counter++){
+      ui32AmountOfOnes = ui32AmountOfOnes + BitVector_readBit(bvBenchmark, ui32Counter);
+    }
+    ui32Result = ui32AmountOfOnes;
+  }
+  printf("Bit loop count ones:        %8.3f ms (%u ones)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS, (unsigned int) ui32Result);
+
+  /*!
+    Counting the set bits with BitVector_countOnes...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    ui32Result = BitVector_countOnes(bvBenchmark, AMOUNT_OF_BITS);
+  }
+  printf("Word scan count ones:       %8.3f ms (%u ones)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS, (unsigned int) ui32Result);
+
+  return 0;
+}
@@ -0,0 +1,165 @@
+//! Example 04 - Bulk operations benchmark
+/*!
+  This simply example compares the bulk functions of a bit vector
+  (BitVector_and, BitVector_or, BitVector_xor, BitVector_andNot,
+  BitVector_setRange and BitVector_countRange) with the classic per-bit
+  loops. Change __BIT_VECTOR_SIMD_ENABLE__ in Configs.h to compare the
+  SIMD kernels with the word kernels.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Benchmark parameters.
+*/
+#define AMOUNT_OF_BITS 1048576
+#define AMOUNT_OF_ROUNDS 50
+
+/*!
+  Bit vectors.
+*/
+newStaticBitVector(bvOperandA, AMOUNT_OF_BITS);
+newStaticBitVector(bvOperandB, AMOUNT_OF_BITS);
+newStaticBitVector(bvResult, AMOUNT_OF_BITS);
+
+/*!
+  Throughput printer.
+*/
+void printThroughput(const char* cpName, clock_t ckStart){
+  double dSeconds = (double) (clock() - ckStart) / CLOCKS_PER_SEC;
+  if (dSeconds <= 0){
+    dSeconds = 1.0 / CLOCKS_PER_SEC;
+  }
+  printf("%-24s %10.1f Mbit/s\n", cpName, (double) AMOUNT_OF_BITS * AMOUNT_OF_ROUNDS / dSeconds / 1000000.0);
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Round = 0;
+  volatile uint32_t ui32Result = 0;
+  clock_t ckStart = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS ; ui32Counter++){
+    if ((ui32Counter % 3) == 0){
+      BitVector_setBit(bvOperandA, ui32Counter);
+    }
+    if ((ui32Counter % 5) == 0){
+      BitVector_setBit(bvOperandB, ui32Counter);
+    }
+  }
+
+  /*!
+    AND with BitVector_readBit loop...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS ; ui32Counter++){
+      if (BitVector_readBit(bvOperandA, ui32Counter) && BitVector_readBit(bvOperandB, ui32Counter)){
+        BitVector_setBit(bvResult, ui32Counter);
+      }
+      else{
+        BitVector_clearBit(bvResult, ui32Counter);
+      }
+    }
+  }
+  printThroughput("Bit loop AND:", ckStart);
+
+  /*!
+    Bulk boolean operations...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    BitVector_and(bvResult, bvOperandA, bvOperandB, AMOUNT_OF_BITS);
+  }
+  printThroughput("BitVector_and:", ckStart);
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    BitVector_or(bvResult, bvOperandA, bvOperandB, AMOUNT_OF_BITS);
+  }
+  printThroughput("BitVector_or:", ckStart);
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    BitVector_xor(bvResult, bvOperandA, bvOperandB, AMOUNT_OF_BITS);
+  }
+  printThroughput("BitVector_xor:", ckStart);
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    BitVector_andNot(bvResult, bvOperandA, bvOperandB, AMOUNT_OF_BITS);
+  }
+  printThroughput("BitVector_andNot:", ckStart);
+
+  /*!
+    Setting a range with BitVector_setBit loop and with BitVector_setRange...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 3 ; ui32Counter < AMOUNT_OF_BITS - 3 ; ui32Counter++){
+      BitVector_setBit(bvResult, ui32Counter);
+    }
+  }
+  printThroughput("Bit loop set range:", ckStart);
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    BitVector_setRange(bvResult, 3, AMOUNT_OF_BITS - 6);
+  }
+  printThroughput("BitVector_setRange:", ckStart);
+
+  /*!
+    Counting the set bits with BitVector_readBit loop and with BitVector_countRange...
+  */
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    uint32_t ui32AmountOfOnes = 0;
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_BITS ; ui32Counter++){
+      ui32AmountOfOnes = ui32AmountOfOnes + BitVector_readBit(bvOperandA, ui32Counter);
+    }
+    ui32Result = ui32AmountOfOnes;
+  }
+  printThroughput("Bit loop count:", ckStart);
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    ui32Result = BitVector_countRange(bvOperandA, 0, AMOUNT_OF_BITS);
+  }
+  printThroughput("BitVector_countRange:", ckStart);
+  printf("Set bits of operand A: %u\n", (unsigned int) ui32Result);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+//! Example 05 - Hierarchical bit vector benchmark
+/*!
+  This simply example compares the first clear bit search of a flat bit
+  vector (BitVector_findFirstClear) with a hierarchical bit vector
+  (HierarchicalBitVector_findFirstClear) on an allocation map with 99% of
+  occupancy. Each round frees a random position and allocates the first
+  free position again, so the first clear bit is anywhere in the map.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Benchmark parameters.
+*/
+#define AMOUNT_OF_BITS 4194304
+#define AMOUNT_OF_USED_BITS (AMOUNT_OF_BITS / 100 * 99)
+#define AMOUNT_OF_ROUNDS 2000
+
+/*!
+  Allocation maps.
+*/
+newStaticBitVector(bvFlatMap, AMOUNT_OF_BITS);
+newStaticHierarchicalBitVector(hbvHierarchicalMap, AMOUNT_OF_BITS);
+
+/*!
+  Pseudo-random generator (xorshift), so both maps get the same positions.
+*/
+uint32_t ui32Seed = 2463534242U;
+uint32_t getRandomPosition(){
+  ui32Seed = ui32Seed ^ (ui32Seed << 13);
+  ui32Seed = ui32Seed ^ (ui32Seed >> 17);
+  ui32Seed = ui32Seed ^ (ui32Seed << 5);
+  return ui32Seed % AMOUNT_OF_USED_BITS;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Position = 0;
+  uint32_t ui32FlatResult = 0;
+  uint32_t ui32HierarchicalResult = 0;
+  clock_t ckStart = 0;
+  double dFlatTime = 0;
+  double dHierarchicalTime = 0;
+  BitVector_setRange(bvFlatMap, 0, AMOUNT_OF_USED_BITS);
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_USED_BITS ; ui32Counter++){
+    HierarchicalBitVector_setBit(hbvHierarchicalMap, ui32Counter);
+  }
+
+  /*!
+    Freeing and allocating on the flat map...
+  */
+  ui32Seed = 2463534242U;
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    ui32Position = getRandomPosition();
+    BitVector_clearBit(bvFlatMap, ui32Position);
+    ui32Position = BitVector_findFirstClear(bvFlatMap, AMOUNT_OF_BITS);
+    BitVector_setBit(bvFlatMap, ui32Position);
+    ui32FlatResult = ui32FlatResult + ui32Position;
+  }
+  dFlatTime = 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS;
+
+  /*!
+    Freeing and allocating on the hierarchical map...
+  */
+  ui32Seed = 2463534242U;
+  ckStart = clock();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    ui32Position = getRandomPosition();
+    HierarchicalBitVector_clearBit(hbvHierarchicalMap, ui32Position);
+    ui32Position = HierarchicalBitVector_findFirstClear(hbvHierarchicalMap);
+    HierarchicalBitVector_setBit(hbvHierarchicalMap, ui32Position);
+    ui32HierarchicalResult = ui32HierarchicalResult + ui32Position;
+  }
+  dHierarchicalTime = 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_ROUNDS;
+
+  printf("Flat bit vector:         %10.3f us per allocation\n", dFlatTime);
+  printf("Hierarchical bit vector: %10.3f us per allocation\n", dHierarchicalTime);
+  if (ui32FlatResult != ui32HierarchicalResult){
+    printf("ERROR: The maps are different!\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,146 @@
+//! Example 06 - Rank and select index
+/*!
+  This simply example uses a rank/select index as a compact lookup table:
+  the identifiers of a sparse set are marked in a bit vector and the data
+  of each identifier is saved in a dense vector at the position given by
+  RankSelect_rank. RankSelect_select makes the inverse way. Both are
+  compared with BitVector_readBit loops.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_IDENTIFIERS 1048576
+#define AMOUNT_OF_QUERIES 1000
+
+/*!
+  Set of identifiers and its index.
+*/
+newStaticBitVector(bvIdentifiers, AMOUNT_OF_IDENTIFIERS);
+newStaticRankSelect(rsIdentifiers, bvIdentifiers, AMOUNT_OF_IDENTIFIERS);
+
+/*!
+  Dense data: one value for each identifier of the set.
+*/
+static uint32_t ui32Values[AMOUNT_OF_IDENTIFIERS / 16];
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Query = 0;
+  uint32_t ui32Identifier = 0;
+  volatile uint32_t ui32Result = 0;
+  clock_t ckStart = 0;
+
+  /*!
+    Marking one identifier of each sixteen...
+  */
+  for (ui32Identifier = 7 ; ui32Identifier < AMOUNT_OF_IDENTIFIERS ; ui32Identifier = ui32Identifier + 16){
+    BitVector_setBit(bvIdentifiers, ui32Identifier);
+  }
+  RankSelect_build(rsIdentifiers);
+  for (ui32Counter = 0 ; ui32Counter < RankSelect_getAmountOfOnes(rsIdentifiers) ; ui32Counter++){
+    ui32Values[ui32Counter] = RankSelect_select(rsIdentifiers, ui32Counter) * 10;
+  }
+  printf("Identifiers in the set: %u\n", (unsigned int) RankSelect_getAmountOfOnes(rsIdentifiers));
+
+  /*!
+    Looking for the data of an identifier...
+  */
+  ui32Identifier = 700007;
+  if (BitVector_readBit(bvIdentifiers, ui32Identifier) == 1){
+    printf("Value of identifier %u: %u\n", (unsigned int) ui32Identifier, (unsigned int) ui32Values[RankSelect_rank(rsIdentifiers, ui32Identifier)]);
+  }
+
+  /*!
+    Rank with BitVector_readBit loop...
+  */
+  ckStart = clock();
+  for (ui32Query = 0 ; ui32Query < AMOUNT_OF_QUERIES ; ui32Query++){
+    uint32_t ui32Rank = 0;
+    ui32Identifier = (ui32Query * 7919) % AMOUNT_OF_IDENTIFIERS;
+    for (ui32Counter = 0 ; ui32Counter < ui32Identifier ; ui32Counter++){
+      ui32Rank = ui32Rank + BitVector_readBit(bvIdentifiers, ui32Counter);
+    }
+    ui32Result = ui32Rank;
+  }
+  printf("Bit loop rank:     %10.3f us (last result %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_QUERIES, (unsigned int) ui32Result);
+
+  /*!
+    Rank with the index...
+  */
+  ckStart = clock();
+  for (ui32Query = 0 ; ui32Query < AMOUNT_OF_QUERIES ; ui32Query++){
+    ui32Result = RankSelect_rank(rsIdentifiers, (ui32Query * 7919) % AMOUNT_OF_IDENTIFIERS);
+  }
+  printf("RankSelect_rank:   %10.3f us (last result %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_QUERIES, (unsigned int) ui32Result);
+
+  /*!
+    Select with BitVector_readBit loop...
+  */
+  ckStart = clock();
+  for (ui32Query = 0 ; ui32Query < AMOUNT_OF_QUERIES ; ui32Query++){
+    uint32_t ui32Rank = (ui32Query * 7919) % RankSelect_getAmountOfOnes(rsIdentifiers);
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_IDENTIFIERS ; ui32Counter++){
+      if (BitVector_readBit(bvIdentifiers, ui32Counter) == 1){
+        if (ui32Rank == 0){
+          break;
+        }
+        ui32Rank--;
+      }
+    }
+    ui32Result = ui32Counter;
+  }
+  printf("Bit loop select:   %10.3f us (last result %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_QUERIES, (unsigned int) ui32Result);
+
+  /*!
+    Select with the index...
+  */
+  ckStart = clock();
+  for (ui32Query = 0 ; ui32Query < AMOUNT_OF_QUERIES ; ui32Query++){
+    ui32Result = RankSelect_select(rsIdentifiers, (ui32Query * 7919) % RankSelect_getAmountOfOnes(rsIdentifiers));
+  }
+  printf("RankSelect_select: %10.3f us (last result %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_QUERIES, (unsigned int) ui32Result);
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+//! Example 07 - Concurrent slot allocation
+/*!
+  This simply example uses an atomic bit vector as a lock-free slot
+  allocator. Some threads claim slots with AtomicBitVector_claimFirstClear,
+  check that no other thread owns the same slot and give it back. It also
+  checks that threads setting bits of the same words with
+  AtomicBitVector_setBit don't lose updates (BitVector_setBit must not be
+  used this way: a data race is undefined behaviour). Compile it with
+  -pthread.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_SLOTS 1024
+#define AMOUNT_OF_CLAIMS 200000
+#define AMOUNT_OF_BITS 1048576
+#define MAX_AMOUNT_OF_THREADS 8
+
+/*!
+  Slot allocator and owners of the slots.
+*/
+newStaticAtomicBitVector(abvSlots, AMOUNT_OF_SLOTS);
+static uint32_t ui32Owners[AMOUNT_OF_SLOTS];
+static uint32_t ui32AmountOfErrors = 0;
+
+/*!
+  Bit vector set by all threads together.
+*/
+newStaticAtomicBitVector(abvShared, AMOUNT_OF_BITS);
+static uint32_t ui32AmountOfThreads = 0;
+
+/*!
+  Slot allocation thread.
+*/
+static void* slotThread(void* vpArgument){
+  uint32_t ui32Thread = (uint32_t) (uintptr_t) vpArgument;
+  uint32_t ui32Counter = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_CLAIMS ; ui32Counter++){
+    uint32_t ui32Slot = AtomicBitVector_claimFirstClear(abvSlots, AMOUNT_OF_SLOTS, ui32Thread * (AMOUNT_OF_SLOTS / MAX_AMOUNT_OF_THREADS));
+    if (ui32Slot == BIT_VECTOR_NOT_FOUND){
+      continue;
+    }
+    if (__atomic_fetch_add(&ui32Owners[ui32Slot], 1, __ATOMIC_RELAXED) != 0){
+      __atomic_fetch_add(&ui32AmountOfErrors, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_sub(&ui32Owners[ui32Slot], 1, __ATOMIC_RELAXED);
+    AtomicBitVector_clearBit(abvSlots, ui32Slot, BIT_VECTOR_ORDER_RELEASE);
+  }
+  return NULL;
+}
+
+/*!
+  Shared bits thread: each thread sets the bits of its own positions, but the words are shared.
+*/
+static void* atomicThread(void* vpArgument){
+  uint32_t ui32Position = 0;
+  for (ui32Position = (uint32_t) (uintptr_t) vpArgument ; ui32Position < AMOUNT_OF_BITS ; ui32Position = ui32Position + ui32AmountOfThreads){
+    AtomicBitVector_setBit(abvShared, ui32Position, BIT_VECTOR_ORDER_RELAXED);
+  }
+  return NULL;
+}
+
+/*!
+  Runs a function in some threads and returns the elapsed time in seconds.
+*/
+static double runThreads(void* (*vpfFunction)(void*), uint32_t ui32Threads){
+  pthread_t ptThreads[MAX_AMOUNT_OF_THREADS];
+  struct timespec tsStart, tsEnd;
+  uint32_t ui32Counter = 0;
+  clock_gettime(CLOCK_MONOTONIC, &tsStart);
+  for (ui32Counter = 0 ; ui32Counter < ui32Threads ; ui32Counter++){
+    pthread_create(&ptThreads[ui32Counter], NULL, vpfFunction, (void*) (uintptr_t) ui32Counter);
+  }
+  for (ui32Counter = 0 ; ui32Counter < ui32Threads ; ui32Counter++){
+    pthread_join(ptThreads[ui32Counter], NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &tsEnd);
+  return (tsEnd.tv_sec - tsStart.tv_sec) + (tsEnd.tv_nsec - tsStart.tv_nsec) / 1000000000.0;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Threads = 0;
+
+  /*!
+    Slot allocation scaling...
+  */
+  for (ui32Threads = 1 ; ui32Threads <= MAX_AMOUNT_OF_THREADS ; ui32Threads = ui32Threads * 2){
+    double dSeconds = runThreads(slotThread, ui32Threads);
+    printf("%u thread(s): %8.2f million claims/s\n", (unsigned int) ui32Threads, ui32Threads * (double) AMOUNT_OF_CLAIMS / dSeconds / 1000000.0);
+  }
+  printf("Slots owned twice: %u\n", (unsigned int) ui32AmountOfErrors);
+  printf("Slots still claimed: %u\n", (unsigned int) AtomicBitVector_countOnes(abvSlots, AMOUNT_OF_SLOTS));
+
+  /*!
+    Shared words with atomic operations...
+  */
+  ui32AmountOfThreads = MAX_AMOUNT_OF_THREADS;
+  runThreads(atomicThread, ui32AmountOfThreads);
+  printf("AtomicBitVector_setBit lost updates: %u\n", (unsigned int) (AMOUNT_OF_BITS - AtomicBitVector_countOnes(abvShared, AMOUNT_OF_BITS)));
+
+  if (ui32AmountOfErrors != 0 || AtomicBitVector_countOnes(abvSlots, AMOUNT_OF_SLOTS) != 0 || AtomicBitVector_countOnes(abvShared, AMOUNT_OF_BITS) != AMOUNT_OF_BITS){
+    return 1;
+  }
+  return 0;
+}
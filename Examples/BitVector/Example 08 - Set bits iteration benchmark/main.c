@@ -0,0 +1,161 @@
+//! Example 08 - Set bits iteration benchmark
+/*!
+  This simply example walks the set bits and the runs of set bits of a
+  sparse 1M-bit vector with a BitVector_readBit loop, with an iterator and
+  with BitVector_forEachSet/BitVector_forEachRun. The iterator skips empty
+  words, so it is much faster on sparse bit vectors.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_BITS 1048576
+#define AMOUNT_OF_REPETITIONS 10
+
+/*!
+  Sparse bit vector: a bit of each 10000 and a run of 100 bits at each 100000.
+*/
+newStaticBitVector(bvSparse, AMOUNT_OF_BITS);
+
+/*!
+  Callbacks: they sum the positions, so all methods can be compared.
+*/
+static bool sumPosition(uint32_t ui32Position, void* vpContext){
+  *((uint64_t*) vpContext) = *((uint64_t*) vpContext) + ui32Position;
+  return true;
+}
+
+static bool sumRun(uint32_t ui32Start, uint32_t ui32Length, void* vpContext){
+  *((uint64_t*) vpContext) = *((uint64_t*) vpContext) + ui32Start + ui32Length;
+  return true;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Position = 0;
+  uint32_t ui32Length = 0;
+  uint64_t ui64Sum = 0;
+  clock_t ckStart = 0;
+
+  for (ui32Position = 0 ; ui32Position < AMOUNT_OF_BITS ; ui32Position = ui32Position + 10000){
+    BitVector_setBit(bvSparse, ui32Position);
+  }
+  for (ui32Position = 50000 ; ui32Position < AMOUNT_OF_BITS ; ui32Position = ui32Position + 100000){
+    BitVector_setRange(bvSparse, ui32Position, 100);
+  }
+
+  /*!
+    Set bits with BitVector_readBit loop...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    for (ui32Position = 0 ; ui32Position < AMOUNT_OF_BITS ; ui32Position++){
+      if (BitVector_readBit(bvSparse, ui32Position) == 1){
+        ui64Sum = ui64Sum + ui32Position;
+      }
+    }
+  }
+  printf("Bit loop:             %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Set bits with an iterator...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    newBitVectorIterator(bviSparse, bvSparse, AMOUNT_OF_BITS);
+    for (ui32Position = BitVector_nextSet(bviSparse) ; ui32Position != BIT_VECTOR_NOT_FOUND ; ui32Position = BitVector_nextSet(bviSparse)){
+      ui64Sum = ui64Sum + ui32Position;
+    }
+  }
+  printf("BitVector_nextSet:    %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Set bits with BitVector_forEachSet...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    BitVector_forEachSet(bvSparse, AMOUNT_OF_BITS, sumPosition, &ui64Sum);
+  }
+  printf("BitVector_forEachSet: %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Runs with BitVector_readBit loop...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    for (ui32Position = 0 ; ui32Position < AMOUNT_OF_BITS ; ui32Position++){
+      if (BitVector_readBit(bvSparse, ui32Position) == 1){
+        uint32_t ui32Start = ui32Position;
+        while (ui32Position < AMOUNT_OF_BITS && BitVector_readBit(bvSparse, ui32Position) == 1){
+          ui32Position++;
+        }
+        ui64Sum = ui64Sum + ui32Start + (ui32Position - ui32Start);
+      }
+    }
+  }
+  printf("Run bit loop:         %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Runs with an iterator...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    newBitVectorIterator(bviSparse, bvSparse, AMOUNT_OF_BITS);
+    for (ui32Position = BitVector_nextRun(bviSparse, &ui32Length) ; ui32Position != BIT_VECTOR_NOT_FOUND ; ui32Position = BitVector_nextRun(bviSparse, &ui32Length)){
+      ui64Sum = ui64Sum + ui32Position + ui32Length;
+    }
+  }
+  printf("BitVector_nextRun:    %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Runs with BitVector_forEachRun...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    BitVector_forEachRun(bvSparse, AMOUNT_OF_BITS, sumRun, &ui64Sum);
+  }
+  printf("BitVector_forEachRun: %10.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+//! Example 09 - C++ bit vector
+/*!
+  This simply example uses the C++ BitVector<N> template on the storage of
+  C bit vectors, with no copies, and compares a bit-by-bit AND loop with the
+  C macros to the template operators. It needs C++14.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+#include <BitVector.hpp>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_BITS 65536
+#define AMOUNT_OF_REPETITIONS 1000
+
+/*!
+  C bit vectors.
+*/
+newStaticBitVector(bvPermissions, AMOUNT_OF_BITS);
+newStaticBitVector(bvRequests, AMOUNT_OF_BITS);
+newStaticBitVector(bvGranted, AMOUNT_OF_BITS);
+
+/*!
+  Compile-time bit vector: the positions are constant, so this is built by the compiler.
+*/
+constexpr MemoryManager::BitVector<16> createFlags(){
+  MemoryManager::BitVector<16> bvFlags;
+  bvFlags.setBit(1);
+  bvFlags.setBit(9);
+  return bvFlags;
+}
+static_assert(createFlags().readBit(9), "The flags are built at compile time.");
+
+/*!
+  Main function.
+*/
+int main(){
+  using PermissionVector = MemoryManager::BitVector<AMOUNT_OF_BITS, uint64_t>;
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Position = 0;
+  clock_t ckStart = 0;
+
+  for (ui32Position = 0 ; ui32Position < AMOUNT_OF_BITS ; ui32Position++){
+    if ((ui32Position % 3) == 0){
+      BitVector_setBit(bvPermissions, ui32Position);
+    }
+    if ((ui32Position % 5) != 0){
+      BitVector_setBit(bvRequests, ui32Position);
+    }
+  }
+
+  /*!
+    The C storage seen as C++ bit vectors...
+  */
+  PermissionVector& bvPermissionsView = PermissionVector::fromData(bvPermissions);
+  const PermissionVector& bvRequestsView = PermissionVector::fromData(bvRequests);
+  PermissionVector& bvGrantedView = PermissionVector::fromData(bvGranted);
+
+  /*!
+    AND with the C macros...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    for (ui32Position = 0 ; ui32Position < AMOUNT_OF_BITS ; ui32Position++){
+      if (BitVector_readBit(bvPermissions, ui32Position) == 1 && BitVector_readBit(bvRequests, ui32Position) == 1){
+        BitVector_setBit(bvGranted, ui32Position);
+      }
+      else{
+        BitVector_clearBit(bvGranted, ui32Position);
+      }
+    }
+  }
+  printf("C macros AND:  %8.2f us (granted: %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned int) BitVector_countOnes(bvGranted, AMOUNT_OF_BITS));
+
+  /*!
+    AND with the C++ operators...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    bvGrantedView = bvPermissionsView;
+    bvGrantedView &= bvRequestsView;
+  }
+  printf("C++ AND:       %8.2f us (granted: %u)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned int) bvGrantedView.countOnes());
+
+  printf("Compile-time flags: %u set bits, first is %u\n", (unsigned int) createFlags().countOnes(), (unsigned int) createFlags().findNextSet());
+  return 0;
+}
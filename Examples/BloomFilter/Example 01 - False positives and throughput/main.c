@@ -0,0 +1,141 @@
+//! Example 01 - False positives and throughput
+/*!
+  This simply example adds 4 million keys to a Bloom filter and to a
+  blocked Bloom filter (10 bits per key) and measures their false positive
+  rates and queries per second, for added keys (all bits are checked) and for
+  other keys, one key at a time and in batch. The blocked filter reads one
+  cache line for each key. It also removes keys from a counting Bloom filter.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_KEYS 4000000
+#define AMOUNT_OF_QUERIES 4000000
+#define BITS_PER_KEY 10
+
+/*!
+  Filters and key hashes.
+*/
+newStaticBloomFilter(bfKeys, AMOUNT_OF_KEYS * BITS_PER_KEY, 7);
+newStaticBlockedBloomFilter(bfBlockedKeys, AMOUNT_OF_KEYS * BITS_PER_KEY, 8);
+newStaticCountingBloomFilter(cbfKeys, 100000 * BITS_PER_KEY, 7);
+static uint64_t ui64Hashes[AMOUNT_OF_QUERIES];
+
+/*!
+  Checks the keys of ui64Hashes in a Bloom filter.
+*/
+static uint32_t checkKeys(bloomfilter_t bfFilter, double* dpQueriesPerSecond){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfPositives = 0;
+  clock_t ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_QUERIES ; ui32Counter++){
+    ui32AmountOfPositives = ui32AmountOfPositives + BloomFilter_containsHash(bfFilter, ui64Hashes[ui32Counter]);
+  }
+  *dpQueriesPerSecond = AMOUNT_OF_QUERIES / ((double) (clock() - ckStart) / CLOCKS_PER_SEC);
+  return ui32AmountOfPositives;
+}
+
+/*!
+  Measures a Bloom filter with the added keys and with keys that were not added.
+*/
+static uint32_t measureFilter(const char* cpName, bloomfilter_t bfFilter){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfPositives = 0;
+  uint32_t ui32AmountOfErrors = 0;
+  double dAddedKeys = 0;
+  double dOtherKeys = 0;
+  double dBatch = 0;
+  clock_t ckStart = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_QUERIES ; ui32Counter++){
+    ui64Hashes[ui32Counter] = BloomFilter_hashInteger(ui32Counter % AMOUNT_OF_KEYS);
+  }
+  ui32AmountOfErrors = AMOUNT_OF_QUERIES - checkKeys(bfFilter, &dAddedKeys);
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_QUERIES ; ui32Counter++){
+    ui64Hashes[ui32Counter] = BloomFilter_hashInteger(AMOUNT_OF_KEYS + ui32Counter);
+  }
+  ui32AmountOfPositives = checkKeys(bfFilter, &dOtherKeys);
+  ckStart = clock();
+  ui32AmountOfErrors = ui32AmountOfErrors + (BloomFilter_containsBatch(bfFilter, ui64Hashes, AMOUNT_OF_QUERIES, NULL) != ui32AmountOfPositives);
+  dBatch = AMOUNT_OF_QUERIES / ((double) (clock() - ckStart) / CLOCKS_PER_SEC);
+  printf("%s: %.3f%% false positives, %6.1f M queries/s (added keys), %6.1f M queries/s (other keys), %6.1f M queries/s (other keys in batch)\n", cpName, 100.0 * ui32AmountOfPositives / AMOUNT_OF_QUERIES, dAddedKeys / 1000000.0, dOtherKeys / 1000000.0, dBatch / 1000000.0);
+  return ui32AmountOfErrors;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfErrors = 0;
+
+  /*!
+    Adding the keys 0 to AMOUNT_OF_KEYS - 1...
+  */
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_KEYS ; ui32Counter++){
+    ui64Hashes[ui32Counter] = BloomFilter_hashInteger(ui32Counter);
+  }
+  BloomFilter_addBatch(bfKeys, ui64Hashes, AMOUNT_OF_KEYS);
+  BloomFilter_addBatch(bfBlockedKeys, ui64Hashes, AMOUNT_OF_KEYS);
+
+  ui32AmountOfErrors = ui32AmountOfErrors + measureFilter("Bloom filter        ", bfKeys);
+  ui32AmountOfErrors = ui32AmountOfErrors + measureFilter("Blocked Bloom filter", bfBlockedKeys);
+
+  /*!
+    Counting Bloom filter: adding 100000 keys and removing the half of them...
+  */
+  for (ui32Counter = 0 ; ui32Counter < 100000 ; ui32Counter++){
+    CountingBloomFilter_add(cbfKeys, &ui32Counter, sizeof(ui32Counter));
+  }
+  for (ui32Counter = 0 ; ui32Counter < 50000 ; ui32Counter++){
+    ui32AmountOfErrors = ui32AmountOfErrors + (CountingBloomFilter_remove(cbfKeys, &ui32Counter, sizeof(ui32Counter)) == false);
+  }
+  for (ui32Counter = 50000 ; ui32Counter < 100000 ; ui32Counter++){
+    ui32AmountOfErrors = ui32AmountOfErrors + (CountingBloomFilter_contains(cbfKeys, &ui32Counter, sizeof(ui32Counter)) == false);
+  }
+  printf("Counting Bloom filter: keys 50000 to 99999 are still there after removing keys 0 to 49999.\n");
+
+  if (ui32AmountOfErrors != 0){
+    printf("ERROR: A key was not found!");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,139 @@
+//! Example 02 - Batch queries on a large filter
+/*!
+  This simply example adds 4 million keys to a Bloom filter and to a blocked
+  Bloom filter of 512 MiB each, much bigger than the cache, so almost every
+  key misses the cache. It compares the keys per second of one key at a time
+  (BloomFilter_addHash and BloomFilter_containsHash) with the batch functions
+  (BloomFilter_addBatch and BloomFilter_containsBatch), which prefetch the
+  cache lines of the next keys so their misses overlap.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_KEYS 4000000
+#define AMOUNT_OF_BITS 0xFFFFFE00U
+
+/*!
+  Filters and key hashes.
+*/
+newStaticBloomFilter(bfKeys, AMOUNT_OF_BITS, 7);
+newStaticBlockedBloomFilter(bfBlockedKeys, AMOUNT_OF_BITS, 8);
+static uint64_t ui64AddedHashes[AMOUNT_OF_KEYS];
+static uint64_t ui64OtherHashes[AMOUNT_OF_KEYS];
+
+/*!
+  Converts a time to millions of keys per second.
+*/
+static double getKeysPerSecond(clock_t ckStart){
+  return AMOUNT_OF_KEYS / ((double) (clock() - ckStart) / CLOCKS_PER_SEC) / 1000000.0;
+}
+
+/*!
+  Checks the keys of an array one at a time.
+*/
+static uint32_t checkKeys(bloomfilter_t bfFilter, const uint64_t* ui64pHashes){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfPositives = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_KEYS ; ui32Counter++){
+    ui32AmountOfPositives = ui32AmountOfPositives + BloomFilter_containsHash(bfFilter, ui64pHashes[ui32Counter]);
+  }
+  return ui32AmountOfPositives;
+}
+
+/*!
+  Measures a Bloom filter: the first half of the keys is added one at a time and the second half in batch, then the added keys and other keys are checked both ways.
+*/
+static uint32_t measureFilter(const char* cpName, bloomfilter_t bfFilter){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfErrors = 0;
+  double daKeysPerSecond[6];
+  clock_t ckStart = 0;
+  BloomFilter_clear(bfFilter);                                                                  /*!< Maps the pages of the filter before the measures. */
+  ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_KEYS / 2 ; ui32Counter++){
+    BloomFilter_addHash(bfFilter, ui64AddedHashes[ui32Counter]);
+  }
+  daKeysPerSecond[0] = getKeysPerSecond(ckStart) / 2;
+  ckStart = clock();
+  BloomFilter_addBatch(bfFilter, &ui64AddedHashes[AMOUNT_OF_KEYS / 2], AMOUNT_OF_KEYS / 2);
+  daKeysPerSecond[1] = getKeysPerSecond(ckStart) / 2;
+  ckStart = clock();
+  ui32AmountOfErrors = ui32AmountOfErrors + (AMOUNT_OF_KEYS - checkKeys(bfFilter, ui64AddedHashes));
+  daKeysPerSecond[2] = getKeysPerSecond(ckStart);
+  ckStart = clock();
+  ui32AmountOfErrors = ui32AmountOfErrors + (AMOUNT_OF_KEYS - BloomFilter_containsBatch(bfFilter, ui64AddedHashes, AMOUNT_OF_KEYS, NULL));
+  daKeysPerSecond[3] = getKeysPerSecond(ckStart);
+  ckStart = clock();
+  ui32Counter = checkKeys(bfFilter, ui64OtherHashes);
+  daKeysPerSecond[4] = getKeysPerSecond(ckStart);
+  ckStart = clock();
+  ui32AmountOfErrors = ui32AmountOfErrors + (BloomFilter_containsBatch(bfFilter, ui64OtherHashes, AMOUNT_OF_KEYS, NULL) != ui32Counter);
+  daKeysPerSecond[5] = getKeysPerSecond(ckStart);
+  printf("%s  add %6.1f / %6.1f   added keys %6.1f / %6.1f   other keys %6.1f / %6.1f\n", cpName, daKeysPerSecond[0], daKeysPerSecond[1], daKeysPerSecond[2], daKeysPerSecond[3], daKeysPerSecond[4], daKeysPerSecond[5]);
+  return ui32AmountOfErrors;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfErrors = 0;
+
+  /*!
+    Hashing the added keys and other keys...
+  */
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_KEYS ; ui32Counter++){
+    ui64AddedHashes[ui32Counter] = BloomFilter_hashInteger(ui32Counter);
+    ui64OtherHashes[ui32Counter] = BloomFilter_hashInteger(AMOUNT_OF_KEYS + ui32Counter);
+  }
+
+  printf("Million keys per second, one key at a time / in batch:\n");
+  ui32AmountOfErrors = ui32AmountOfErrors + measureFilter("Bloom filter        ", bfKeys);
+  ui32AmountOfErrors = ui32AmountOfErrors + measureFilter("Blocked Bloom filter", bfBlockedKeys);
+
+  if (ui32AmountOfErrors != 0){
+    printf("ERROR: A key was not found!");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,209 @@
+//! Example 04 - Single producer single consumer benchmark
+/*!
+  This simply example moves data from a producer thread to a consumer thread
+  with a lock-free BUFFER_TYPE_SPSC buffer and with a BUFFER_TYPE_QUEUE
+  buffer protected by a mutex. It measures the throughput and the round trip
+  latency of a ping-pong between two threads, and checks that no data was
+  lost or reordered.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 255
+#define AMOUNT_OF_DATA 2000000
+#define AMOUNT_OF_ROUND_TRIPS 20000
+
+/*!
+  Buffers: data and answer of each mode.
+*/
+newStaticSPSCBuffer(bfSPSCData, uint64_t, BUFFER_SIZE);
+newStaticSPSCBuffer(bfSPSCAnswer, uint64_t, BUFFER_SIZE);
+newStaticBuffer(bfQueueData, BUFFER_TYPE_QUEUE, uint64_t, BUFFER_SIZE);
+newStaticBuffer(bfQueueAnswer, BUFFER_TYPE_QUEUE, uint64_t, BUFFER_SIZE);
+static pthread_mutex_t pmQueueMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t ui32AmountOfErrors = 0;
+
+/*!
+  Push and pop functions of each mode. They return false if the buffer is full or empty.
+*/
+static bool spscPush(buffer_t bfBuffer, uint64_t ui64Data){
+  return Buffer_tryPush(bfBuffer, &ui64Data);
+}
+
+static bool spscPop(buffer_t bfBuffer, uint64_t* ui64pData){
+  return Buffer_tryPop(bfBuffer, ui64pData);
+}
+
+static bool queuePush(buffer_t bfBuffer, uint64_t ui64Data){
+  bool bPushed = false;
+  pthread_mutex_lock(&pmQueueMutex);
+  if (Buffer_getAmountOfPendingData(bfBuffer) < BUFFER_SIZE){                                                           /*!< The queue overwrites old data when it's full. */
+    Buffer_push(bfBuffer, &ui64Data);
+    bPushed = true;
+  }
+  pthread_mutex_unlock(&pmQueueMutex);
+  return bPushed;
+}
+
+static bool queuePop(buffer_t bfBuffer, uint64_t* ui64pData){
+  pthread_mutex_lock(&pmQueueMutex);
+  bool bPopped = Buffer_tryPop(bfBuffer, ui64pData);
+  pthread_mutex_unlock(&pmQueueMutex);
+  return bPopped;
+}
+
+/*!
+  Benchmark: buffers and functions.
+*/
+typedef struct {
+  const char* cpName;
+  buffer_t bfData;
+  buffer_t bfAnswer;
+  bool (*bpfPush)(buffer_t, uint64_t);
+  bool (*bpfPop)(buffer_t, uint64_t*);
+} benchmark_t;
+
+/*!
+  Waiting functions: yield the processor while the buffer is full or empty.
+*/
+static void push(const benchmark_t* bpBenchmark, buffer_t bfBuffer, uint64_t ui64Data){
+  while (bpBenchmark->bpfPush(bfBuffer, ui64Data) == false){
+    sched_yield();
+  }
+}
+
+static uint64_t pop(const benchmark_t* bpBenchmark, buffer_t bfBuffer){
+  uint64_t ui64Data = 0;
+  while (bpBenchmark->bpfPop(bfBuffer, &ui64Data) == false){
+    sched_yield();
+  }
+  return ui64Data;
+}
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return tsTime.tv_sec + tsTime.tv_nsec / 1000000000.0;
+}
+
+/*!
+  Throughput threads: the consumer checks the sequence of data.
+*/
+static void* producerThread(void* vpArgument){
+  const benchmark_t* bpBenchmark = (const benchmark_t*) vpArgument;
+  uint64_t ui64Counter = 0;
+  for (ui64Counter = 0 ; ui64Counter < AMOUNT_OF_DATA ; ui64Counter++){
+    push(bpBenchmark, bpBenchmark->bfData, ui64Counter);
+  }
+  return NULL;
+}
+
+static void* consumerThread(void* vpArgument){
+  const benchmark_t* bpBenchmark = (const benchmark_t*) vpArgument;
+  uint64_t ui64Counter = 0;
+  for (ui64Counter = 0 ; ui64Counter < AMOUNT_OF_DATA ; ui64Counter++){
+    if (pop(bpBenchmark, bpBenchmark->bfData) != ui64Counter){
+      ui32AmountOfErrors++;
+    }
+  }
+  return NULL;
+}
+
+/*!
+  Latency thread: sends back each data received.
+*/
+static void* echoThread(void* vpArgument){
+  const benchmark_t* bpBenchmark = (const benchmark_t*) vpArgument;
+  uint32_t ui32Counter = 0;
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_ROUND_TRIPS ; ui32Counter++){
+    push(bpBenchmark, bpBenchmark->bfAnswer, pop(bpBenchmark, bpBenchmark->bfData));
+  }
+  return NULL;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  const benchmark_t bBenchmarks[2] = {
+    {"SPSC", bfSPSCData, bfSPSCAnswer, spscPush, spscPop},
+    {"Mutex queue", bfQueueData, bfQueueAnswer, queuePush, queuePop}
+  };
+  uint32_t ui32Benchmark = 0;
+
+  for (ui32Benchmark = 0 ; ui32Benchmark < 2 ; ui32Benchmark++){
+    const benchmark_t* bpBenchmark = &bBenchmarks[ui32Benchmark];
+    pthread_t ptProducer, ptConsumer;
+    uint32_t ui32Counter = 0;
+
+    /*!
+      Throughput...
+    */
+    double dStart = getTime();
+    pthread_create(&ptConsumer, NULL, consumerThread, (void*) bpBenchmark);
+    pthread_create(&ptProducer, NULL, producerThread, (void*) bpBenchmark);
+    pthread_join(ptProducer, NULL);
+    pthread_join(ptConsumer, NULL);
+    double dSeconds = getTime() - dStart;
+
+    /*!
+      Round trip latency...
+    */
+    pthread_create(&ptConsumer, NULL, echoThread, (void*) bpBenchmark);
+    dStart = getTime();
+    for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_ROUND_TRIPS ; ui32Counter++){
+      push(bpBenchmark, bpBenchmark->bfData, ui32Counter);
+      if (pop(bpBenchmark, bpBenchmark->bfAnswer) != ui32Counter){
+        ui32AmountOfErrors++;
+      }
+    }
+    double dRoundTrip = (getTime() - dStart) / AMOUNT_OF_ROUND_TRIPS;
+    pthread_join(ptConsumer, NULL);
+
+    printf("%-12s %8.2f million data/s, round trip %8.2f us\n", bpBenchmark->cpName, AMOUNT_OF_DATA / dSeconds / 1000000.0, dRoundTrip * 1000000.0);
+  }
+
+  printf("Lost or reordered data: %u\n", (unsigned int) ui32AmountOfErrors);
+  return (ui32AmountOfErrors == 0) ? 0 : 1;
+}
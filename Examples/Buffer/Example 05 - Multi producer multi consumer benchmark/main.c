@@ -0,0 +1,172 @@
+//! Example 05 - Multi producer multi consumer benchmark
+/*!
+  This simply example shares a lock-free BUFFER_TYPE_MPMC buffer between 1
+  to 16 producer threads and the same amount of consumer threads, and
+  compares its throughput with a BUFFER_TYPE_QUEUE buffer protected by a
+  mutex. The sum of the popped data checks that nothing was lost or
+  duplicated.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 128
+#define AMOUNT_OF_DATA 1048576
+#define MAX_AMOUNT_OF_THREADS 16
+
+/*!
+  Buffers and benchmark state.
+*/
+newStaticMPMCBuffer(bfMPMC, uint32_t, BUFFER_SIZE);
+newStaticBuffer(bfQueue, BUFFER_TYPE_QUEUE, uint32_t, BUFFER_SIZE);
+static pthread_mutex_t pmQueueMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t ui32AmountOfThreads = 0;
+static uint32_t ui32AmountOfPoppedData = 0;
+static uint64_t ui64Sum = 0;
+static bool bUseMutex = false;
+
+/*!
+  Push and pop functions. They return false if the buffer is full or empty.
+*/
+static bool push(uint32_t ui32Data){
+  if (bUseMutex == false){
+    return Buffer_tryPush(bfMPMC, &ui32Data);
+  }
+  bool bPushed = false;
+  pthread_mutex_lock(&pmQueueMutex);
+  if (Buffer_getAmountOfPendingData(bfQueue) < BUFFER_SIZE){                                                            /*!< The queue overwrites old data when it's full. */
+    Buffer_push(bfQueue, &ui32Data);
+    bPushed = true;
+  }
+  pthread_mutex_unlock(&pmQueueMutex);
+  return bPushed;
+}
+
+static bool pop(uint32_t* ui32pData){
+  if (bUseMutex == false){
+    return Buffer_tryPop(bfMPMC, ui32pData);
+  }
+  pthread_mutex_lock(&pmQueueMutex);
+  bool bPopped = Buffer_tryPop(bfQueue, ui32pData);
+  pthread_mutex_unlock(&pmQueueMutex);
+  return bPopped;
+}
+
+/*!
+  Producer and consumer threads.
+*/
+static void* producerThread(void* vpArgument){
+  uint32_t ui32Data = 0;
+  for (ui32Data = (uint32_t) (uintptr_t) vpArgument ; ui32Data < AMOUNT_OF_DATA ; ui32Data = ui32Data + ui32AmountOfThreads){
+    while (push(ui32Data) == false){
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void* consumerThread(void* vpArgument){
+  uint64_t ui64LocalSum = 0;
+  uint32_t ui32Data = 0;
+  (void) vpArgument;
+  while (__atomic_load_n(&ui32AmountOfPoppedData, __ATOMIC_RELAXED) < AMOUNT_OF_DATA){
+    if (pop(&ui32Data) == true){
+      ui64LocalSum = ui64LocalSum + ui32Data;
+      __atomic_fetch_add(&ui32AmountOfPoppedData, 1, __ATOMIC_RELAXED);
+    }
+    else{
+      sched_yield();
+    }
+  }
+  __atomic_fetch_add(&ui64Sum, ui64LocalSum, __ATOMIC_RELAXED);
+  return NULL;
+}
+
+/*!
+  Runs the producers and consumers and returns the elapsed time in seconds.
+*/
+static double runThreads(uint32_t ui32Threads){
+  pthread_t ptThreads[2 * MAX_AMOUNT_OF_THREADS];
+  struct timespec tsStart, tsEnd;
+  uint32_t ui32Counter = 0;
+  ui32AmountOfThreads = ui32Threads;
+  ui32AmountOfPoppedData = 0;
+  ui64Sum = 0;
+  clock_gettime(CLOCK_MONOTONIC, &tsStart);
+  for (ui32Counter = 0 ; ui32Counter < ui32Threads ; ui32Counter++){
+    pthread_create(&ptThreads[2 * ui32Counter], NULL, consumerThread, NULL);
+    pthread_create(&ptThreads[2 * ui32Counter + 1], NULL, producerThread, (void*) (uintptr_t) ui32Counter);
+  }
+  for (ui32Counter = 0 ; ui32Counter < 2 * ui32Threads ; ui32Counter++){
+    pthread_join(ptThreads[ui32Counter], NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &tsEnd);
+  return (tsEnd.tv_sec - tsStart.tv_sec) + (tsEnd.tv_nsec - tsStart.tv_nsec) / 1000000000.0;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  const uint64_t ui64ExpectedSum = (uint64_t) AMOUNT_OF_DATA * (AMOUNT_OF_DATA - 1) / 2;
+  uint32_t ui32AmountOfErrors = 0;
+  uint32_t ui32Threads = 0;
+
+  printf("Producers/consumers     MPMC (million/s)  Mutex queue (million/s)\n");
+  for (ui32Threads = 1 ; ui32Threads <= MAX_AMOUNT_OF_THREADS ; ui32Threads = ui32Threads * 2){
+    bUseMutex = false;
+    double dMPMCSeconds = runThreads(ui32Threads);
+    if (ui64Sum != ui64ExpectedSum || Buffer_getAmountOfPendingData(bfMPMC) != 0){
+      ui32AmountOfErrors++;
+    }
+    bUseMutex = true;
+    double dQueueSeconds = runThreads(ui32Threads);
+    if (ui64Sum != ui64ExpectedSum){
+      ui32AmountOfErrors++;
+    }
+    printf("%8u %8u %16.2f %24.2f\n", (unsigned int) ui32Threads, (unsigned int) ui32Threads, AMOUNT_OF_DATA / dMPMCSeconds / 1000000.0, AMOUNT_OF_DATA / dQueueSeconds / 1000000.0);
+  }
+
+  printf("Runs with lost or duplicated data: %u\n", (unsigned int) ui32AmountOfErrors);
+  return (ui32AmountOfErrors == 0) ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+//! Example 06 - Wide buffer benchmark
+/*!
+  This simply example fills and drains wide buffers of 16M elements, with a
+  power of two size (mask indexing) and with another size (compare and
+  wrap), and compares them with a 255 elements queue buffer. It also checks
+  the order of the data and the discarding of the oldest data.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define POWER_OF_TWO_SIZE 16777216
+#define OTHER_SIZE 16777213
+#define QUEUE_SIZE 255
+#define AMOUNT_OF_ROUNDS 4
+
+/*!
+  Buffers.
+*/
+newStaticWideBuffer(wbPowerOfTwo, uint32_t, POWER_OF_TWO_SIZE);
+newStaticWideBuffer(wbOther, uint32_t, OTHER_SIZE);
+newStaticBuffer(bfQueue, BUFFER_TYPE_QUEUE, uint32_t, QUEUE_SIZE);
+static uint32_t ui32AmountOfErrors = 0;
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return tsTime.tv_sec + tsTime.tv_nsec / 1000000000.0;
+}
+
+/*!
+  Fills and drains a wide buffer some times and returns the nanoseconds per push and pop.
+*/
+static double benchmarkWideBuffer(widebuffer_t wbBuffer){
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  double dStart = getTime();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < wbBuffer->ui32BufferSize ; ui32Counter++){
+      WideBuffer_push(wbBuffer, &ui32Counter);
+    }
+    for (ui32Counter = 0 ; ui32Counter < wbBuffer->ui32BufferSize ; ui32Counter++){
+      if (WideBuffer_pop(wbBuffer, uint32_t) != ui32Counter){
+        ui32AmountOfErrors++;
+      }
+    }
+  }
+  return (getTime() - dStart) * 1000000000.0 / ((double) AMOUNT_OF_ROUNDS * wbBuffer->ui32BufferSize);
+}
+
+/*!
+  Same work on the queue buffer.
+*/
+static double benchmarkQueue(void){
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  uint32_t ui32AmountOfFills = POWER_OF_TWO_SIZE / QUEUE_SIZE;
+  double dStart = getTime();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS * ui32AmountOfFills ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < QUEUE_SIZE ; ui32Counter++){
+      Buffer_push(bfQueue, &ui32Counter);
+    }
+    for (ui32Counter = 0 ; ui32Counter < QUEUE_SIZE ; ui32Counter++){
+      if (Buffer_pop(bfQueue, uint32_t) != ui32Counter){
+        ui32AmountOfErrors++;
+      }
+    }
+  }
+  return (getTime() - dStart) * 1000000000.0 / ((double) AMOUNT_OF_ROUNDS * ui32AmountOfFills * QUEUE_SIZE);
+}
+
+/*!
+  Pushes more data than the size: only the newest data must be kept.
+*/
+static void checkOverwrite(widebuffer_t wbBuffer){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Data = 0;
+  WideBuffer_clear(wbBuffer);
+  for (ui32Counter = 0 ; ui32Counter < wbBuffer->ui32BufferSize + 1000 ; ui32Counter++){
+    WideBuffer_push(wbBuffer, &ui32Counter);
+  }
+  if (WideBuffer_getAmountOfPendingData(wbBuffer) != wbBuffer->ui32BufferSize){
+    ui32AmountOfErrors++;
+  }
+  for (ui32Counter = 1000 ; WideBuffer_tryPop(wbBuffer, &ui32Data) == true ; ui32Counter++){
+    if (ui32Data != ui32Counter){
+      ui32AmountOfErrors++;
+    }
+  }
+  if (ui32Counter != wbBuffer->ui32BufferSize + 1000){
+    ui32AmountOfErrors++;
+  }
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  benchmarkWideBuffer(wbPowerOfTwo);                                                                                    /*!< Warm up: the first round maps the pages of the buffers. */
+  benchmarkWideBuffer(wbOther);
+  printf("Wide buffer, %u elements:  %6.2f ns per push and pop\n", (unsigned int) POWER_OF_TWO_SIZE, benchmarkWideBuffer(wbPowerOfTwo));
+  printf("Wide buffer, %u elements:  %6.2f ns per push and pop\n", (unsigned int) OTHER_SIZE, benchmarkWideBuffer(wbOther));
+  printf("Queue buffer, %u elements:      %6.2f ns per push and pop\n", (unsigned int) QUEUE_SIZE, benchmarkQueue());
+
+  checkOverwrite(wbPowerOfTwo);
+  checkOverwrite(wbOther);
+  printf("Errors: %u\n", (unsigned int) ui32AmountOfErrors);
+  return (ui32AmountOfErrors == 0) ? 0 : 1;
+}
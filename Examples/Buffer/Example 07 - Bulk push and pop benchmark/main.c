@@ -0,0 +1,121 @@
+//! Example 07 - Bulk push and pop benchmark
+/*!
+  This simply example fills and drains queue buffers of 1 byte and 16 bytes
+  elements one element at a time (Buffer_push and Buffer_pop) and with
+  Buffer_pushN and Buffer_popN, and compares the throughput.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 255
+#define BLOCK_SIZE 200
+#define AMOUNT_OF_ROUNDS 200000
+
+/*!
+  Element of 16 bytes.
+*/
+typedef struct {
+  uint32_t ui32Values[4];
+} element_t;
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return tsTime.tv_sec + tsTime.tv_nsec / 1000000000.0;
+}
+
+/*!
+  Pushes and pops blocks of data one element at a time or with the bulk functions, and returns the million elements per second.
+*/
+static double benchmark(buffer_t bfBuffer, uint8_t* ui8pSource, uint8_t* ui8pDestination, bool bBulk){
+  const uint8_t ui8ElementSize = bfBuffer->ui8ElementSize;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  double dStart = getTime();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    if (bBulk == true){
+      Buffer_pushN(bfBuffer, ui8pSource, BLOCK_SIZE);
+      Buffer_popN(bfBuffer, ui8pDestination, BLOCK_SIZE);
+    }
+    else{
+      for (ui32Counter = 0 ; ui32Counter < BLOCK_SIZE ; ui32Counter++){
+        Buffer_push(bfBuffer, ui8pSource + ui32Counter * ui8ElementSize);
+      }
+      for (ui32Counter = 0 ; ui32Counter < BLOCK_SIZE ; ui32Counter++){
+        memcpy(ui8pDestination + ui32Counter * ui8ElementSize, (Buffer_popAddress)(bfBuffer), ui8ElementSize);
+      }
+    }
+  }
+  return (double) AMOUNT_OF_ROUNDS * BLOCK_SIZE / (getTime() - dStart) / 1000000.0;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  newBuffer(bfBytes, BUFFER_TYPE_QUEUE, uint8_t, BUFFER_SIZE);
+  newBuffer(bfElements, BUFFER_TYPE_QUEUE, element_t, BUFFER_SIZE);
+  static uint8_t ui8Source[BLOCK_SIZE * sizeof(element_t)];
+  static uint8_t ui8Destination[BLOCK_SIZE * sizeof(element_t)];
+  uint32_t ui32Counter = 0;
+  for (ui32Counter = 0 ; ui32Counter < sizeof(ui8Source) ; ui32Counter++){
+    ui8Source[ui32Counter] = (uint8_t) (ui32Counter * 7);
+  }
+
+  printf("Element size   Buffer_push/pop (million/s)   Buffer_pushN/popN (million/s)\n");
+  double dSingle = benchmark(bfBytes, ui8Source, ui8Destination, false);
+  double dBulk = benchmark(bfBytes, ui8Source, ui8Destination, true);
+  printf("%12u %29.2f %31.2f\n", (unsigned int) sizeof(uint8_t), dSingle, dBulk);
+  bool bBytesOk = (memcmp(ui8Source, ui8Destination, BLOCK_SIZE) == 0);
+
+  dSingle = benchmark(bfElements, ui8Source, ui8Destination, false);
+  dBulk = benchmark(bfElements, ui8Source, ui8Destination, true);
+  printf("%12u %29.2f %31.2f\n", (unsigned int) sizeof(element_t), dSingle, dBulk);
+  bool bElementsOk = (memcmp(ui8Source, ui8Destination, sizeof(ui8Source)) == 0);
+
+  if (bBytesOk == false || bElementsOk == false){
+    printf("ERROR: The data read is different of the data written!\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,197 @@
+//! Example 08 - Zero-copy reserve and peek
+/*!
+  This simply example moves records from a producer thread to a consumer
+  thread with a BUFFER_TYPE_SPSC buffer. The producer builds the records
+  straight on the buffer slots (Buffer_reserve and Buffer_commit) and the
+  consumer reads them in place (Buffer_peek and Buffer_consume). The same
+  work is done with local records copied by Buffer_tryPush and
+  Buffer_tryPop.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 128
+#define BATCH_SIZE 32
+#define AMOUNT_OF_RECORDS 4000000
+
+/*!
+  Record.
+*/
+typedef struct {
+  uint32_t ui32Sequence;
+  uint32_t ui32Values[7];
+} record_t;
+
+newStaticSPSCBuffer(bfRecords, record_t, BUFFER_SIZE);
+static uint64_t ui64Checksum = 0;
+
+/*!
+  Builds a record.
+*/
+static inline void buildRecord(record_t* rpRecord, uint32_t ui32Sequence){
+  uint32_t ui32Counter = 0;
+  rpRecord->ui32Sequence = ui32Sequence;
+  for (ui32Counter = 0 ; ui32Counter < 7 ; ui32Counter++){
+    rpRecord->ui32Values[ui32Counter] = ui32Sequence * (ui32Counter + 1);
+  }
+}
+
+/*!
+  Parses a record.
+*/
+static inline uint64_t parseRecord(const record_t* rpRecord){
+  return rpRecord->ui32Sequence + rpRecord->ui32Values[6];
+}
+
+/*!
+  Zero-copy producer and consumer.
+*/
+static void* reserveProducer(void* vpArgument){
+  uint32_t ui32Sequence = 0;
+  (void) vpArgument;
+  while (ui32Sequence < AMOUNT_OF_RECORDS){
+    uint8_t ui8Amount = BATCH_SIZE;
+    record_t* rpRecords = (record_t*) Buffer_reserve(bfRecords, &ui8Amount);
+    if (rpRecords == NULL){
+      sched_yield();
+      continue;
+    }
+    if (ui8Amount > AMOUNT_OF_RECORDS - ui32Sequence){
+      ui8Amount = (uint8_t) (AMOUNT_OF_RECORDS - ui32Sequence);
+    }
+    uint8_t ui8Counter = 0;
+    for (ui8Counter = 0 ; ui8Counter < ui8Amount ; ui8Counter++){
+      buildRecord(&rpRecords[ui8Counter], ui32Sequence++);
+    }
+    Buffer_commit(bfRecords, ui8Amount);
+  }
+  return NULL;
+}
+
+static void* peekConsumer(void* vpArgument){
+  uint32_t ui32AmountOfRecords = 0;
+  uint64_t ui64Sum = 0;
+  (void) vpArgument;
+  while (ui32AmountOfRecords < AMOUNT_OF_RECORDS){
+    uint8_t ui8Amount = 0;
+    const record_t* rpRecords = (const record_t*) Buffer_peek(bfRecords, &ui8Amount);
+    if (rpRecords == NULL){
+      sched_yield();
+      continue;
+    }
+    uint8_t ui8Counter = 0;
+    for (ui8Counter = 0 ; ui8Counter < ui8Amount ; ui8Counter++){
+      ui64Sum = ui64Sum + parseRecord(&rpRecords[ui8Counter]);
+    }
+    Buffer_consume(bfRecords, ui8Amount);
+    ui32AmountOfRecords = ui32AmountOfRecords + ui8Amount;
+  }
+  ui64Checksum = ui64Sum;
+  return NULL;
+}
+
+/*!
+  Copying producer and consumer.
+*/
+static void* copyProducer(void* vpArgument){
+  uint32_t ui32Sequence = 0;
+  record_t rRecord;
+  (void) vpArgument;
+  for (ui32Sequence = 0 ; ui32Sequence < AMOUNT_OF_RECORDS ; ui32Sequence++){
+    buildRecord(&rRecord, ui32Sequence);
+    while (Buffer_tryPush(bfRecords, &rRecord) == false){
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void* copyConsumer(void* vpArgument){
+  uint32_t ui32AmountOfRecords = 0;
+  uint64_t ui64Sum = 0;
+  record_t rRecord;
+  (void) vpArgument;
+  for (ui32AmountOfRecords = 0 ; ui32AmountOfRecords < AMOUNT_OF_RECORDS ; ui32AmountOfRecords++){
+    while (Buffer_tryPop(bfRecords, &rRecord) == false){
+      sched_yield();
+    }
+    ui64Sum = ui64Sum + parseRecord(&rRecord);
+  }
+  ui64Checksum = ui64Sum;
+  return NULL;
+}
+
+/*!
+  Runs a producer and a consumer and returns the million records per second.
+*/
+static double run(void* (*vpfProducer)(void*), void* (*vpfConsumer)(void*)){
+  pthread_t ptProducer, ptConsumer;
+  struct timespec tsStart, tsEnd;
+  clock_gettime(CLOCK_MONOTONIC, &tsStart);
+  pthread_create(&ptConsumer, NULL, vpfConsumer, NULL);
+  pthread_create(&ptProducer, NULL, vpfProducer, NULL);
+  pthread_join(ptProducer, NULL);
+  pthread_join(ptConsumer, NULL);
+  clock_gettime(CLOCK_MONOTONIC, &tsEnd);
+  return AMOUNT_OF_RECORDS / ((tsEnd.tv_sec - tsStart.tv_sec) + (tsEnd.tv_nsec - tsStart.tv_nsec) / 1000000000.0) / 1000000.0;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  const uint64_t ui64Expected = (uint64_t) 8 * AMOUNT_OF_RECORDS * (AMOUNT_OF_RECORDS - 1) / 2;
+  double dZeroCopy = run(reserveProducer, peekConsumer);
+  bool bZeroCopyOk = (ui64Checksum == ui64Expected);
+  double dCopy = run(copyProducer, copyConsumer);
+  bool bCopyOk = (ui64Checksum == ui64Expected);
+
+  printf("Reserve/commit and peek/consume: %8.2f million records/s\n", dZeroCopy);
+  printf("Buffer_tryPush and Buffer_tryPop: %7.2f million records/s\n", dCopy);
+  if (bZeroCopyOk == false || bCopyOk == false){
+    printf("ERROR: Wrong checksum!\n");
+    return 1;
+  }
+  return 0;
+}
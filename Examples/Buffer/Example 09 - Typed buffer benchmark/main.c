@@ -0,0 +1,172 @@
+//! Example 09 - Typed buffer benchmark
+/*!
+  This simply example creates typed buffer functions with declareTypedBuffer
+  and compares them with the generic Buffer_push and Buffer_popAddress on
+  the same queue and stack buffers, for 4 bytes and 12 bytes elements.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 200
+#define AMOUNT_OF_ROUNDS 100000
+
+/*!
+  Element of 12 bytes.
+*/
+typedef struct {
+  int32_t i32X;
+  int32_t i32Y;
+  int32_t i32Z;
+} point_t;
+
+/*!
+  Typed functions: QueueU32_push, QueueU32_pop, QueueU32_popAddress...
+*/
+declareTypedBuffer(QueueU32, BUFFER_TYPE_QUEUE, uint32_t)
+declareTypedBuffer(StackU32, BUFFER_TYPE_STACK, uint32_t)
+declareTypedBuffer(QueuePoint, BUFFER_TYPE_QUEUE, point_t)
+
+newStaticBuffer(bfQueueU32, BUFFER_TYPE_QUEUE, uint32_t, BUFFER_SIZE);
+newStaticBuffer(bfStackU32, BUFFER_TYPE_STACK, uint32_t, BUFFER_SIZE);
+newStaticBuffer(bfQueuePoint, BUFFER_TYPE_QUEUE, point_t, BUFFER_SIZE);
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return tsTime.tv_sec + tsTime.tv_nsec / 1000000000.0;
+}
+
+/*!
+  Generic and typed benchmarks. Each round fills and drains the buffer, and the sums check the data.
+*/
+static uint64_t genericU32(buffer_t bfBuffer){
+  uint64_t ui64Sum = 0;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      uint32_t ui32Data = ui32Round + ui32Counter;
+      Buffer_push(bfBuffer, &ui32Data);
+    }
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      ui64Sum = ui64Sum + Buffer_pop(bfBuffer, uint32_t);
+    }
+  }
+  return ui64Sum;
+}
+
+#define TYPED_U32_BENCHMARK(tbName)\
+  static uint64_t typed##tbName(buffer_t bfBuffer){\
+    uint64_t ui64Sum = 0;\
+    uint32_t ui32Round = 0;\
+    uint32_t ui32Counter = 0;\
+    for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){\
+      for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){\
+        tbName##_push(bfBuffer, ui32Round + ui32Counter);\
+      }\
+      for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){\
+        ui64Sum = ui64Sum + *tbName##_popAddress(bfBuffer);\
+      }\
+    }\
+    return ui64Sum;\
+  }
+
+TYPED_U32_BENCHMARK(QueueU32)
+TYPED_U32_BENCHMARK(StackU32)
+
+static uint64_t genericPoint(buffer_t bfBuffer){
+  uint64_t ui64Sum = 0;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      point_t pPoint = {(int32_t) ui32Counter, (int32_t) ui32Round, 1};
+      Buffer_push(bfBuffer, &pPoint);
+    }
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      point_t* ppPoint = Buffer_popAddress(bfBuffer, point_t);
+      ui64Sum = ui64Sum + ppPoint->i32X + ppPoint->i32Y + ppPoint->i32Z;
+    }
+  }
+  return ui64Sum;
+}
+
+static uint64_t typedPoint(buffer_t bfBuffer){
+  uint64_t ui64Sum = 0;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  point_t pPoint;
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      QueuePoint_push(bfBuffer, (point_t) {(int32_t) ui32Counter, (int32_t) ui32Round, 1});
+    }
+    while (QueuePoint_pop(bfBuffer, &pPoint) == true){
+      ui64Sum = ui64Sum + pPoint.i32X + pPoint.i32Y + pPoint.i32Z;
+    }
+  }
+  return ui64Sum;
+}
+
+/*!
+  Runs a benchmark and prints the million push and pop per second.
+*/
+static uint64_t run(const char* cpName, uint64_t (*ui64pfBenchmark)(buffer_t), buffer_t bfBuffer){
+  double dStart = getTime();
+  uint64_t ui64Sum = ui64pfBenchmark(bfBuffer);
+  printf("%-24s %8.2f million/s\n", cpName, (double) AMOUNT_OF_ROUNDS * BUFFER_SIZE / (getTime() - dStart) / 1000000.0);
+  return ui64Sum;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32AmountOfErrors = 0;
+  ui32AmountOfErrors += (run("Generic uint32_t queue", genericU32, bfQueueU32) != run("Typed uint32_t queue", typedQueueU32, bfQueueU32));
+  ui32AmountOfErrors += (run("Generic uint32_t stack", genericU32, bfStackU32) != run("Typed uint32_t stack", typedStackU32, bfStackU32));
+  ui32AmountOfErrors += (run("Generic point_t queue", genericPoint, bfQueuePoint) != run("Typed point_t queue", typedPoint, bfQueuePoint));
+  if (ui32AmountOfErrors != 0){
+    printf("ERROR: The typed functions read different data!\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,121 @@
+//! Example 10 - C++ typed buffer
+/*!
+  This simply example uses the C++ Buffer<T, N, Type> template, checks that
+  the C functions work on it through its handler, and compares its push and
+  pop with the generic C functions. It needs C++14.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+#include <Buffer.hpp>
+
+/*!
+  Example parameters.
+*/
+#define BUFFER_SIZE 200
+#define AMOUNT_OF_ROUNDS 100000
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return tsTime.tv_sec + tsTime.tv_nsec / 1000000000.0;
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  static MemoryManager::Buffer<uint32_t, BUFFER_SIZE> bQueue;
+  static MemoryManager::Buffer<uint16_t, 5, BUFFER_TYPE_STACK> bStack;
+  uint32_t ui32Round = 0;
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Data = 0;
+  uint64_t ui64TypedSum = 0;
+  uint64_t ui64GenericSum = 0;
+
+  /*!
+    Stack: the template and the C functions share the same state...
+  */
+  for (ui32Counter = 0 ; ui32Counter < 8 ; ui32Counter++){
+    bStack.push((uint16_t) ui32Counter);
+  }
+  printf("Stack with %u data (C: %u):", (unsigned int) bStack.getAmountOfPendingData(), (unsigned int) Buffer_getAmountOfPendingData(bStack.getHandler()));
+  uint16_t ui16Data = 0;
+  while (bStack.pop(ui16Data) == true){
+    printf(" %u", (unsigned int) ui16Data);
+  }
+  printf("\n");
+
+  /*!
+    Template queue...
+  */
+  double dStart = getTime();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      bQueue.push(ui32Round + ui32Counter);
+    }
+    while (bQueue.pop(ui32Data) == true){
+      ui64TypedSum = ui64TypedSum + ui32Data;
+    }
+  }
+  double dTyped = getTime() - dStart;
+
+  /*!
+    Generic C functions on the same buffer...
+  */
+  buffer_t bfQueue = bQueue.getHandler();
+  dStart = getTime();
+  for (ui32Round = 0 ; ui32Round < AMOUNT_OF_ROUNDS ; ui32Round++){
+    for (ui32Counter = 0 ; ui32Counter < BUFFER_SIZE ; ui32Counter++){
+      ui32Data = ui32Round + ui32Counter;
+      Buffer_push(bfQueue, &ui32Data);
+    }
+    while (Buffer_tryPop(bfQueue, &ui32Data) == true){
+      ui64GenericSum = ui64GenericSum + ui32Data;
+    }
+  }
+  double dGeneric = getTime() - dStart;
+
+  printf("Buffer<uint32_t, %u>:  %8.2f million/s\n", (unsigned int) BUFFER_SIZE, (double) AMOUNT_OF_ROUNDS * BUFFER_SIZE / dTyped / 1000000.0);
+  printf("Generic C functions:   %8.2f million/s\n", (double) AMOUNT_OF_ROUNDS * BUFFER_SIZE / dGeneric / 1000000.0);
+  if (ui64TypedSum != ui64GenericSum){
+    printf("ERROR: The template read different data!\n");
+    return 1;
+  }
+  return 0;
+}
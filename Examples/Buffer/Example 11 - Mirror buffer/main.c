@@ -0,0 +1,198 @@
+//! Example 11 - Mirror buffer
+/*!
+  This simply example streams variable length records (a 16-bits length
+  followed by the payload) through a mirror buffer. Because the buffer
+  memory is mapped twice, back-to-back, the parser reads every record in
+  place, even the ones that wrap around the end of the ring, and the pending
+  bytes are handed to write() with a single system call. The same stream is
+  parsed from a byte BUFFER_TYPE_QUEUE buffer, where each record is copied
+  out byte by byte, to compare. Linux only.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <MemoryManager.h>
+
+#define AMOUNT_OF_RECORDS 200000
+#define MAXIMUM_PAYLOAD 1000
+
+newMirrorBuffer(mbStream);
+newBuffer(bfStream, BUFFER_TYPE_QUEUE, uint8_t, 255);
+
+static double getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return (double) tsTime.tv_sec + (double) tsTime.tv_nsec / 1e9;
+}
+
+static uint16_t getLength(uint32_t ui32Record){
+  return (uint16_t) (1 + (ui32Record * 2654435761U) % MAXIMUM_PAYLOAD);
+}
+
+static uint8_t getByte(uint32_t ui32Record, uint16_t ui16Index){
+  return (uint8_t) (ui32Record + ui16Index * 7U);
+}
+
+static void buildRecord(uint8_t* ui8pRecord, uint32_t ui32Record){
+  uint16_t ui16Length = getLength(ui32Record);
+  memcpy(ui8pRecord, &ui16Length, sizeof(uint16_t));
+  for (uint16_t ui16Index = 0; ui16Index < ui16Length; ui16Index++){
+    ui8pRecord[sizeof(uint16_t) + ui16Index] = getByte(ui32Record, ui16Index);
+  }
+}
+
+static uint32_t checkPayload(const uint8_t* ui8pPayload, uint16_t ui16Length, uint32_t ui32Record){
+  uint32_t ui32Sum = 0;
+  for (uint16_t ui16Index = 0; ui16Index < ui16Length; ui16Index++){
+    if (ui8pPayload[ui16Index] != getByte(ui32Record, ui16Index)){
+      printf("Record %u is corrupted\n", ui32Record);
+      exit(1);
+    }
+    ui32Sum += ui8pPayload[ui16Index];
+  }
+  return ui32Sum;
+}
+
+static uint32_t parseMirror(uint32_t* ui32pWrapped){
+  uint32_t ui32Produced = 0, ui32Consumed = 0, ui32Sum = 0;
+  *ui32pWrapped = 0;
+  while (ui32Consumed < AMOUNT_OF_RECORDS){
+    while (ui32Produced < AMOUNT_OF_RECORDS){
+      uint32_t ui32Length = sizeof(uint16_t) + getLength(ui32Produced);
+      uint32_t ui32Reserved = ui32Length;
+      uint8_t* ui8pBlock = (uint8_t*) MirrorBuffer_reserve(mbStream, &ui32Reserved);
+      if (ui32Reserved < ui32Length){
+        break;
+      }
+      buildRecord(ui8pBlock, ui32Produced++);
+      MirrorBuffer_commit(mbStream, ui32Length);
+    }
+    uint32_t ui32Pending = 0;
+    uint8_t* ui8pBlock = (uint8_t*) MirrorBuffer_peek(mbStream, &ui32Pending);
+    uint32_t ui32Offset = 0;
+    while (ui32Pending - ui32Offset >= sizeof(uint16_t)){
+      uint16_t ui16Length;
+      memcpy(&ui16Length, ui8pBlock + ui32Offset, sizeof(uint16_t));
+      if (ui32Pending - ui32Offset < sizeof(uint16_t) + ui16Length){
+        break;
+      }
+      uint32_t ui32Start = (uint32_t) ((ui8pBlock + ui32Offset - mbStream->ui8pData) % MirrorBuffer_getSize(mbStream));
+      if (ui32Start + sizeof(uint16_t) + ui16Length > MirrorBuffer_getSize(mbStream)){
+        (*ui32pWrapped)++;
+      }
+      ui32Sum += checkPayload(ui8pBlock + ui32Offset + sizeof(uint16_t), ui16Length, ui32Consumed++);
+      ui32Offset += sizeof(uint16_t) + ui16Length;
+    }
+    MirrorBuffer_consume(mbStream, ui32Offset);
+  }
+  return ui32Sum;
+}
+
+static uint32_t parseQueue(void){
+  uint8_t ui8aRecord[sizeof(uint16_t) + MAXIMUM_PAYLOAD];
+  uint8_t ui8aPayload[MAXIMUM_PAYLOAD];
+  uint32_t ui32Produced = 0, ui32Consumed = 0, ui32Sum = 0;
+  uint32_t ui32ProducedBytes = 0, ui32Length = 0;
+  uint16_t ui16Length = 0;
+  uint32_t ui32Received = 0;
+  buildRecord(ui8aRecord, 0);
+  ui32Length = sizeof(uint16_t) + getLength(0);
+  while (ui32Consumed < AMOUNT_OF_RECORDS){
+    while (ui32Produced < AMOUNT_OF_RECORDS && Buffer_getAmountOfPendingData(bfStream) < 255){
+      Buffer_push(bfStream, &ui8aRecord[ui32ProducedBytes++]);
+      if (ui32ProducedBytes == ui32Length && ++ui32Produced < AMOUNT_OF_RECORDS){
+        buildRecord(ui8aRecord, ui32Produced);
+        ui32Length = sizeof(uint16_t) + getLength(ui32Produced);
+        ui32ProducedBytes = 0;
+      }
+    }
+    while (Buffer_getAmountOfPendingData(bfStream) > 0){
+      uint8_t ui8Byte = Buffer_pop(bfStream, uint8_t);
+      if (ui32Received < sizeof(uint16_t)){
+        ((uint8_t*) &ui16Length)[ui32Received++] = ui8Byte;
+        continue;
+      }
+      ui8aPayload[ui32Received++ - sizeof(uint16_t)] = ui8Byte;
+      if (ui32Received == sizeof(uint16_t) + ui16Length){
+        ui32Sum += checkPayload(ui8aPayload, ui16Length, ui32Consumed++);
+        ui32Received = 0;
+      }
+    }
+  }
+  return ui32Sum;
+}
+
+int main(void){
+  if (!MirrorBuffer_create(mbStream, 4096)){
+    printf("The mirror buffer could not be mapped\n");
+    return 1;
+  }
+  printf("Mirror buffer of %u bytes mapped at %p and %p\n", MirrorBuffer_getSize(mbStream), (void*) mbStream->ui8pData, (void*) (mbStream->ui8pData + MirrorBuffer_getSize(mbStream)));
+
+  uint32_t ui32Wrapped = 0;
+  double dStart = getTime();
+  uint32_t ui32MirrorSum = parseMirror(&ui32Wrapped);
+  double dMirror = getTime() - dStart;
+  dStart = getTime();
+  uint32_t ui32QueueSum = parseQueue();
+  double dQueue = getTime() - dStart;
+  printf("%u records parsed in place, %u of them wrapped around the end of the ring\n", AMOUNT_OF_RECORDS, ui32Wrapped);
+  printf("Mirror buffer: %.1f ms, checksum %u\n", dMirror * 1e3, ui32MirrorSum);
+  printf("Byte queue:    %.1f ms, checksum %u\n", dQueue * 1e3, ui32QueueSum);
+  if (ui32MirrorSum != ui32QueueSum || ui32Wrapped == 0){
+    return 1;
+  }
+
+  int iFile = open("/dev/null", O_WRONLY);
+  if (iFile >= 0){
+    uint32_t ui32Pending = MirrorBuffer_getSize(mbStream);
+    void* vpBlock = MirrorBuffer_reserve(mbStream, &ui32Pending);
+    memset(vpBlock, 'x', ui32Pending);
+    MirrorBuffer_commit(mbStream, ui32Pending);
+    vpBlock = MirrorBuffer_peek(mbStream, &ui32Pending);
+    ssize_t sWritten = write(iFile, vpBlock, ui32Pending);
+    printf("%zd bytes written with one write(), starting at offset %u of the ring\n", sWritten, (unsigned) ((uint8_t*) vpBlock - mbStream->ui8pData));
+    MirrorBuffer_consume(mbStream, (uint32_t) (sWritten > 0 ? sWritten : 0));
+    close(iFile);
+  }
+
+  MirrorBuffer_destroy(mbStream);
+  return 0;
+}
@@ -0,0 +1,143 @@
+//! Example 12 - Blocking buffer
+/*!
+  This simply example compares three ways of waiting for data on a
+  BUFFER_TYPE_SPSC buffer. A producer thread sends its clock to a consumer
+  thread at a fixed interval; the consumer measures the wakeup latency
+  (receive time minus send time) and its own CPU time. The consumer waits
+  with Buffer_popWait (adaptive spinning and a futex), with a busy loop of
+  Buffer_tryPop and with a Buffer_tryPop loop that sleeps between polls.
+  Linux only.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <MemoryManager.h>
+
+#define AMOUNT_OF_MESSAGES 2000
+#define SEND_INTERVAL_US 500
+#define POLL_INTERVAL_US 100
+
+typedef enum {
+  WAIT_FUTEX = 0,
+  WAIT_BUSY_POLLING,
+  WAIT_SLEEP_POLLING
+} wait_t;
+
+newSPSCBuffer(bfMessages, uint64_t, 16);
+
+static wait_t wtWait;
+static double dLatencySum, dLatencyMaximum, dConsumerTime;
+
+static uint64_t getTime(clockid_t ciClock){
+  struct timespec tsTime;
+  clock_gettime(ciClock, &tsTime);
+  return (uint64_t) tsTime.tv_sec * 1000000000ULL + (uint64_t) tsTime.tv_nsec;
+}
+
+static void sleepMicroseconds(uint32_t ui32Time){
+  struct timespec tsTime = {0, (long) ui32Time * 1000L};
+  nanosleep(&tsTime, NULL);
+}
+
+static void* producer(void* vpArgument){
+  for (uint32_t ui32Counter = 0; ui32Counter < AMOUNT_OF_MESSAGES; ui32Counter++){
+    sleepMicroseconds(SEND_INTERVAL_US);
+    uint64_t ui64Time = getTime(CLOCK_MONOTONIC);
+    Buffer_pushWait(bfMessages, &ui64Time, BUFFER_WAIT_FOREVER);
+  }
+  return vpArgument;
+}
+
+static void* consumer(void* vpArgument){
+  uint64_t ui64CpuStart = getTime(CLOCK_THREAD_CPUTIME_ID);
+  for (uint32_t ui32Counter = 0; ui32Counter < AMOUNT_OF_MESSAGES; ui32Counter++){
+    uint64_t ui64Time;
+    switch (wtWait){
+
+      case WAIT_FUTEX:
+        Buffer_popWait(bfMessages, &ui64Time, BUFFER_WAIT_FOREVER);
+        break;
+
+      case WAIT_BUSY_POLLING:
+        while (Buffer_tryPop(bfMessages, &ui64Time) == false){
+          sched_yield();
+        }
+        break;
+
+      case WAIT_SLEEP_POLLING:
+        while (Buffer_tryPop(bfMessages, &ui64Time) == false){
+          sleepMicroseconds(POLL_INTERVAL_US);
+        }
+        break;
+
+    }
+    double dLatency = (double) (getTime(CLOCK_MONOTONIC) - ui64Time) / 1e3;
+    dLatencySum += dLatency;
+    if (dLatency > dLatencyMaximum){
+      dLatencyMaximum = dLatency;
+    }
+  }
+  dConsumerTime = (double) (getTime(CLOCK_THREAD_CPUTIME_ID) - ui64CpuStart) / 1e6;
+  return vpArgument;
+}
+
+static void benchmark(wait_t wtMode, const char* cpName){
+  pthread_t ptProducer, ptConsumer;
+  wtWait = wtMode;
+  dLatencySum = 0;
+  dLatencyMaximum = 0;
+  Buffer_clear(bfMessages);
+  pthread_create(&ptConsumer, NULL, consumer, NULL);
+  pthread_create(&ptProducer, NULL, producer, NULL);
+  pthread_join(ptProducer, NULL);
+  pthread_join(ptConsumer, NULL);
+  printf("%-14s latency mean %8.1f us, max %8.1f us, consumer CPU %7.1f ms\n", cpName, dLatencySum / AMOUNT_OF_MESSAGES, dLatencyMaximum, dConsumerTime);
+}
+
+int main(void){
+  printf("%d messages, one every %d us\n", AMOUNT_OF_MESSAGES, SEND_INTERVAL_US);
+  benchmark(WAIT_FUTEX, "Buffer_popWait");
+  benchmark(WAIT_BUSY_POLLING, "Busy polling");
+  benchmark(WAIT_SLEEP_POLLING, "Sleep polling");
+
+  uint64_t ui64Time;
+  uint64_t ui64Start = getTime(CLOCK_MONOTONIC);
+  bool bReceived = Buffer_popWait(bfMessages, &ui64Time, 10000);
+  printf("Empty buffer: Buffer_popWait returned %s after %.1f ms\n", bReceived ? "true" : "false", (double) (getTime(CLOCK_MONOTONIC) - ui64Start) / 1e6);
+  return (bReceived == false) ? 0 : 1;
+}
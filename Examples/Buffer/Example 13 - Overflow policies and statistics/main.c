@@ -0,0 +1,116 @@
+//! Example 13 - Overflow policies and statistics
+/*!
+  This simply example feeds bursts of samples to a BUFFER_TYPE_QUEUE buffer
+  that is drained at a constant rate, once with each overflow policy, and
+  prints the statistics of the buffer: overruns (data dropped or rejected),
+  underruns (pops on an empty buffer) and the high-water mark. Then the same
+  traffic goes to a big buffer, and its high-water mark gives the size that
+  never overflows. Nobody else can free a slot of a queue buffer, so
+  BUFFER_OVERFLOW_BLOCK rejects like BUFFER_OVERFLOW_REJECT here.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_TICKS 10000
+#define SMALL_BUFFER_SIZE 16
+#define READS_PER_TICK 3
+
+newBuffer(bfSmall, BUFFER_TYPE_QUEUE, uint32_t, SMALL_BUFFER_SIZE);
+newBuffer(bfBig, BUFFER_TYPE_QUEUE, uint32_t, 255);
+
+static uint32_t getBurst(uint32_t ui32Tick){
+  uint32_t ui32Hash = ui32Tick * 2654435761U;
+  return ((ui32Hash >> 28) == 0) ? 12 + (ui32Hash >> 24) % 16 : (ui32Hash >> 30);
+}
+
+static uint32_t run(buffer_t bfBuffer, uint64_t* ui64pAge){
+  uint32_t ui32Data = 0;
+  uint32_t ui32Received = 0;
+  uint32_t ui32Count = 0;
+  *ui64pAge = 0;
+  for (uint32_t ui32Tick = 0 ; ui32Tick < AMOUNT_OF_TICKS ; ui32Tick++){
+    for (uint32_t ui32Counter = getBurst(ui32Tick) ; ui32Counter > 0 ; ui32Counter--){
+      ui32Data++;
+      Buffer_push(bfBuffer, &ui32Data);
+    }
+    for (uint32_t ui32Counter = 0 ; ui32Counter < READS_PER_TICK ; ui32Counter++){
+      if (Buffer_tryPop(bfBuffer, &ui32Received) == true){
+        *ui64pAge = *ui64pAge + ui32Data - ui32Received;
+        ui32Count++;
+      }
+    }
+  }
+  return ui32Count;
+}
+
+static void printStatistics(const char* cpName, buffer_t bfBuffer, uint32_t ui32Received, uint64_t ui64Age){
+  printf("%-12s received %6u (mean age %5.2f)  overruns %5u  underruns %5u  high-water mark %3u/%u\n", cpName, (unsigned int) ui32Received, (double) ui64Age / ui32Received, (unsigned int) Buffer_getOverruns(bfBuffer), (unsigned int) Buffer_getUnderruns(bfBuffer), (unsigned int) Buffer_getHighWaterMark(bfBuffer), (unsigned int) bfBuffer->ui8BufferSize);
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  const char* cpPolicies[] = {"Default", "Drop oldest", "Drop newest", "Reject", "Block"};
+  uint64_t ui64Age = 0;
+  uint32_t ui32Sent = 0;
+  for (uint32_t ui32Tick = 0 ; ui32Tick < AMOUNT_OF_TICKS ; ui32Tick++){
+    ui32Sent = ui32Sent + getBurst(ui32Tick);
+  }
+  printf("%u data sent in bursts, %u data read per tick\n", (unsigned int) ui32Sent, (unsigned int) READS_PER_TICK);
+
+  for (uint32_t ui32Policy = BUFFER_OVERFLOW_DEFAULT ; ui32Policy <= BUFFER_OVERFLOW_BLOCK ; ui32Policy++){
+    Buffer_clear(bfSmall);
+    Buffer_resetStatistics(bfSmall);
+    Buffer_setOverflowPolicy(bfSmall, (buffer_overflow_t) ui32Policy);
+    uint32_t ui32Received = run(bfSmall, &ui64Age);
+    printStatistics(cpPolicies[ui32Policy], bfSmall, ui32Received, ui64Age);
+    if (ui32Received + Buffer_getOverruns(bfSmall) + Buffer_getAmountOfPendingData(bfSmall) != ui32Sent){
+      printf("ERROR: Data missing from the statistics!\n");
+      return 1;
+    }
+  }
+
+  uint32_t ui32Received = run(bfBig, &ui64Age);
+  printStatistics("Big buffer", bfBig, ui32Received, ui64Age);
+  printf("A buffer of %u data would never overflow with this traffic.\n", (unsigned int) Buffer_getHighWaterMark(bfBig));
+  return (Buffer_getOverruns(bfBig) == 0) ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+//! Example 14 - Sliding window aggregates
+/*!
+  This simply example keeps the last 200 samples of a sensor on a
+  BUFFER_TYPE_CIRCULAR buffer and, after each new sample, gets the sum, the
+  mean, the minimum, the maximum and the variance of the window in three
+  ways: reading every sample with Buffer_pop, with the window reductions
+  (Buffer_getSum, Buffer_getMinimum...), that read the two segments of the
+  window straight on the buffer with AVX2 when the processor has it, and with
+  the running aggregates of a buffer window, updated in O(1) by
+  BufferWindow_push. It prints the time per sample of each way and checks
+  that they agree.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+#define WINDOW_SIZE 200
+#define AMOUNT_OF_SAMPLES 200000
+
+typedef struct {
+  double dSum;
+  double dMean;
+  double dMinimum;
+  double dMaximum;
+  double dVariance;
+} aggregates_t;
+
+static uint64_t getTime(void){
+  struct timespec tsTime;
+  clock_gettime(CLOCK_MONOTONIC, &tsTime);
+  return (uint64_t) tsTime.tv_sec * 1000000000ULL + (uint64_t) tsTime.tv_nsec;
+}
+
+static int16_t readSensor(uint32_t ui32Counter){
+  uint32_t ui32Noise = ui32Counter * 2654435761u;
+  return (int16_t) (1000.0 * sin(ui32Counter * 0.001) + (int32_t) ((ui32Noise >> 16) & 0xFF) - 128);
+}
+
+static void aggregateByPopping(buffer_t bfBuffer, aggregates_t* apAggregates){
+  uint8_t ui8AmountOfData = Buffer_getAmountOfPendingData(bfBuffer);
+  double dSum = 0, dSumOfSquares = 0, dMinimum = INFINITY, dMaximum = -INFINITY;
+  for (uint8_t ui8Counter = 0; ui8Counter < ui8AmountOfData; ui8Counter++){
+    double dData = Buffer_pop(bfBuffer, int16_t);
+    dSum += dData;
+    dSumOfSquares += dData * dData;
+    dMinimum = (dData < dMinimum) ? dData : dMinimum;
+    dMaximum = (dData > dMaximum) ? dData : dMaximum;
+  }
+  apAggregates->dSum = dSum;
+  apAggregates->dMean = dSum / ui8AmountOfData;
+  apAggregates->dMinimum = dMinimum;
+  apAggregates->dMaximum = dMaximum;
+  apAggregates->dVariance = dSumOfSquares / ui8AmountOfData - apAggregates->dMean * apAggregates->dMean;
+}
+
+static void aggregateByReductions(buffer_t bfBuffer, aggregates_t* apAggregates){
+  apAggregates->dSum = Buffer_getSum(bfBuffer, BUFFER_ELEMENT_INT16);
+  apAggregates->dMean = Buffer_getMean(bfBuffer, BUFFER_ELEMENT_INT16);
+  apAggregates->dMinimum = Buffer_getMinimum(bfBuffer, BUFFER_ELEMENT_INT16);
+  apAggregates->dMaximum = Buffer_getMaximum(bfBuffer, BUFFER_ELEMENT_INT16);
+  apAggregates->dVariance = Buffer_getVariance(bfBuffer, BUFFER_ELEMENT_INT16);
+}
+
+static void aggregateByWindow(bufferwindow_t bwWindow, aggregates_t* apAggregates){
+  apAggregates->dSum = BufferWindow_getSum(bwWindow);
+  apAggregates->dMean = BufferWindow_getMean(bwWindow);
+  apAggregates->dMinimum = BufferWindow_getMinimum(bwWindow);
+  apAggregates->dMaximum = BufferWindow_getMaximum(bwWindow);
+  apAggregates->dVariance = BufferWindow_getVariance(bwWindow);
+}
+
+static bool agree(const aggregates_t* apAggregatesA, const aggregates_t* apAggregatesB){
+  return apAggregatesA->dSum == apAggregatesB->dSum && apAggregatesA->dMinimum == apAggregatesB->dMinimum && apAggregatesA->dMaximum == apAggregatesB->dMaximum && fabs(apAggregatesA->dMean - apAggregatesB->dMean) < 1e-9 && fabs(apAggregatesA->dVariance - apAggregatesB->dVariance) < 1e-6 * (1 + apAggregatesA->dVariance);
+}
+
+typedef enum {
+  AGGREGATE_BY_POPPING = 0,
+  AGGREGATE_BY_REDUCTIONS,
+  AGGREGATE_BY_WINDOW,
+  AGGREGATE_CHECK
+} aggregate_t;
+
+static double run(aggregate_t agWay, uint32_t* ui32pMismatches){
+  newBuffer(bfSamples, BUFFER_TYPE_CIRCULAR, int16_t, WINDOW_SIZE);
+  newBufferWindow(bwSamples, bfSamples, BUFFER_ELEMENT_INT16, WINDOW_SIZE);
+  aggregates_t agPopping, agReductions, agWindow;
+  double dChecksum = 0;
+  for (uint32_t ui32Counter = 0; ui32Counter < AMOUNT_OF_SAMPLES; ui32Counter++){
+    int16_t i16Sample = readSensor(ui32Counter);
+    BufferWindow_push(bwSamples, &i16Sample);
+    switch (agWay){
+
+      case AGGREGATE_BY_POPPING:
+        aggregateByPopping(bfSamples, &agPopping);
+        dChecksum += agPopping.dMean + agPopping.dVariance;
+        break;
+
+      case AGGREGATE_BY_REDUCTIONS:
+        aggregateByReductions(bfSamples, &agReductions);
+        dChecksum += agReductions.dMean + agReductions.dVariance;
+        break;
+
+      case AGGREGATE_BY_WINDOW:
+        aggregateByWindow(bwSamples, &agWindow);
+        dChecksum += agWindow.dMean + agWindow.dVariance;
+        break;
+
+      case AGGREGATE_CHECK:
+        aggregateByPopping(bfSamples, &agPopping);
+        aggregateByReductions(bfSamples, &agReductions);
+        aggregateByWindow(bwSamples, &agWindow);
+        if (agree(&agPopping, &agReductions) == false || agree(&agReductions, &agWindow) == false){
+          (*ui32pMismatches)++;
+        }
+        break;
+
+    }
+  }
+  if (agWay == AGGREGATE_CHECK){
+    printf("Last window: mean %.2f, min %.0f, max %.0f, variance %.2f\n", agWindow.dMean, agWindow.dMinimum, agWindow.dMaximum, agWindow.dVariance);
+  }
+  return dChecksum;
+}
+
+static uint32_t checkLargeOffset(void){
+  newBuffer(bfOffsetSamples, BUFFER_TYPE_CIRCULAR, int32_t, 8);
+  newBufferWindow(bwOffsetSamples, bfOffsetSamples, BUFFER_ELEMENT_INT32, 8);
+  for (int32_t i32Sample = 1000000000; i32Sample < 1000000004; i32Sample++){
+    BufferWindow_push(bwOffsetSamples, &i32Sample);
+  }
+  double dMean = BufferWindow_getMean(bwOffsetSamples);
+  double dVariance = BufferWindow_getVariance(bwOffsetSamples);
+  printf("Samples 1000000000 to 1000000003: mean %.2f, variance %.2f (expected 1000000001.50 and 1.25)\n", dMean, dVariance);
+  return (dMean == 1000000001.5 && fabs(dVariance - 1.25) < 1e-9) ? 0 : 1;
+}
+
+static void benchmark(aggregate_t agWay, const char* cpName){
+  uint64_t ui64Best = UINT64_MAX;
+  double dChecksum = 0;
+  for (uint32_t ui32Run = 0; ui32Run < 5; ui32Run++){
+    uint64_t ui64Start = getTime();
+    dChecksum = run(agWay, NULL);
+    uint64_t ui64Time = getTime() - ui64Start;
+    ui64Best = (ui64Time < ui64Best) ? ui64Time : ui64Best;
+  }
+  printf("%-22s %8.1f ns/sample (checksum %.1f)\n", cpName, (double) ui64Best / AMOUNT_OF_SAMPLES, dChecksum);
+}
+
+int main(void){
+  uint32_t ui32Mismatches = 0;
+  printf("Window of %d samples, %d samples, push included\n", WINDOW_SIZE, AMOUNT_OF_SAMPLES);
+  benchmark(AGGREGATE_BY_POPPING, "Popping every sample:");
+  benchmark(AGGREGATE_BY_REDUCTIONS, "Window reductions:");
+  benchmark(AGGREGATE_BY_WINDOW, "Running aggregates:");
+  run(AGGREGATE_CHECK, &ui32Mismatches);
+  ui32Mismatches += checkLargeOffset();
+  printf("Mismatches: %u\n", ui32Mismatches);
+  return (ui32Mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+//! Example 04 - Multiple data banks
+/*!
+  This simply example demonstrates the use of data bank instances. Each
+  subsystem of your firmware can have its own data bank, with memory pools
+  registered at runtime from static arrays or from any other memory block.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <MemoryManager.h>
+
+/*!
+  Memory block of the runtime memory pool. It's aligned to 8 bytes, as MemoryPool_create needs.
+*/
+static uint64_t ui64pRuntimePoolMemory[MemoryPool_getRequiredMemory(sizeof(uint32_t), 40)/sizeof(uint64_t) + 1];
+
+/*!
+  Main function.
+*/
+int main(){
+  /*!
+    Creating a data bank for a subsystem with up to 4 memory pools...
+  */
+  newDataBank(dbSensorBank, 4);
+
+  /*!
+    Registering a memory pool declared with newMemoryPool...
+  */
+  newMemoryPool(mpSampleBytePool, sizeof(uint8_t), 64);
+  if (DataBank_registerPool(dbSensorBank, mpSampleBytePool) != DATA_BANK_STATUS_POOL_REGISTERED){     /*!< If the memory pool was not registered... */
+    printf("ERROR: Memory pool registration error!\n");                                                /*!< Print an error message and returns 1 for the operational system. */
+    return 1;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+
+  /*!
+    Registering a memory pool built at runtime. The size could come from a configuration file...
+  */
+  uint16_t ui16RuntimePoolSize = 40;
+  mpool_t mpRuntimePool = MemoryPool_create(ui64pRuntimePoolMemory, sizeof(uint32_t), ui16RuntimePoolSize);
+  if (DataBank_registerPool(dbSensorBank, mpRuntimePool) != DATA_BANK_STATUS_POOL_REGISTERED){        /*!< If the memory pool was not registered... */
+    printf("ERROR: Memory pool registration error!\n");                                                /*!< Print an error message and returns 1 for the operational system. */
+    return 1;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+
+  /*!
+    Allocating in the subsystem data bank. The default data bank is not touched...
+  */
+  uint32_t* ui32pSamples = (uint32_t*) DataBank_callocFrom(dbSensorBank, sizeof(uint32_t), 30);
+  uint8_t* ui8pFlags = (uint8_t*) DataBank_callocFrom(dbSensorBank, sizeof(uint8_t), 10);
+  if (ui32pSamples == NULL || ui8pFlags == NULL){                                                     /*!< If not possible data bank allocation... */
+    printf("ERROR: Allocation memories error!\n");                                                     /*!< Print an error message and returns 2 for the operational system. */
+    return 2;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+  printf("Subsystem 32-bit free space: %d\n", DataBank_getFreeSpaceFrom(dbSensorBank, sizeof(uint32_t)));
+  printf("Default 32-bit free space: %d\n", DataBank_getFreeSpace(sizeof(uint32_t)));
+
+  /*!
+    Deleting data in the subsystem data bank...
+  */
+  DataBank_freeFrom(dbSensorBank, &ui32pSamples, sizeof(uint32_t), 30);
+  DataBank_freeFrom(dbSensorBank, &ui8pFlags, sizeof(uint8_t), 10);
+  if (ui32pSamples != NULL || ui8pFlags != NULL){                                                     /*!< If any pointer is not NULL... */
+    printf("ERROR: Dynamic memory deallocation error!\n");                                             /*!< Print an error message and returns 3 for the operational system. */
+    return 3;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+//! Example 05 - Recording an allocation trace
+/*!
+  This simply example demonstrates the use of the DataBank profiler. The
+  allocation trace of the default data bank is saved on a file and can be
+  replayed by Tools/DataBankProfiler to size the __DATA_BANK_POOL_LIST__
+  pools. Each data bank has its own callback: record other banks on other
+  files.
+
+  Enable __DATA_BANK_PROFILER_ENABLE__ in Configs.h before running it. On a
+  microcontroller, you can send the records by a serial port.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <MemoryManager.h>
+
+/*!
+  Trace file.
+*/
+static FILE* fpTrace = NULL;
+
+/*!
+  Profiler callback: Each record is saved on the trace file.
+*/
+void saveRecord(const data_bank_trace_t* dbtRecord){
+  uint8_t ui8pRecord[4] = {dbtRecord->ui8Operation, dbtRecord->ui8ElementSize, (uint8_t) dbtRecord->ui16AllocationSize, (uint8_t) (dbtRecord->ui16AllocationSize >> 8)};
+  fwrite(ui8pRecord, sizeof(ui8pRecord), 1, fpTrace);
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  fpTrace = fopen("databank.trace", "wb");
+  if (fpTrace == NULL){                                                                               /*!< If the file can't be opened... */
+    printf("ERROR: The trace file can't be opened!\n");                                                /*!< Print an error message and returns 1 for the operational system. */
+    return 1;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+  DataBank_setProfilerCallback(dbDefaultDataBank, saveRecord);
+
+  /*!
+    Running a sample workload...
+  */
+  uint16_t ui16Counter = 0;
+  for (ui16Counter = 0 ; ui16Counter < 1000 ; ui16Counter++){
+    uint16_t* ui16pSample = (uint16_t*) DataBank_malloc(sizeof(uint16_t), 1 + (ui16Counter % 7));
+    uint32_t* ui32pSample = (uint32_t*) DataBank_malloc(sizeof(uint32_t), 1 + (ui16Counter % 3));
+    DataBank_freePtr(&ui16pSample);
+    DataBank_freePtr(&ui32pSample);
+  }
+
+  /*!
+    Stopping the recording...
+  */
+  DataBank_setProfilerCallback(dbDefaultDataBank, NULL);
+  fclose(fpTrace);
+  printf("Trace saved! Run: DataBankProfiler databank.trace\n");
+  return 0;
+}
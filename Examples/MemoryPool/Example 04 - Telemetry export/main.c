@@ -0,0 +1,87 @@
+//! Example 04 - Telemetry export
+/*!
+  This simply example demonstrates the telemetry export of memory pools. The
+  library memory pools are exported automatically and your memory pools can
+  be registered too. The dump can be served to a JSON or Prometheus scraper.
+
+  Enable __MEMORY_POOL_TELEMETRY_ENABLE__ in Configs.h before running it.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <MemoryManager.h>
+
+/*!
+  Dump buffer.
+*/
+static char cpDumpBuffer[4096];
+
+/*!
+  Main function.
+*/
+int main(){
+  /*!
+    Creating and registering a memory pool...
+  */
+  newMemoryPool(mpPacketPool, 32, 40);
+  if (Telemetry_registerPool(mpPacketPool, "mpPacketPool") != TELEMETRY_STATUS_POOL_REGISTERED){       /*!< If the memory pool was not registered... */
+    printf("ERROR: Telemetry registration error!\n");                                                  /*!< Print an error message and returns 1 for the operational system. */
+    return 1;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+
+  /*!
+    Allocating...
+  */
+  void* vpPacketA = MemoryPool_malloc(mpPacketPool, 10);
+  void* vpPacketB = MemoryPool_malloc(mpPacketPool, 10);
+  uint16_t* ui16pSamples = (uint16_t*) DataBank_malloc(sizeof(uint16_t), 8);
+  if (vpPacketA == NULL || vpPacketB == NULL || ui16pSamples == NULL){                                /*!< If not possible memory pool allocation... */
+    printf("ERROR: Allocation memories error!\n");                                                     /*!< Print an error message and returns 2 for the operational system. */
+    return 2;                                                                                         /*!< You can treat the problem any way you want! */
+  }
+  MemoryPool_free(mpPacketPool, &vpPacketA, 10);
+
+  /*!
+    Exporting...
+  */
+  if (Telemetry_dump(cpDumpBuffer, sizeof(cpDumpBuffer), TELEMETRY_FORMAT_JSON) >= sizeof(cpDumpBuffer)){   /*!< If the dump is bigger than the buffer... */
+    printf("ERROR: Dump buffer is too small!\n");                                                            /*!< Print an error message and returns 3 for the operational system. */
+    return 3;                                                                                               /*!< You can treat the problem any way you want! */
+  }
+  printf("%s\n", cpDumpBuffer);
+  Telemetry_dump(cpDumpBuffer, sizeof(cpDumpBuffer), TELEMETRY_FORMAT_PROMETHEUS);
+  printf("%s", cpDumpBuffer);
+  return 0;
+}
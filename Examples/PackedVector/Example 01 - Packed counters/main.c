@@ -0,0 +1,129 @@
+//! Example 01 - Packed counters
+/*!
+  This simply example saves one million 12-bit counters in a packed vector
+  and compares its size with a uint16_t array. It also compares the decoding
+  speed of a PackedVector_get loop with PackedVector_unpack, which uses SIMD
+  when the processor has it, and the encoding speed of a PackedVector_set
+  loop with PackedVector_pack.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_COUNTERS 1000000
+#define COUNTER_BIT_WIDTH 12
+#define AMOUNT_OF_REPETITIONS 20
+
+/*!
+  Packed counters and the unpacked arrays.
+*/
+newStaticPackedVector(pvCounters, COUNTER_BIT_WIDTH, AMOUNT_OF_COUNTERS);
+static uint16_t ui16Counters[AMOUNT_OF_COUNTERS];
+static uint32_t ui32Values[AMOUNT_OF_COUNTERS];
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Index = 0;
+  uint64_t ui64Sum = 0;
+  clock_t ckStart = 0;
+
+  for (ui32Index = 0 ; ui32Index < AMOUNT_OF_COUNTERS ; ui32Index++){
+    ui16Counters[ui32Index] = (uint16_t) ((ui32Index * 2654435761U) >> 20);
+    ui32Values[ui32Index] = ui16Counters[ui32Index];
+  }
+  printf("uint16_t array: %lu bytes\n", (unsigned long) sizeof(ui16Counters));
+  printf("Packed vector:  %lu bytes\n", (unsigned long) PackedVector_getSize(COUNTER_BIT_WIDTH, AMOUNT_OF_COUNTERS));
+
+  /*!
+    Encoding with PackedVector_set loop...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    for (ui32Index = 0 ; ui32Index < AMOUNT_OF_COUNTERS ; ui32Index++){
+      PackedVector_set(pvCounters, ui32Index, ui32Values[ui32Index]);
+    }
+  }
+  printf("PackedVector_set:    %8.1f us\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS);
+
+  /*!
+    Encoding with PackedVector_pack...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    PackedVector_pack(pvCounters, 0, AMOUNT_OF_COUNTERS, ui32Values);
+  }
+  printf("PackedVector_pack:   %8.1f us\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS);
+
+  /*!
+    Decoding with PackedVector_get loop...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    for (ui32Index = 0 ; ui32Index < AMOUNT_OF_COUNTERS ; ui32Index++){
+      ui64Sum = ui64Sum + PackedVector_get(pvCounters, ui32Index);
+    }
+  }
+  printf("PackedVector_get:    %8.1f us (sum: %llu)\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS, (unsigned long long) ui64Sum);
+
+  /*!
+    Decoding with PackedVector_unpack...
+  */
+  ckStart = clock();
+  for (ui32Counter = 0, ui64Sum = 0 ; ui32Counter < AMOUNT_OF_REPETITIONS ; ui32Counter++){
+    PackedVector_unpack(pvCounters, 0, AMOUNT_OF_COUNTERS, ui32Values);
+    ui64Sum = ui64Sum + ui32Values[ui32Counter];
+  }
+  printf("PackedVector_unpack: %8.1f us\n", 1000000.0 * (clock() - ckStart) / CLOCKS_PER_SEC / AMOUNT_OF_REPETITIONS);
+
+  /*!
+    Checking the values...
+  */
+  for (ui32Index = 0 ; ui32Index < AMOUNT_OF_COUNTERS ; ui32Index++){
+    if (ui32Values[ui32Index] != ui16Counters[ui32Index]){
+      printf("ERROR: Value %u is wrong!", (unsigned int) ui32Index);
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,182 @@
+//! Example 01 - Sparse identifier sets
+/*!
+  This simply example keeps two sparse sets of identifiers (random
+  identifiers and a long sequence) in roaring bitmaps and in flat bit
+  vectors. It compares the memory, the union, the intersection and the
+  iteration of both. The containers are allocated from a data bank with a
+  memory pool of 8-byte elements.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <MemoryManager.h>
+
+/*!
+  Example parameters.
+*/
+#define AMOUNT_OF_IDENTIFIERS 67108864
+#define AMOUNT_OF_RANDOM_IDENTIFIERS 20000
+#define SEQUENCE_START 1000000
+#define SEQUENCE_SIZE 100000
+#define POOL_SIZE 65000
+
+/*!
+  Memory of the containers: a memory pool of 8-byte elements in a data bank.
+*/
+static uint64_t ui64PoolMemory[(MemoryPool_getRequiredMemory(ROARING_BITMAP_ELEMENT_SIZE, POOL_SIZE) / sizeof(uint64_t)) + 1];
+newStaticDataBank(dbRoaringBank, 1);
+
+/*!
+  Roaring bitmaps.
+*/
+newStaticRoaringBitmap(rbSetA);
+newStaticRoaringBitmap(rbSetB);
+newStaticRoaringBitmap(rbResult);
+
+/*!
+  Flat bit vectors.
+*/
+newStaticBitVector(bvSetA, AMOUNT_OF_IDENTIFIERS);
+newStaticBitVector(bvSetB, AMOUNT_OF_IDENTIFIERS);
+newStaticBitVector(bvResult, AMOUNT_OF_IDENTIFIERS);
+
+/*!
+  Pseudo-random generator (xorshift).
+*/
+uint32_t ui32Seed = 2463534242U;
+uint32_t getRandomIdentifier(){
+  ui32Seed = ui32Seed ^ (ui32Seed << 13);
+  ui32Seed = ui32Seed ^ (ui32Seed >> 17);
+  ui32Seed = ui32Seed ^ (ui32Seed << 5);
+  return ui32Seed % AMOUNT_OF_IDENTIFIERS;
+}
+
+/*!
+  Iteration callback: sums the identifiers.
+*/
+bool sumIdentifier(uint32_t ui32Value, void* vpContext){
+  *((uint64_t*) vpContext) = *((uint64_t*) vpContext) + ui32Value;
+  return true;
+}
+
+/*!
+  Adds an identifier to both representations.
+*/
+void addIdentifier(roaring_t rbSet, bitvector_t* bvSet, uint32_t ui32Identifier){
+  RoaringBitmap_add(rbSet, ui32Identifier);
+  BitVector_setBit(bvSet, ui32Identifier);
+}
+
+/*!
+  Main function.
+*/
+int main(){
+  uint32_t ui32Counter = 0;
+  uint32_t ui32Position = 0;
+  uint64_t ui64RoaringSum = 0;
+  uint64_t ui64FlatSum = 0;
+  clock_t ckStart = 0;
+  DataBank_registerPool(dbRoaringBank, MemoryPool_create(ui64PoolMemory, ROARING_BITMAP_ELEMENT_SIZE, POOL_SIZE));
+  RoaringBitmap_setDataBank(rbSetA, dbRoaringBank);
+  RoaringBitmap_setDataBank(rbSetB, dbRoaringBank);
+  RoaringBitmap_setDataBank(rbResult, dbRoaringBank);
+
+  /*!
+    Building the sets...
+  */
+  for (ui32Counter = 0 ; ui32Counter < AMOUNT_OF_RANDOM_IDENTIFIERS ; ui32Counter++){
+    addIdentifier(rbSetA, bvSetA, getRandomIdentifier());
+    addIdentifier(rbSetB, bvSetB, getRandomIdentifier());
+  }
+  for (ui32Counter = SEQUENCE_START ; ui32Counter < SEQUENCE_START + SEQUENCE_SIZE ; ui32Counter++){
+    addIdentifier(rbSetA, bvSetA, ui32Counter);
+    addIdentifier(rbSetB, bvSetB, ui32Counter + SEQUENCE_SIZE / 2);
+  }
+  printf("Identifiers in set A: %llu\n", (unsigned long long) RoaringBitmap_getCardinality(rbSetA));
+  printf("Memory of a flat bit vector:   %8lu bytes\n", (unsigned long) sizeof(bvSetA));
+  printf("Memory of roaring bitmap A:    %8lu bytes\n", (unsigned long) RoaringBitmap_getMemoryUsage(rbSetA));
+  RoaringBitmap_runOptimize(rbSetA);
+  RoaringBitmap_runOptimize(rbSetB);
+  printf("After RoaringBitmap_runOptimize:%7lu bytes\n", (unsigned long) RoaringBitmap_getMemoryUsage(rbSetA));
+
+  /*!
+    Union...
+  */
+  ckStart = clock();
+  BitVector_or(bvResult, bvSetA, bvSetB, AMOUNT_OF_IDENTIFIERS);
+  printf("Flat union:            %10.3f ms\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC);
+  ckStart = clock();
+  if (RoaringBitmap_or(rbResult, rbSetA, rbSetB) == false){
+    printf("ERROR: No enough memory!\n");
+    return 1;
+  }
+  printf("Roaring union:         %10.3f ms (%llu identifiers)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC, (unsigned long long) RoaringBitmap_getCardinality(rbResult));
+
+  /*!
+    Intersection...
+  */
+  ckStart = clock();
+  BitVector_and(bvResult, bvSetA, bvSetB, AMOUNT_OF_IDENTIFIERS);
+  printf("Flat intersection:     %10.3f ms\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC);
+  ckStart = clock();
+  if (RoaringBitmap_and(rbResult, rbSetA, rbSetB) == false){
+    printf("ERROR: No enough memory!\n");
+    return 1;
+  }
+  printf("Roaring intersection:  %10.3f ms (%llu identifiers)\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC, (unsigned long long) RoaringBitmap_getCardinality(rbResult));
+
+  /*!
+    Iteration over the intersection...
+  */
+  ckStart = clock();
+  for (ui32Position = BitVector_findFirstSet(bvResult, AMOUNT_OF_IDENTIFIERS) ; ui32Position != BIT_VECTOR_NOT_FOUND ; ui32Position = BitVector_findNextSet(bvResult, AMOUNT_OF_IDENTIFIERS, ui32Position + 1)){
+    ui64FlatSum = ui64FlatSum + ui32Position;
+  }
+  printf("Flat iteration:        %10.3f ms\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC);
+  ckStart = clock();
+  RoaringBitmap_forEach(rbResult, sumIdentifier, &ui64RoaringSum);
+  printf("Roaring iteration:     %10.3f ms\n", 1000.0 * (clock() - ckStart) / CLOCKS_PER_SEC);
+  if (ui64FlatSum != ui64RoaringSum){
+    printf("ERROR: The sets are different!\n");
+    return 1;
+  }
+
+  RoaringBitmap_clear(rbSetA);
+  RoaringBitmap_clear(rbSetB);
+  RoaringBitmap_clear(rbResult);
+  return 0;
+}
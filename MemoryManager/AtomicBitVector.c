@@ -0,0 +1,96 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+
+  #include "./AtomicBitVector.h"
+
+  //! Macro: All Bits Cell
+  /*!
+    A cell with all bits set.
+  */
+  #define __ATOMIC_BIT_VECTOR_ONES__ ((atomic_bitvector_t) ~((atomic_bitvector_t) 0))
+
+  //! Macros: Bit Intrinsics
+  /*!
+    Count trailing zeros and population count of a cell.
+  */
+  #if (__BIT_VECTOR_WORD_SIZE__ == 64)
+    #define __AtomicBitVector_countTrailingZeros(abvCell) ((uint32_t) __builtin_ctzll(abvCell))
+    #define __AtomicBitVector_countOnesOfCell(abvCell) ((uint32_t) __builtin_popcountll(abvCell))
+  #else
+    #define __AtomicBitVector_countTrailingZeros(abvCell) ((uint32_t) __builtin_ctz((unsigned int) (abvCell)))
+    #define __AtomicBitVector_countOnesOfCell(abvCell) ((uint32_t) __builtin_popcount((unsigned int) (abvCell)))
+  #endif
+
+  //! Private Function: Unavailable Bits Mask
+  /*!
+    Gets the mask of the bits after the end of the bit vector on its last cell. They are treated as set, so they are never claimed.
+  */
+  static inline atomic_bitvector_t __AtomicBitVector_getPaddingMask(uint32_t ui32AmountOfBits, uint32_t ui32CellPosition){
+    uint32_t ui32AmountOfCells = AtomicBitVector_getSize(ui32AmountOfBits);
+    if (ui32CellPosition != ui32AmountOfCells - 1 || (ui32AmountOfBits % __BIT_VECTOR_WORD_SIZE__) == 0){
+      return 0;
+    }
+    return (atomic_bitvector_t) (__ATOMIC_BIT_VECTOR_ONES__ << (ui32AmountOfBits % __BIT_VECTOR_WORD_SIZE__));
+  }
+
+  //! Function: Atomic First Clear Bit Claimer
+  /*!
+    Finds a clear bit and sets it atomically, so each bit is claimed by only one thread (lock-free slot allocation). The search starts at ui32StartPosition and wraps around; threads with different start positions touch different cells. A successful claim has acquire order, so the slot can be used after it; give it back with AtomicBitVector_clearBit and BIT_VECTOR_ORDER_RELEASE.
+    \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \return Returns the claimed bit position or BIT_VECTOR_NOT_FOUND if all bits are set.
+  */
+  uint32_t AtomicBitVector_claimFirstClear(atomic_bitvector_t* abvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition){
+    uint32_t ui32AmountOfCells = AtomicBitVector_getSize(ui32AmountOfBits);
+    uint32_t ui32CellPosition = 0;
+    uint32_t ui32Counter = 0;
+    if (ui32AmountOfBits == 0){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    if (ui32StartPosition >= ui32AmountOfBits){
+      ui32StartPosition = 0;
+    }
+    ui32CellPosition = AtomicBitVector_getCellPosition(ui32StartPosition);
+    for (ui32Counter = 0 ; ui32Counter < ui32AmountOfCells ; ui32Counter++){
+      atomic_bitvector_t abvUnavailable = __AtomicBitVector_getPaddingMask(ui32AmountOfBits, ui32CellPosition);
+      atomic_bitvector_t abvCell = __atomic_load_n(&abvBitVector[ui32CellPosition], __ATOMIC_RELAXED) | abvUnavailable;
+      while (abvCell != __ATOMIC_BIT_VECTOR_ONES__){
+        atomic_bitvector_t abvMask = (atomic_bitvector_t) ((atomic_bitvector_t) 1 << __AtomicBitVector_countTrailingZeros((atomic_bitvector_t) ~abvCell));
+        atomic_bitvector_t abvPrevious = __atomic_fetch_or(&abvBitVector[ui32CellPosition], abvMask, __ATOMIC_ACQUIRE);
+        if ((abvPrevious & abvMask) == 0){
+          return ui32CellPosition * __BIT_VECTOR_WORD_SIZE__ + __AtomicBitVector_countTrailingZeros(abvMask);
+        }
+        abvCell = abvPrevious | abvUnavailable;
+      }
+      ui32CellPosition++;
+      if (ui32CellPosition == ui32AmountOfCells){
+        ui32CellPosition = 0;
+      }
+    }
+    return BIT_VECTOR_NOT_FOUND;
+  }
+
+  //! Function: Atomic Bit Vector Set Bits Counter
+  /*!
+    Counts the set bits of an atomic bit vector. Each cell is read atomically, but the bit vector can change during the count.
+    \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \return Returns the amount of set bits.
+  */
+  uint32_t AtomicBitVector_countOnes(atomic_bitvector_t* abvBitVector, uint32_t ui32AmountOfBits){
+    uint32_t ui32AmountOfCells = AtomicBitVector_getSize(ui32AmountOfBits);
+    uint32_t ui32CellPosition = 0;
+    uint32_t ui32AmountOfOnes = 0;
+    if (ui32AmountOfBits == 0){
+      return 0;
+    }
+    for (ui32CellPosition = 0 ; ui32CellPosition < ui32AmountOfCells ; ui32CellPosition++){
+      atomic_bitvector_t abvCell = __atomic_load_n(&abvBitVector[ui32CellPosition], __ATOMIC_ACQUIRE) & (atomic_bitvector_t) ~__AtomicBitVector_getPaddingMask(ui32AmountOfBits, ui32CellPosition);
+      ui32AmountOfOnes = ui32AmountOfOnes + __AtomicBitVector_countOnesOfCell(abvCell);
+    }
+    return ui32AmountOfOnes;
+  }
+
+#endif
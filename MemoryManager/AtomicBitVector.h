@@ -0,0 +1,192 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __ATOMIC_BIT_VECTOR_HEADER__
+  #define __ATOMIC_BIT_VECTOR_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+
+    //! Type Definition: atomic_bitvector_t
+    /*!
+      Cell of an atomic bit vector. Each cell is a bitvector_word_t changed by atomic operations, so threads can change bits of the same cell without losing updates. On little-endian processors the memory layout is the same of a bitvector_t vector.
+    */
+    typedef bitvector_word_t atomic_bitvector_t;
+
+    //! Enumeration Definition: Bit Vector Memory Order
+    /*!
+      Memory orders of the atomic bit vector operations. They must be constants, so the compiler can select the right instructions.
+    */
+    typedef enum{
+      BIT_VECTOR_ORDER_RELAXED = __ATOMIC_RELAXED,
+      BIT_VECTOR_ORDER_ACQUIRE = __ATOMIC_ACQUIRE,
+      BIT_VECTOR_ORDER_RELEASE = __ATOMIC_RELEASE,
+      BIT_VECTOR_ORDER_ACQUIRE_RELEASE = __ATOMIC_ACQ_REL,
+      BIT_VECTOR_ORDER_SEQUENTIAL = __ATOMIC_SEQ_CST
+    } bitvector_memory_order_t;
+
+    //! Macro: Atomic Bit Vector Size
+    /*!
+      Calculates the amount of cells of an atomic bit vector.
+      \param uiAmountOfBit is a unsigned integer. It's a desirable amount of bits.
+      \return Returns the amount of cells.
+    */
+    #define AtomicBitVector_getSize(uiAmountOfBit)\
+      ((((uiAmountOfBit) + __BIT_VECTOR_WORD_SIZE__ - 1) / __BIT_VECTOR_WORD_SIZE__) + ((uiAmountOfBit) == 0))
+
+    //! Macro: Atomic Bit Vector Creator
+    /*!
+      This macro creates an atomic bit vector.
+      \param abvName is an atomic bit vector name.
+      \param uiAmountOfBit is a unsigned integer. It's the desirable amount of bits.
+    */
+    #define newAtomicBitVector(abvName, uiAmountOfBit)\
+      atomic_bitvector_t abvName[AtomicBitVector_getSize(uiAmountOfBit)] = {0}
+
+    //! Macro: Static Atomic Bit Vector Creator
+    /*!
+      This macro creates a static atomic bit vector.
+      \param abvName is an atomic bit vector name.
+      \param uiAmountOfBit is a unsigned integer. It's the desirable amount of bits.
+    */
+    #define newStaticAtomicBitVector(abvName, uiAmountOfBit)\
+      static atomic_bitvector_t abvName[AtomicBitVector_getSize(uiAmountOfBit)] = {0}
+
+    //! Macros: Cell Position Calculus
+    /*!
+      These macros calculate the cell of a bit and the mask of the bit in its cell.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+    */
+    #define AtomicBitVector_getCellPosition(uiPosition)\
+      ((uiPosition) / __BIT_VECTOR_WORD_SIZE__)
+
+    #define AtomicBitVector_getBitMask(uiPosition)\
+      ((atomic_bitvector_t) ((atomic_bitvector_t) 1 << ((uiPosition) % __BIT_VECTOR_WORD_SIZE__)))
+
+    //! Macro: Atomic Bit Vector Reader
+    /*!
+      Reads a bit of an atomic bit vector.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order (relaxed, acquire or sequential).
+      \return Returns the bit value.
+    */
+    #define AtomicBitVector_readBit(abvBitVector, uiPosition, bmoOrder)\
+      ((__atomic_load_n(&(abvBitVector)[AtomicBitVector_getCellPosition(uiPosition)], bmoOrder) & AtomicBitVector_getBitMask(uiPosition)) != 0)
+
+    //! Macro: Atomic Bit Vector Test and Set
+    /*!
+      Sets a bit of an atomic bit vector and returns its previous value.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+      \return Returns the previous bit value.
+    */
+    #define AtomicBitVector_testAndSet(abvBitVector, uiPosition, bmoOrder)\
+      ((__atomic_fetch_or(&(abvBitVector)[AtomicBitVector_getCellPosition(uiPosition)], AtomicBitVector_getBitMask(uiPosition), bmoOrder) & AtomicBitVector_getBitMask(uiPosition)) != 0)
+
+    //! Macro: Atomic Bit Vector Test and Clear
+    /*!
+      Clears a bit of an atomic bit vector and returns its previous value.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+      \return Returns the previous bit value.
+    */
+    #define AtomicBitVector_testAndClear(abvBitVector, uiPosition, bmoOrder)\
+      ((__atomic_fetch_and(&(abvBitVector)[AtomicBitVector_getCellPosition(uiPosition)], (atomic_bitvector_t) ~AtomicBitVector_getBitMask(uiPosition), bmoOrder) & AtomicBitVector_getBitMask(uiPosition)) != 0)
+
+    //! Macro: Atomic Bit Vector Setter
+    /*!
+      Sets a bit of an atomic bit vector.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+    */
+    #define AtomicBitVector_setBit(abvBitVector, uiPosition, bmoOrder)\
+      ((void) __atomic_fetch_or(&(abvBitVector)[AtomicBitVector_getCellPosition(uiPosition)], AtomicBitVector_getBitMask(uiPosition), bmoOrder))
+
+    //! Macro: Atomic Bit Vector Eraser
+    /*!
+      Erases a bit of an atomic bit vector. Use BIT_VECTOR_ORDER_RELEASE to give back a slot claimed by AtomicBitVector_claimFirstClear.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+    */
+    #define AtomicBitVector_clearBit(abvBitVector, uiPosition, bmoOrder)\
+      ((void) __atomic_fetch_and(&(abvBitVector)[AtomicBitVector_getCellPosition(uiPosition)], (atomic_bitvector_t) ~AtomicBitVector_getBitMask(uiPosition), bmoOrder))
+
+    //! Macro: Atomic Cell Fetch-Or
+    /*!
+      Sets the bits of a mask on a cell of an atomic bit vector.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiCellPosition is a unsigned integer. It's the cell position.
+      \param abvMask is an atomic_bitvector_t. It's the mask.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+      \return Returns the previous cell value.
+    */
+    #define AtomicBitVector_fetchOr(abvBitVector, uiCellPosition, abvMask, bmoOrder)\
+      __atomic_fetch_or(&(abvBitVector)[uiCellPosition], (atomic_bitvector_t) (abvMask), bmoOrder)
+
+    //! Macro: Atomic Cell Fetch-And
+    /*!
+      Keeps only the bits of a mask on a cell of an atomic bit vector.
+      \param abvBitVector is an atomic_bitvector_t pointer. It's the atomic bit vector.
+      \param uiCellPosition is a unsigned integer. It's the cell position.
+      \param abvMask is an atomic_bitvector_t. It's the mask.
+      \param bmoOrder is a bitvector_memory_order_t. It's the memory order.
+      \return Returns the previous cell value.
+    */
+    #define AtomicBitVector_fetchAnd(abvBitVector, uiCellPosition, abvMask, bmoOrder)\
+      __atomic_fetch_and(&(abvBitVector)[uiCellPosition], (atomic_bitvector_t) (abvMask), bmoOrder)
+
+    uint32_t AtomicBitVector_claimFirstClear(atomic_bitvector_t* abvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition);  /*!< 32-bits integer type function. */
+    uint32_t AtomicBitVector_countOnes(atomic_bitvector_t* abvBitVector, uint32_t ui32AmountOfBits);                                    /*!< 32-bits integer type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
@@ -0,0 +1,249 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./BitMatrix.h"
+  #include <string.h>
+
+  //! Macro: Population Count
+  /*!
+    Amount of set bits of a 64-bit word.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __BitMatrix_countOnes(ui64Word) ((uint32_t) __builtin_popcountll(ui64Word))
+  #else
+    static uint32_t __BitMatrix_countOnes(uint64_t ui64Word){
+      ui64Word = ui64Word - ((ui64Word >> 1) & 0x5555555555555555ULL);
+      ui64Word = (ui64Word & 0x3333333333333333ULL) + ((ui64Word >> 2) & 0x3333333333333333ULL);
+      ui64Word = (ui64Word + (ui64Word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+      return (uint32_t) ((ui64Word * 0x0101010101010101ULL) >> 56);
+    }
+  #endif
+
+  //! Private Function: Block Loader
+  /*!
+    Copies a 64x64 block of a bit matrix to 64 words. Rows and columns after the end of the matrix are read as 0.
+    \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+    \param ui32FirstRow is a unsigned 32-bit integer. It's the first row of the block (a multiple of 64).
+    \param ui32WordColumn is a unsigned 32-bit integer. It's the word of the block columns.
+    \param ui64pBlock is a unsigned 64-bit integer pointer. It's the block.
+  */
+  static void __BitMatrix_loadBlock(bitmatrix_t bmMatrix, uint32_t ui32FirstRow, uint32_t ui32WordColumn, uint64_t* ui64pBlock){
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < 64 ; ui32Counter++){
+      uint32_t ui32Row = ui32FirstRow + ui32Counter;
+      ui64pBlock[ui32Counter] = (ui32Row < bmMatrix->ui32AmountOfRows) ? bmMatrix->ui64pWords[(uint64_t) ui32Row * bmMatrix->ui32WordsPerRow + ui32WordColumn] : 0;
+    }
+  }
+
+  //! Private Function: Vector Word Loader
+  /*!
+    Loads a 64-bit word of a bit vector. Bytes after the end of the bit vector are read as 0.
+    \param bvVector is a bitvector_t pointer. It's the bit vector.
+    \param ui32AmountOfBytes is a unsigned 32-bit integer. It's the amount of bytes of the bit vector.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  static inline uint64_t __BitMatrix_loadVectorWord(const bitvector_t* bvVector, uint32_t ui32AmountOfBytes, uint32_t ui32WordPosition){
+    uint32_t ui32FirstByte = ui32WordPosition * 8;
+    uint64_t ui64Word = 0;
+    uint32_t ui32Counter = 0;
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      if (ui32FirstByte + 8 <= ui32AmountOfBytes){
+        memcpy(&ui64Word, &bvVector[ui32FirstByte], sizeof(uint64_t));
+        return ui64Word;
+      }
+    #endif
+    for (ui32Counter = 0 ; ui32Counter < 8 && ui32FirstByte + ui32Counter < ui32AmountOfBytes ; ui32Counter++){
+      ui64Word = ui64Word | ((uint64_t) bvVector[ui32FirstByte + ui32Counter] << (ui32Counter << 3));
+    }
+    return ui64Word;
+  }
+
+  //! Private Function: Whole Matrix Operation Check
+  /*!
+    Checks if three bit matrices have the same amount of rows and columns.
+  */
+  static bool __BitMatrix_checkShapes(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB){
+    return (bmDestination->ui32AmountOfRows == bmMatrixA->ui32AmountOfRows && bmDestination->ui32AmountOfRows == bmMatrixB->ui32AmountOfRows &&
+            bmDestination->ui32AmountOfColumns == bmMatrixA->ui32AmountOfColumns && bmDestination->ui32AmountOfColumns == bmMatrixB->ui32AmountOfColumns);
+  }
+
+  //! Macro: Words per Whole Matrix Operation Call
+  /*!
+    Maximum amount of words given to a BitVector function at a time: 2^31 bits, so the amount of bits fits in its 32-bit parameter.
+  */
+  #define __BIT_MATRIX_WORDS_PER_CALL__ ((uint64_t) 1 << 25)
+
+  //! Private Function: Whole Matrix Operation
+  /*!
+    Applies a BitVector boolean operation on all words of three bit matrices with the same shape. The amount of bits of a matrix can be bigger than 32 bits, so the words are given to the operation in chunks of __BIT_MATRIX_WORDS_PER_CALL__ words. The rows are contiguous and their padding bits are 0 on all operands, so the chunks don't need to end on a row.
+    \param vfpOperation is a function pointer. It's BitVector_and, BitVector_or or BitVector_xor.
+    \param bmDestination is a bitmatrix_t type. It's the result.
+    \param bmMatrixA is a bitmatrix_t type. It's the first operand.
+    \param bmMatrixB is a bitmatrix_t type. It's the second operand.
+  */
+  static void __BitMatrix_operate(void (*vfpOperation)(bitvector_t*, const bitvector_t*, const bitvector_t*, uint32_t), bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB){
+    uint64_t ui64AmountOfWords = (uint64_t) bmDestination->ui32AmountOfRows * bmDestination->ui32WordsPerRow;
+    uint64_t ui64Word = 0;
+    for (ui64Word = 0 ; ui64Word < ui64AmountOfWords ; ui64Word = ui64Word + __BIT_MATRIX_WORDS_PER_CALL__){
+      uint64_t ui64AmountOfChunkWords = ui64AmountOfWords - ui64Word;
+      if (ui64AmountOfChunkWords > __BIT_MATRIX_WORDS_PER_CALL__){
+        ui64AmountOfChunkWords = __BIT_MATRIX_WORDS_PER_CALL__;
+      }
+      vfpOperation((bitvector_t*) &bmDestination->ui64pWords[ui64Word], (const bitvector_t*) &bmMatrixA->ui64pWords[ui64Word], (const bitvector_t*) &bmMatrixB->ui64pWords[ui64Word], (uint32_t) (ui64AmountOfChunkWords * 64));
+    }
+  }
+
+  //! Function: Bit Matrix Eraser
+  /*!
+    Clears all bits of a bit matrix.
+    \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+  */
+  void BitMatrix_clear(bitmatrix_t bmMatrix){
+    memset(bmMatrix->ui64pWords, 0, (size_t) ((uint64_t) bmMatrix->ui32AmountOfRows * bmMatrix->ui32WordsPerRow * sizeof(uint64_t)));
+  }
+
+  //! Functions: Whole Matrix Boolean Operations
+  /*!
+    Apply a boolean operation on all bits of two bit matrices with the same shape. The rows are contiguous, so the matrix is operated as one bit vector (in chunks of 2^31 bits) by the SIMD kernels of the BitVector functions. The destination can be one of the operands.
+    \param bmDestination is a bitmatrix_t type. It's the result.
+    \param bmMatrixA is a bitmatrix_t type. It's the first operand.
+    \param bmMatrixB is a bitmatrix_t type. It's the second operand.
+    \return Returns false if the shapes are different.
+  */
+  bool BitMatrix_and(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB){
+    if (__BitMatrix_checkShapes(bmDestination, bmMatrixA, bmMatrixB) == false){
+      return false;
+    }
+    __BitMatrix_operate(BitVector_and, bmDestination, bmMatrixA, bmMatrixB);
+    return true;
+  }
+
+  bool BitMatrix_or(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB){
+    if (__BitMatrix_checkShapes(bmDestination, bmMatrixA, bmMatrixB) == false){
+      return false;
+    }
+    __BitMatrix_operate(BitVector_or, bmDestination, bmMatrixA, bmMatrixB);
+    return true;
+  }
+
+  bool BitMatrix_xor(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB){
+    if (__BitMatrix_checkShapes(bmDestination, bmMatrixA, bmMatrixB) == false){
+      return false;
+    }
+    __BitMatrix_operate(BitVector_xor, bmDestination, bmMatrixA, bmMatrixB);
+    return true;
+  }
+
+  //! Function: 64x64 Block Transpose
+  /*!
+    Transposes a 64x64 bit block in place: the bit c of the word r becomes the bit r of the word c. It swaps 32x32, 16x16, ..., 1x1 sub-blocks with masked shifts (6 rounds of 32 word operations) instead of 4096 bit moves.
+    \param ui64pBlock is a unsigned 64-bit integer pointer. It's the block (64 words).
+  */
+  void BitMatrix_transposeBlock(uint64_t* ui64pBlock){
+    uint64_t ui64Mask = 0x00000000FFFFFFFFULL;
+    uint32_t ui32Width = 32;
+    uint32_t ui32Counter = 0;
+    for ( ; ui32Width != 0 ; ui32Width = ui32Width >> 1, ui64Mask = ui64Mask ^ (ui64Mask << ui32Width)){
+      for (ui32Counter = 0 ; ui32Counter < 64 ; ui32Counter = ((ui32Counter | ui32Width) + 1) & ~ui32Width){
+        uint64_t ui64Swap = ((ui64pBlock[ui32Counter] >> ui32Width) ^ ui64pBlock[ui32Counter | ui32Width]) & ui64Mask;
+        ui64pBlock[ui32Counter] = ui64pBlock[ui32Counter] ^ (ui64Swap << ui32Width);
+        ui64pBlock[ui32Counter | ui32Width] = ui64pBlock[ui32Counter | ui32Width] ^ ui64Swap;
+      }
+    }
+  }
+
+  //! Function: Bit Matrix Transpose
+  /*!
+    Transposes a bit matrix, a 64x64 block at a time.
+    \param bmDestination is a bitmatrix_t type. It's the result. Its amount of rows must be the source amount of columns and vice versa, and it can't be the source.
+    \param bmSource is a bitmatrix_t type. It's the bit matrix to be transposed.
+    \return Returns false if the shapes don't match.
+  */
+  bool BitMatrix_transpose(bitmatrix_t bmDestination, bitmatrix_t bmSource){
+    uint64_t ui64Block[64];
+    uint32_t ui32FirstRow = 0;
+    uint32_t ui32WordColumn = 0;
+    uint32_t ui32Counter = 0;
+    if (bmDestination->ui32AmountOfRows != bmSource->ui32AmountOfColumns || bmDestination->ui32AmountOfColumns != bmSource->ui32AmountOfRows || bmDestination == bmSource){
+      return false;
+    }
+    for (ui32FirstRow = 0 ; ui32FirstRow < bmSource->ui32AmountOfRows ; ui32FirstRow = ui32FirstRow + 64){
+      for (ui32WordColumn = 0 ; ui32WordColumn < bmSource->ui32WordsPerRow ; ui32WordColumn++){
+        __BitMatrix_loadBlock(bmSource, ui32FirstRow, ui32WordColumn, ui64Block);
+        BitMatrix_transposeBlock(ui64Block);
+        for (ui32Counter = 0 ; ui32Counter < 64 && (ui32WordColumn * 64 + ui32Counter) < bmDestination->ui32AmountOfRows ; ui32Counter++){
+          bmDestination->ui64pWords[(uint64_t) (ui32WordColumn * 64 + ui32Counter) * bmDestination->ui32WordsPerRow + (ui32FirstRow >> 6)] = ui64Block[ui32Counter];
+        }
+      }
+    }
+    return true;
+  }
+
+  //! Function: Bit Matrix-Vector Product over GF(2)
+  /*!
+    Multiplies a bit matrix by a bit vector over GF(2): the bit r of the result is the parity of the AND of the row r and the vector.
+    \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+    \param bvVector is a bitvector_t pointer. It's the vector, with the matrix amount of columns bits.
+    \param bvResult is a bitvector_t pointer. It's the result, with the matrix amount of rows bits.
+  */
+  void BitMatrix_multiplyVector(bitmatrix_t bmMatrix, const bitvector_t* bvVector, bitvector_t* bvResult){
+    uint32_t ui32AmountOfBytes = BitVector_getSize(bmMatrix->ui32AmountOfColumns);
+    uint32_t ui32Row = 0;
+    uint32_t ui32WordColumn = 0;
+    for (ui32Row = 0 ; ui32Row < bmMatrix->ui32AmountOfRows ; ui32Row++){
+      const uint64_t* ui64pRow = &bmMatrix->ui64pWords[(uint64_t) ui32Row * bmMatrix->ui32WordsPerRow];
+      uint64_t ui64Parity = 0;
+      for (ui32WordColumn = 0 ; ui32WordColumn < bmMatrix->ui32WordsPerRow ; ui32WordColumn++){
+        ui64Parity = ui64Parity ^ (ui64pRow[ui32WordColumn] & __BitMatrix_loadVectorWord(bvVector, ui32AmountOfBytes, ui32WordColumn));
+      }
+      if ((__BitMatrix_countOnes(ui64Parity) & 1) != 0){
+        BitVector_setBit(bvResult, ui32Row);
+      }
+      else{
+        BitVector_clearBit(bvResult, ui32Row);
+      }
+    }
+  }
+
+  //! Function: Bit Matrix Column Counter
+  /*!
+    Counts the set bits of a column.
+    \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+    \param ui32Column is a unsigned 32-bit integer. It's the column.
+    \return Returns the amount of set bits.
+  */
+  uint32_t BitMatrix_countColumn(bitmatrix_t bmMatrix, uint32_t ui32Column){
+    uint32_t ui32AmountOfOnes = 0;
+    uint32_t ui32Row = 0;
+    for (ui32Row = 0 ; ui32Row < bmMatrix->ui32AmountOfRows ; ui32Row++){
+      ui32AmountOfOnes = ui32AmountOfOnes + BitMatrix_readBit(bmMatrix, ui32Row, ui32Column);
+    }
+    return ui32AmountOfOnes;
+  }
+
+  //! Function: Bit Matrix All Columns Counter
+  /*!
+    Counts the set bits of each column. Each 64x64 block is transposed, so the bits of a column become a word and are counted by one population count.
+    \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+    \param ui32pCounts is a unsigned 32-bit integer pointer. It's the array (one value for each column) where the amounts will be saved.
+  */
+  void BitMatrix_countColumns(bitmatrix_t bmMatrix, uint32_t* ui32pCounts){
+    uint64_t ui64Block[64];
+    uint32_t ui32FirstRow = 0;
+    uint32_t ui32WordColumn = 0;
+    uint32_t ui32Counter = 0;
+    memset(ui32pCounts, 0, bmMatrix->ui32AmountOfColumns * sizeof(uint32_t));
+    for (ui32FirstRow = 0 ; ui32FirstRow < bmMatrix->ui32AmountOfRows ; ui32FirstRow = ui32FirstRow + 64){
+      for (ui32WordColumn = 0 ; ui32WordColumn < bmMatrix->ui32WordsPerRow ; ui32WordColumn++){
+        __BitMatrix_loadBlock(bmMatrix, ui32FirstRow, ui32WordColumn, ui64Block);
+        BitMatrix_transposeBlock(ui64Block);
+        for (ui32Counter = 0 ; ui32Counter < 64 && (ui32WordColumn * 64 + ui32Counter) < bmMatrix->ui32AmountOfColumns ; ui32Counter++){
+          ui32pCounts[ui32WordColumn * 64 + ui32Counter] = ui32pCounts[ui32WordColumn * 64 + ui32Counter] + __BitMatrix_countOnes(ui64Block[ui32Counter]);
+        }
+      }
+    }
+  }
+
+#endif
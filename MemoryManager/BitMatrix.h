@@ -0,0 +1,188 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __BIT_MATRIX_HEADER__
+  #define __BIT_MATRIX_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+
+    //! Type Definition: Bit Matrix Structure
+    /*!
+      Matrix of bits saved row-major. Each row starts at a 64-bit word, and the bit c of a row is the bit (c % 64) of its word (c / 64). The bits after the last column of each row are always 0.
+    */
+    typedef struct {
+      uint64_t* const ui64pWords;                                                                                                   /*!< const 64-bits integer pointer type. */
+      const uint32_t ui32AmountOfRows;                                                                                              /*!< const 32-bits integer type. */
+      const uint32_t ui32AmountOfColumns;                                                                                           /*!< const 32-bits integer type. */
+      const uint32_t ui32WordsPerRow;                                                                                               /*!< const 32-bits integer type. */
+    } bitmatrix_structure_t;
+
+    //! Type Definition: Bit Matrix Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef bitmatrix_structure_t* bitmatrix_t;
+
+    //! Macros: Bit Matrix Sizes
+    /*!
+      Calculate the amount of 64-bit words of each row and of the whole matrix.
+      \param uiAmountOfRows is a unsigned integer. It's the amount of rows.
+      \param uiAmountOfColumns is a unsigned integer. It's the amount of columns.
+      \return Returns the amount of words.
+    */
+    #define BitMatrix_getWordsPerRow(uiAmountOfColumns)\
+      ((uint32_t) ((((uint64_t) (uiAmountOfColumns)) + 63) >> 6))
+
+    #define BitMatrix_getSize(uiAmountOfRows, uiAmountOfColumns)\
+      ((uint64_t) (uiAmountOfRows) * BitMatrix_getWordsPerRow(uiAmountOfColumns))
+
+    //! Macro: Bit Matrix Creator
+    /*!
+      This macro creates a bit matrix with all bits cleared.
+      \param bmName is the bit matrix name.
+      \param uiAmountOfRows is a unsigned integer. It's the amount of rows.
+      \param uiAmountOfColumns is a unsigned integer. It's the amount of columns.
+    */
+    #define newBitMatrix(bmName, uiAmountOfRows, uiAmountOfColumns)\
+      uint64_t __ui64BitMatrixWords##bmName[BitMatrix_getSize(uiAmountOfRows, uiAmountOfColumns)] = {0};\
+      bitmatrix_structure_t __bmsBitMatrix##bmName = {\
+        .ui64pWords = __ui64BitMatrixWords##bmName,\
+        .ui32AmountOfRows = uiAmountOfRows,\
+        .ui32AmountOfColumns = uiAmountOfColumns,\
+        .ui32WordsPerRow = BitMatrix_getWordsPerRow(uiAmountOfColumns)\
+      };\
+      bitmatrix_t bmName = &__bmsBitMatrix##bmName
+
+    //! Macro: Static Bit Matrix Creator
+    /*!
+      This macro creates a static bit matrix with all bits cleared.
+      \param bmName is the bit matrix name.
+      \param uiAmountOfRows is a unsigned integer. It's the amount of rows.
+      \param uiAmountOfColumns is a unsigned integer. It's the amount of columns.
+    */
+    #define newStaticBitMatrix(bmName, uiAmountOfRows, uiAmountOfColumns)\
+      static uint64_t __ui64BitMatrixWords##bmName[BitMatrix_getSize(uiAmountOfRows, uiAmountOfColumns)] = {0};\
+      static bitmatrix_structure_t __bmsBitMatrix##bmName = {\
+        .ui64pWords = __ui64BitMatrixWords##bmName,\
+        .ui32AmountOfRows = uiAmountOfRows,\
+        .ui32AmountOfColumns = uiAmountOfColumns,\
+        .ui32WordsPerRow = BitMatrix_getWordsPerRow(uiAmountOfColumns)\
+      };\
+      static bitmatrix_t bmName = &__bmsBitMatrix##bmName
+
+    //! Macro: Bit Matrix Row
+    /*!
+      Gets a row of a bit matrix as a bit vector (on little-endian processors), to be used by the BitVector functions.
+      \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+      \param uiRow is a unsigned integer. It's the row.
+      \return Returns a bitvector_t pointer.
+    */
+    #define BitMatrix_getRow(bmMatrix, uiRow)\
+      ((bitvector_t*) &(bmMatrix)->ui64pWords[(uint64_t) (uiRow) * (bmMatrix)->ui32WordsPerRow])
+
+    //! Macros: Bit Matrix Bit Access
+    /*!
+      Set, clear and read a bit of a bit matrix.
+      \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+      \param uiRow is a unsigned integer. It's the row.
+      \param uiColumn is a unsigned integer. It's the column.
+    */
+    #define __BitMatrix_getWord(bmMatrix, uiRow, uiColumn)\
+      ((bmMatrix)->ui64pWords[(uint64_t) (uiRow) * (bmMatrix)->ui32WordsPerRow + ((uiColumn) >> 6)])
+
+    #define BitMatrix_setBit(bmMatrix, uiRow, uiColumn)\
+      (__BitMatrix_getWord(bmMatrix, uiRow, uiColumn) |= ((uint64_t) 1 << ((uiColumn) & 63)))
+
+    #define BitMatrix_clearBit(bmMatrix, uiRow, uiColumn)\
+      (__BitMatrix_getWord(bmMatrix, uiRow, uiColumn) &= ~((uint64_t) 1 << ((uiColumn) & 63)))
+
+    #define BitMatrix_readBit(bmMatrix, uiRow, uiColumn)\
+      ((uint8_t) ((__BitMatrix_getWord(bmMatrix, uiRow, uiColumn) >> ((uiColumn) & 63)) & 1))
+
+    //! Macros: Bit Matrix Row Operations
+    /*!
+      Apply a boolean operation between a row and a bit vector with the same amount of columns (another row, for example). They use the SIMD kernels of the BitVector functions.
+      \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+      \param uiRow is a unsigned integer. It's the changed row.
+      \param bvOperand is a bitvector_t pointer. It's the other operand.
+    */
+    #define BitMatrix_andRow(bmMatrix, uiRow, bvOperand)\
+      BitVector_and(BitMatrix_getRow(bmMatrix, uiRow), BitMatrix_getRow(bmMatrix, uiRow), bvOperand, (bmMatrix)->ui32AmountOfColumns)
+
+    #define BitMatrix_orRow(bmMatrix, uiRow, bvOperand)\
+      BitVector_or(BitMatrix_getRow(bmMatrix, uiRow), BitMatrix_getRow(bmMatrix, uiRow), bvOperand, (bmMatrix)->ui32AmountOfColumns)
+
+    #define BitMatrix_xorRow(bmMatrix, uiRow, bvOperand)\
+      BitVector_xor(BitMatrix_getRow(bmMatrix, uiRow), BitMatrix_getRow(bmMatrix, uiRow), bvOperand, (bmMatrix)->ui32AmountOfColumns)
+
+    #define BitMatrix_andNotRow(bmMatrix, uiRow, bvOperand)\
+      BitVector_andNot(BitMatrix_getRow(bmMatrix, uiRow), BitMatrix_getRow(bmMatrix, uiRow), bvOperand, (bmMatrix)->ui32AmountOfColumns)
+
+    //! Macro: Bit Matrix Row Counter
+    /*!
+      Counts the set bits of a row.
+      \param bmMatrix is a bitmatrix_t type. It's the bit matrix.
+      \param uiRow is a unsigned integer. It's the row.
+      \return Returns the amount of set bits.
+    */
+    #define BitMatrix_countRow(bmMatrix, uiRow)\
+      BitVector_countOnes(BitMatrix_getRow(bmMatrix, uiRow), (bmMatrix)->ui32AmountOfColumns)
+
+    void BitMatrix_clear(bitmatrix_t bmMatrix);                                                                                     /*!< void type function. */
+    bool BitMatrix_and(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB);                                    /*!< bool type function. */
+    bool BitMatrix_or(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB);                                     /*!< bool type function. */
+    bool BitMatrix_xor(bitmatrix_t bmDestination, bitmatrix_t bmMatrixA, bitmatrix_t bmMatrixB);                                    /*!< bool type function. */
+    void BitMatrix_transposeBlock(uint64_t* ui64pBlock);                                                                            /*!< void type function. */
+    bool BitMatrix_transpose(bitmatrix_t bmDestination, bitmatrix_t bmSource);                                                      /*!< bool type function. */
+    void BitMatrix_multiplyVector(bitmatrix_t bmMatrix, const bitvector_t* bvVector, bitvector_t* bvResult);                       /*!< void type function. */
+    uint32_t BitMatrix_countColumn(bitmatrix_t bmMatrix, uint32_t ui32Column);                                                      /*!< 32-bits integer type function. */
+    void BitMatrix_countColumns(bitmatrix_t bmMatrix, uint32_t* ui32pCounts);                                                       /*!< void type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
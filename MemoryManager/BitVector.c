@@ -0,0 +1,730 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./BitVector.h"
+  #include <string.h>
+
+  #if defined(__BIT_VECTOR_SIMD_ENABLE__) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define __BIT_VECTOR_X86_SIMD__
+    #include <immintrin.h>
+  #endif
+
+  //! Enumeration Definition: Bit Vector Operation
+  /*!
+    Boolean operations of the bulk kernels.
+  */
+  typedef enum{
+    BIT_VECTOR_OPERATION_AND = 0,
+    BIT_VECTOR_OPERATION_OR,
+    BIT_VECTOR_OPERATION_XOR,
+    BIT_VECTOR_OPERATION_AND_NOT
+  } bitvector_operation_t;
+
+  //! Type Definition: Bulk Operation Kernel
+  /*!
+    A kernel applies a boolean operation on the first bytes of the bit vectors and returns the amount of processed bytes.
+  */
+  typedef uint32_t (*bitvector_operation_kernel_t)(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBytes, bitvector_operation_t boOperation);
+
+  //! Type Definition: Population Count Kernel
+  /*!
+    A kernel counts the set bits of the first bytes of a bit vector and saves the amount of processed bytes.
+  */
+  typedef uint32_t (*bitvector_count_kernel_t)(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBytes, uint32_t* ui32pProcessedBytes);
+
+  //! Macro: Word Size in Bytes
+  /*!
+    Amount of bytes of a bitvector_word_t.
+  */
+  #define __BIT_VECTOR_WORD_BYTES__ (__BIT_VECTOR_WORD_SIZE__ >> 3)
+
+  //! Macro: All Bits Word
+  /*!
+    A bitvector_word_t with all bits set.
+  */
+  #define __BIT_VECTOR_WORD_ONES__ ((bitvector_word_t) ~((bitvector_word_t) 0))
+
+  //! Macros: Bit Scan Intrinsics
+  /*!
+    Count trailing zeros and population count of a bitvector_word_t. The compiler builtins become single instructions when the processor has them.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #if (__BIT_VECTOR_WORD_SIZE__ == 64)
+      #define __BitVector_countTrailingZeros(bwWord) ((uint32_t) __builtin_ctzll(bwWord))
+      #define __BitVector_countOnesOfWord(bwWord) ((uint32_t) __builtin_popcountll(bwWord))
+    #else
+      #define __BitVector_countTrailingZeros(bwWord) ((uint32_t) __builtin_ctz((unsigned int) (bwWord)))
+      #define __BitVector_countOnesOfWord(bwWord) ((uint32_t) __builtin_popcount((unsigned int) (bwWord)))
+    #endif
+  #else
+    static uint32_t __BitVector_countTrailingZeros(bitvector_word_t bwWord){
+      uint32_t ui32Counter = 0;
+      while ((bwWord & 1) == 0){
+        bwWord = bwWord >> 1;
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+
+    static uint32_t __BitVector_countOnesOfWord(bitvector_word_t bwWord){
+      uint32_t ui32Counter = 0;
+      while (bwWord != 0){
+        bwWord = bwWord & (bwWord - 1);
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+  #endif
+
+  //! Private Function: Bit Vector Word Loader
+  /*!
+    Loads a word of a bit vector. The bit n of the word is the bit (ui32WordPosition * __BIT_VECTOR_WORD_SIZE__ + n) of the bit vector. Bytes after the end of the bit vector are read as 0.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBytes is a unsigned 32-bit integer. It's the amount of bytes of the bit vector.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  static inline bitvector_word_t __BitVector_loadWord(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBytes, uint32_t ui32WordPosition){
+    uint32_t ui32FirstByte = ui32WordPosition * __BIT_VECTOR_WORD_BYTES__;
+    bitvector_word_t bwWord = 0;
+    uint32_t ui32Counter = 0;
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      if (ui32FirstByte + __BIT_VECTOR_WORD_BYTES__ <= ui32AmountOfBytes){
+        memcpy(&bwWord, &bvBitVector[ui32FirstByte], __BIT_VECTOR_WORD_BYTES__);
+        return bwWord;
+      }
+    #endif
+    for (ui32Counter = 0 ; ui32Counter < __BIT_VECTOR_WORD_BYTES__ && (ui32FirstByte + ui32Counter) < ui32AmountOfBytes ; ui32Counter++){
+      bwWord = bwWord | (bitvector_word_t) ((bitvector_word_t) bvBitVector[ui32FirstByte + ui32Counter] << (ui32Counter << 3));
+    }
+    return bwWord;
+  }
+
+  //! Private Function: Bit Vector Scanner
+  /*!
+    Finds the next bit with a given value, a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \param bwInvertMask is a bitvector_word_t. It's 0 to find a set bit or __BIT_VECTOR_WORD_ONES__ to find a clear bit.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  static inline uint32_t __BitVector_findNext(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition, bitvector_word_t bwInvertMask){
+    if (ui32StartPosition >= ui32AmountOfBits){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    uint32_t ui32AmountOfBytes = BitVector_getSize(ui32AmountOfBits);
+    uint32_t ui32AmountOfWords = ((ui32AmountOfBits - 1) / __BIT_VECTOR_WORD_SIZE__) + 1;
+    uint32_t ui32WordPosition = ui32StartPosition / __BIT_VECTOR_WORD_SIZE__;
+    bitvector_word_t bwWord = __BitVector_loadWord(bvBitVector, ui32AmountOfBytes, ui32WordPosition) ^ bwInvertMask;
+    bwWord = bwWord & (bitvector_word_t) (__BIT_VECTOR_WORD_ONES__ << (ui32StartPosition % __BIT_VECTOR_WORD_SIZE__));
+    while (bwWord == 0){
+      ui32WordPosition++;
+      if (ui32WordPosition >= ui32AmountOfWords){
+        return BIT_VECTOR_NOT_FOUND;
+      }
+      bwWord = __BitVector_loadWord(bvBitVector, ui32AmountOfBytes, ui32WordPosition) ^ bwInvertMask;
+    }
+    ui32StartPosition = ui32WordPosition * __BIT_VECTOR_WORD_SIZE__ + __BitVector_countTrailingZeros(bwWord);
+    return ((ui32StartPosition < ui32AmountOfBits) ? ui32StartPosition : BIT_VECTOR_NOT_FOUND);
+  }
+
+  //! Macro: Bulk Operation Loop
+  /*!
+    Expands a loop for each boolean operation, so the operation is not checked inside the loops.
+  */
+  #define __BitVector_operationLoops(xStep, xLoad, xStore, xAnd, xOr, xXor, xAndNot)\
+    switch (boOperation){\
+      case BIT_VECTOR_OPERATION_AND:\
+        for (ui32Counter = 0 ; ui32Counter + (xStep) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + (xStep)){\
+          xStore(&bvDestination[ui32Counter], xAnd(xLoad(&bvBitVectorA[ui32Counter]), xLoad(&bvBitVectorB[ui32Counter])));\
+        }\
+        break;\
+      case BIT_VECTOR_OPERATION_OR:\
+        for (ui32Counter = 0 ; ui32Counter + (xStep) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + (xStep)){\
+          xStore(&bvDestination[ui32Counter], xOr(xLoad(&bvBitVectorA[ui32Counter]), xLoad(&bvBitVectorB[ui32Counter])));\
+        }\
+        break;\
+      case BIT_VECTOR_OPERATION_XOR:\
+        for (ui32Counter = 0 ; ui32Counter + (xStep) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + (xStep)){\
+          xStore(&bvDestination[ui32Counter], xXor(xLoad(&bvBitVectorA[ui32Counter]), xLoad(&bvBitVectorB[ui32Counter])));\
+        }\
+        break;\
+      default:\
+        for (ui32Counter = 0 ; ui32Counter + (xStep) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + (xStep)){\
+          xStore(&bvDestination[ui32Counter], xAndNot(xLoad(&bvBitVectorA[ui32Counter]), xLoad(&bvBitVectorB[ui32Counter])));\
+        }\
+        break;\
+    }
+
+  //! Macros: Word Operations
+  /*!
+    Unaligned load and store of a bitvector_word_t and its boolean operations.
+  */
+  #define __BitVector_andWord(bwWordA, bwWordB) ((bwWordA) & (bwWordB))
+  #define __BitVector_orWord(bwWordA, bwWordB) ((bwWordA) | (bwWordB))
+  #define __BitVector_xorWord(bwWordA, bwWordB) ((bwWordA) ^ (bwWordB))
+  #define __BitVector_andNotWord(bwWordA, bwWordB) ((bwWordA) & (bitvector_word_t) ~(bwWordB))
+
+  static inline bitvector_word_t __BitVector_loadUnalignedWord(const bitvector_t* bvAddress){
+    bitvector_word_t bwWord;
+    memcpy(&bwWord, bvAddress, sizeof(bitvector_word_t));
+    return bwWord;
+  }
+
+  static inline void __BitVector_storeUnalignedWord(bitvector_t* bvAddress, bitvector_word_t bwWord){
+    memcpy(bvAddress, &bwWord, sizeof(bitvector_word_t));
+  }
+
+  //! Private Function: Word Bulk Operation Kernel
+  /*!
+    Applies a boolean operation a bitvector_word_t at a time. Bytes order doesn't matter here, so this kernel works on any processor.
+  */
+  static uint32_t __BitVector_operateWords(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBytes, bitvector_operation_t boOperation){
+    uint32_t ui32Counter = 0;
+    __BitVector_operationLoops(sizeof(bitvector_word_t), __BitVector_loadUnalignedWord, __BitVector_storeUnalignedWord, __BitVector_andWord, __BitVector_orWord, __BitVector_xorWord, __BitVector_andNotWord);
+    return ui32Counter;
+  }
+
+  //! Private Function: Word Population Count Kernel
+  /*!
+    Counts the set bits a bitvector_word_t at a time.
+  */
+  static uint32_t __BitVector_countWords(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBytes, uint32_t* ui32pProcessedBytes){
+    uint32_t ui32Counter = 0;
+    uint32_t ui32AmountOfOnes = 0;
+    for (ui32Counter = 0 ; ui32Counter + sizeof(bitvector_word_t) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + sizeof(bitvector_word_t)){
+      ui32AmountOfOnes = ui32AmountOfOnes + __BitVector_countOnesOfWord(__BitVector_loadUnalignedWord(&bvBitVector[ui32Counter]));
+    }
+    *ui32pProcessedBytes = ui32Counter;
+    return ui32AmountOfOnes;
+  }
+
+  #if defined(__BIT_VECTOR_X86_SIMD__)
+    //! Macros: SSE2 Operations
+    /*!
+      Unaligned load and store of 128-bit vectors and its boolean operations.
+    */
+    #define __BitVector_loadSSE2(bvAddress) _mm_loadu_si128((const __m128i*) (bvAddress))
+    #define __BitVector_storeSSE2(bvAddress, xVector) _mm_storeu_si128((__m128i*) (bvAddress), xVector)
+    #define __BitVector_andNotSSE2(xVectorA, xVectorB) _mm_andnot_si128(xVectorB, xVectorA)
+
+    //! Private Function: SSE2 Bulk Operation Kernel
+    /*!
+      Applies a boolean operation 128 bits at a time.
+    */
+    __attribute__((target("sse2"))) static uint32_t __BitVector_operateSSE2(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBytes, bitvector_operation_t boOperation){
+      uint32_t ui32Counter = 0;
+      __BitVector_operationLoops(16, __BitVector_loadSSE2, __BitVector_storeSSE2, _mm_and_si128, _mm_or_si128, _mm_xor_si128, __BitVector_andNotSSE2);
+      return ui32Counter;
+    }
+
+    //! Macros: AVX2 Operations
+    /*!
+      Unaligned load and store of 256-bit vectors and its boolean operations.
+    */
+    #define __BitVector_loadAVX2(bvAddress) _mm256_loadu_si256((const __m256i*) (bvAddress))
+    #define __BitVector_storeAVX2(bvAddress, xVector) _mm256_storeu_si256((__m256i*) (bvAddress), xVector)
+    #define __BitVector_andNotAVX2(xVectorA, xVectorB) _mm256_andnot_si256(xVectorB, xVectorA)
+
+    //! Private Function: AVX2 Bulk Operation Kernel
+    /*!
+      Applies a boolean operation 256 bits at a time.
+    */
+    __attribute__((target("avx2"))) static uint32_t __BitVector_operateAVX2(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBytes, bitvector_operation_t boOperation){
+      uint32_t ui32Counter = 0;
+      __BitVector_operationLoops(32, __BitVector_loadAVX2, __BitVector_storeAVX2, _mm256_and_si256, _mm256_or_si256, _mm256_xor_si256, __BitVector_andNotAVX2);
+      return ui32Counter;
+    }
+
+    //! Private Function: POPCNT Population Count Kernel
+    /*!
+      Counts the set bits 64 bits at a time with the POPCNT instruction.
+    */
+    __attribute__((target("popcnt"))) static uint32_t __BitVector_countPOPCNT(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBytes, uint32_t* ui32pProcessedBytes){
+      uint32_t ui32Counter = 0;
+      uint32_t ui32AmountOfOnes = 0;
+      uint64_t ui64Word = 0;
+      for (ui32Counter = 0 ; ui32Counter + sizeof(uint64_t) <= ui32AmountOfBytes ; ui32Counter = ui32Counter + sizeof(uint64_t)){
+        memcpy(&ui64Word, &bvBitVector[ui32Counter], sizeof(uint64_t));
+        ui32AmountOfOnes = ui32AmountOfOnes + (uint32_t) __builtin_popcountll(ui64Word);
+      }
+      *ui32pProcessedBytes = ui32Counter;
+      return ui32AmountOfOnes;
+    }
+  #endif
+
+  //! Variables: Selected Kernels
+  /*!
+    Kernels selected at the first bulk operation, according to the processor features.
+  */
+  static bitvector_operation_kernel_t __bokBitVectorOperationKernel = NULL;
+  static bitvector_count_kernel_t __bckBitVectorCountKernel = NULL;
+
+  //! Macros: Selected Kernels Access
+  /*!
+    Several threads can run their first bulk operation at the same time. All of them select the same kernels, so it's enough that the kernel pointers are read and written atomically.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __BitVector_loadKernel(xKernel)\
+      __atomic_load_n(&(xKernel), __ATOMIC_ACQUIRE)
+    #define __BitVector_storeKernel(xKernel, xValue)\
+      __atomic_store_n(&(xKernel), (xValue), __ATOMIC_RELEASE)
+  #else
+    #define __BitVector_loadKernel(xKernel)\
+      (xKernel)
+    #define __BitVector_storeKernel(xKernel, xValue)\
+      (xKernel) = (xValue)
+  #endif
+
+  //! Private Function: Kernels Selector
+  /*!
+    Selects the fastest kernels available on the processor.
+  */
+  static void __BitVector_selectKernels(void){
+    bitvector_operation_kernel_t bokOperationKernel = __BitVector_operateWords;
+    bitvector_count_kernel_t bckCountKernel = __BitVector_countWords;
+    #if defined(__BIT_VECTOR_X86_SIMD__)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")){
+        bokOperationKernel = __BitVector_operateAVX2;
+      }
+      else if (__builtin_cpu_supports("sse2")){
+        bokOperationKernel = __BitVector_operateSSE2;
+      }
+      if (__builtin_cpu_supports("popcnt")){
+        bckCountKernel = __BitVector_countPOPCNT;
+      }
+    #endif
+    __BitVector_storeKernel(__bckBitVectorCountKernel, bckCountKernel);
+    __BitVector_storeKernel(__bokBitVectorOperationKernel, bokOperationKernel);
+  }
+
+  //! Private Function: Bulk Operation Kernel Getter
+  /*!
+    Gets the selected bulk operation kernel, selecting the kernels on the first call.
+  */
+  static bitvector_operation_kernel_t __BitVector_getOperationKernel(void){
+    bitvector_operation_kernel_t bokOperationKernel = __BitVector_loadKernel(__bokBitVectorOperationKernel);
+    if (bokOperationKernel == NULL){
+      __BitVector_selectKernels();
+      bokOperationKernel = __BitVector_loadKernel(__bokBitVectorOperationKernel);
+    }
+    return bokOperationKernel;
+  }
+
+  //! Private Function: Population Count Kernel Getter
+  /*!
+    Gets the selected population count kernel, selecting the kernels on the first call.
+  */
+  static bitvector_count_kernel_t __BitVector_getCountKernel(void){
+    bitvector_count_kernel_t bckCountKernel = __BitVector_loadKernel(__bckBitVectorCountKernel);
+    if (bckCountKernel == NULL){
+      __BitVector_selectKernels();
+      bckCountKernel = __BitVector_loadKernel(__bckBitVectorCountKernel);
+    }
+    return bckCountKernel;
+  }
+
+  //! Private Function: Bulk Operation
+  /*!
+    Applies a boolean operation on two bit vectors. The bits of the destination after ui32AmountOfBits are not changed.
+  */
+  static void __BitVector_operate(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits, bitvector_operation_t boOperation){
+    uint32_t ui32AmountOfBytes = ui32AmountOfBits >> 3;
+    uint32_t ui32Counter = 0;
+    bitvector_t bvLastByte = 0;
+    ui32Counter = __BitVector_getOperationKernel()(bvDestination, bvBitVectorA, bvBitVectorB, ui32AmountOfBytes, boOperation);
+    ui32Counter = ui32Counter + __BitVector_operateWords(&bvDestination[ui32Counter], &bvBitVectorA[ui32Counter], &bvBitVectorB[ui32Counter], ui32AmountOfBytes - ui32Counter, boOperation);
+    for ( ; ui32Counter < ui32AmountOfBytes || (ui32Counter == ui32AmountOfBytes && (ui32AmountOfBits & 7) != 0) ; ui32Counter++){
+      switch (boOperation){
+        case BIT_VECTOR_OPERATION_AND:
+          bvLastByte = bvBitVectorA[ui32Counter] & bvBitVectorB[ui32Counter];
+          break;
+        case BIT_VECTOR_OPERATION_OR:
+          bvLastByte = bvBitVectorA[ui32Counter] | bvBitVectorB[ui32Counter];
+          break;
+        case BIT_VECTOR_OPERATION_XOR:
+          bvLastByte = bvBitVectorA[ui32Counter] ^ bvBitVectorB[ui32Counter];
+          break;
+        default:
+          bvLastByte = bvBitVectorA[ui32Counter] & (bitvector_t) ~bvBitVectorB[ui32Counter];
+          break;
+      }
+      if (ui32Counter < ui32AmountOfBytes){
+        bvDestination[ui32Counter] = bvLastByte;
+      }
+      else if ((ui32AmountOfBits & 7) != 0){
+        bitvector_t bvMask = (bitvector_t) ((1U << (ui32AmountOfBits & 7)) - 1);
+        bvDestination[ui32Counter] = (bitvector_t) ((bvDestination[ui32Counter] & ~bvMask) | (bvLastByte & bvMask));
+      }
+    }
+  }
+
+  //! Function: Bit Vector AND
+  /*!
+    Makes bvDestination = bvBitVectorA AND bvBitVectorB. The destination can be one of the operands.
+    \param bvDestination is a bit_vector_t type. It's the result bit vector.
+    \param bvBitVectorA is a bit_vector_t type. It's the first operand.
+    \param bvBitVectorB is a bit_vector_t type. It's the second operand.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vectors.
+  */
+  void BitVector_and(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits){
+    __BitVector_operate(bvDestination, bvBitVectorA, bvBitVectorB, ui32AmountOfBits, BIT_VECTOR_OPERATION_AND);
+  }
+
+  //! Function: Bit Vector OR
+  /*!
+    Makes bvDestination = bvBitVectorA OR bvBitVectorB. The destination can be one of the operands.
+    \param bvDestination is a bit_vector_t type. It's the result bit vector.
+    \param bvBitVectorA is a bit_vector_t type. It's the first operand.
+    \param bvBitVectorB is a bit_vector_t type. It's the second operand.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vectors.
+  */
+  void BitVector_or(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits){
+    __BitVector_operate(bvDestination, bvBitVectorA, bvBitVectorB, ui32AmountOfBits, BIT_VECTOR_OPERATION_OR);
+  }
+
+  //! Function: Bit Vector XOR
+  /*!
+    Makes bvDestination = bvBitVectorA XOR bvBitVectorB. The destination can be one of the operands.
+    \param bvDestination is a bit_vector_t type. It's the result bit vector.
+    \param bvBitVectorA is a bit_vector_t type. It's the first operand.
+    \param bvBitVectorB is a bit_vector_t type. It's the second operand.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vectors.
+  */
+  void BitVector_xor(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits){
+    __BitVector_operate(bvDestination, bvBitVectorA, bvBitVectorB, ui32AmountOfBits, BIT_VECTOR_OPERATION_XOR);
+  }
+
+  //! Function: Bit Vector AND NOT
+  /*!
+    Makes bvDestination = bvBitVectorA AND NOT bvBitVectorB. The destination can be one of the operands.
+    \param bvDestination is a bit_vector_t type. It's the result bit vector.
+    \param bvBitVectorA is a bit_vector_t type. It's the first operand.
+    \param bvBitVectorB is a bit_vector_t type. It's the second operand.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vectors.
+  */
+  void BitVector_andNot(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits){
+    __BitVector_operate(bvDestination, bvBitVectorA, bvBitVectorB, ui32AmountOfBits, BIT_VECTOR_OPERATION_AND_NOT);
+  }
+
+  //! Function: Bit Vector Range Setter
+  /*!
+    Sets a range of bits of a bit vector. The whole bytes are written by memset.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position of the range.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the range.
+  */
+  void BitVector_setRange(bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits){
+    if (ui32AmountOfBits == 0){
+      return;
+    }
+    uint32_t ui32LastPosition = ui32StartPosition + ui32AmountOfBits - 1;
+    uint32_t ui32FirstByte = ui32StartPosition >> 3;
+    uint32_t ui32LastByte = ui32LastPosition >> 3;
+    bitvector_t bvFirstMask = (bitvector_t) (0xFF << (ui32StartPosition & 7));
+    bitvector_t bvLastMask = (bitvector_t) (0xFF >> (7 - (ui32LastPosition & 7)));
+    if (ui32FirstByte == ui32LastByte){
+      bvBitVector[ui32FirstByte] = bvBitVector[ui32FirstByte] | (bvFirstMask & bvLastMask);
+      return;
+    }
+    bvBitVector[ui32FirstByte] = bvBitVector[ui32FirstByte] | bvFirstMask;
+    memset(&bvBitVector[ui32FirstByte + 1], 0xFF, ui32LastByte - ui32FirstByte - 1);
+    bvBitVector[ui32LastByte] = bvBitVector[ui32LastByte] | bvLastMask;
+  }
+
+  //! Function: Bit Vector Range Eraser
+  /*!
+    Erases a range of bits of a bit vector. The whole bytes are written by memset.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position of the range.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the range.
+  */
+  void BitVector_clearRange(bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits){
+    if (ui32AmountOfBits == 0){
+      return;
+    }
+    uint32_t ui32LastPosition = ui32StartPosition + ui32AmountOfBits - 1;
+    uint32_t ui32FirstByte = ui32StartPosition >> 3;
+    uint32_t ui32LastByte = ui32LastPosition >> 3;
+    bitvector_t bvFirstMask = (bitvector_t) (0xFF << (ui32StartPosition & 7));
+    bitvector_t bvLastMask = (bitvector_t) (0xFF >> (7 - (ui32LastPosition & 7)));
+    if (ui32FirstByte == ui32LastByte){
+      bvBitVector[ui32FirstByte] = bvBitVector[ui32FirstByte] & (bitvector_t) ~(bvFirstMask & bvLastMask);
+      return;
+    }
+    bvBitVector[ui32FirstByte] = bvBitVector[ui32FirstByte] & (bitvector_t) ~bvFirstMask;
+    memset(&bvBitVector[ui32FirstByte + 1], 0x00, ui32LastByte - ui32FirstByte - 1);
+    bvBitVector[ui32LastByte] = bvBitVector[ui32LastByte] & (bitvector_t) ~bvLastMask;
+  }
+
+  //! Function: Bit Vector Range Counter
+  /*!
+    Counts the set bits of a range of a bit vector (population count).
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position of the range.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the range.
+    \return Returns the amount of set bits.
+  */
+  uint32_t BitVector_countRange(const bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits){
+    if (ui32AmountOfBits == 0){
+      return 0;
+    }
+    uint32_t ui32LastPosition = ui32StartPosition + ui32AmountOfBits - 1;
+    uint32_t ui32FirstByte = ui32StartPosition >> 3;
+    uint32_t ui32LastByte = ui32LastPosition >> 3;
+    uint32_t ui32ProcessedBytes = 0;
+    uint32_t ui32AmountOfOnes = 0;
+    bitvector_t bvFirstMask = (bitvector_t) (0xFF << (ui32StartPosition & 7));
+    bitvector_t bvLastMask = (bitvector_t) (0xFF >> (7 - (ui32LastPosition & 7)));
+    if (ui32FirstByte == ui32LastByte){
+      return __BitVector_countOnesOfWord((bitvector_word_t) (bvBitVector[ui32FirstByte] & bvFirstMask & bvLastMask));
+    }
+    ui32AmountOfOnes = __BitVector_countOnesOfWord((bitvector_word_t) (bvBitVector[ui32FirstByte] & bvFirstMask)) + __BitVector_countOnesOfWord((bitvector_word_t) (bvBitVector[ui32LastByte] & bvLastMask));
+    ui32FirstByte++;
+    ui32AmountOfOnes = ui32AmountOfOnes + __BitVector_getCountKernel()(&bvBitVector[ui32FirstByte], ui32LastByte - ui32FirstByte, &ui32ProcessedBytes);
+    for (ui32FirstByte = ui32FirstByte + ui32ProcessedBytes ; ui32FirstByte < ui32LastByte ; ui32FirstByte++){
+      ui32AmountOfOnes = ui32AmountOfOnes + __BitVector_countOnesOfWord((bitvector_word_t) bvBitVector[ui32FirstByte]);
+    }
+    return ui32AmountOfOnes;
+  }
+
+  //! Function: Bit Vector Word Reader
+  /*!
+    Reads a word of a bit vector. The bit n of the word is the bit (ui32WordPosition * __BIT_VECTOR_WORD_SIZE__ + n) of the bit vector. Bits after the end of the bit vector are read as 0.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  bitvector_word_t BitVector_readWord(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32WordPosition){
+    bitvector_word_t bwWord = __BitVector_loadWord(bvBitVector, BitVector_getSize(ui32AmountOfBits), ui32WordPosition);
+    uint32_t ui32LastBit = (ui32WordPosition + 1) * __BIT_VECTOR_WORD_SIZE__;
+    if (ui32LastBit > ui32AmountOfBits){
+      uint32_t ui32AmountOfValidBits = (ui32AmountOfBits > ui32WordPosition * __BIT_VECTOR_WORD_SIZE__) ? (ui32AmountOfBits - ui32WordPosition * __BIT_VECTOR_WORD_SIZE__) : 0;
+      bwWord = (ui32AmountOfValidBits == 0) ? 0 : (bwWord & (bitvector_word_t) (__BIT_VECTOR_WORD_ONES__ >> (__BIT_VECTOR_WORD_SIZE__ - ui32AmountOfValidBits)));
+    }
+    return bwWord;
+  }
+
+  //! Function: Next Set Bit Finder
+  /*!
+    Finds the next set bit of a bit vector, a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t BitVector_findNextSet(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition){
+    return __BitVector_findNext(bvBitVector, ui32AmountOfBits, ui32StartPosition, 0);
+  }
+
+  //! Function: Next Clear Bit Finder
+  /*!
+    Finds the next clear bit of a bit vector, a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t BitVector_findNextClear(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition){
+    return __BitVector_findNext(bvBitVector, ui32AmountOfBits, ui32StartPosition, __BIT_VECTOR_WORD_ONES__);
+  }
+
+  //! Function: Clear Run Finder
+  /*!
+    Finds the first run of clear bits with a given size. Each free run is skipped a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \param ui32RunSize is a unsigned 32-bit integer. It's the amount of contiguous clear bits.
+    \return Returns the position of the first bit of the run or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t BitVector_findClearRun(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition, uint32_t ui32RunSize){
+    uint32_t ui32RunStart = BitVector_findNextClear(bvBitVector, ui32AmountOfBits, ui32StartPosition);
+    while (ui32RunStart != BIT_VECTOR_NOT_FOUND){
+      if (ui32RunSize > ui32AmountOfBits - ui32RunStart){
+        return BIT_VECTOR_NOT_FOUND;
+      }
+      uint32_t ui32RunEnd = BitVector_findNextSet(bvBitVector, ui32AmountOfBits, ui32RunStart);
+      if (ui32RunEnd == BIT_VECTOR_NOT_FOUND || (ui32RunEnd - ui32RunStart) >= ui32RunSize){
+        return ui32RunStart;
+      }
+      ui32RunStart = BitVector_findNextClear(bvBitVector, ui32AmountOfBits, ui32RunEnd);
+    }
+    return BIT_VECTOR_NOT_FOUND;
+  }
+
+  //! Function: Set Bits Counter
+  /*!
+    Counts the set bits of a bit vector (population count), a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \return Returns the amount of set bits.
+  */
+  uint32_t BitVector_countOnes(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits){
+    return BitVector_countRange(bvBitVector, 0, ui32AmountOfBits);
+  }
+
+  //! Private Function: Iterator Word Loader
+  /*!
+    Loads a word for an iterator: inverted for clear bits iterators and without the bits after the end of the bit vector.
+    \param bviIterator is a bitvector_iterator_t type. It's the iterator.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  static inline bitvector_word_t __BitVector_loadIteratorWord(bitvector_iterator_t bviIterator, uint32_t ui32WordPosition){
+    bitvector_word_t bwWord = __BitVector_loadWord(bviIterator->bvBitVector, BitVector_getSize(bviIterator->ui32AmountOfBits), ui32WordPosition) ^ bviIterator->bwInvertMask;
+    uint32_t ui32AmountOfValidBits = bviIterator->ui32AmountOfBits - ui32WordPosition * __BIT_VECTOR_WORD_SIZE__;
+    if (ui32AmountOfValidBits < __BIT_VECTOR_WORD_SIZE__){
+      bwWord = bwWord & (bitvector_word_t) (__BIT_VECTOR_WORD_ONES__ >> (__BIT_VECTOR_WORD_SIZE__ - ui32AmountOfValidBits));
+    }
+    return bwWord;
+  }
+
+  //! Private Function: Iterator Empty Words Skipper
+  /*!
+    Loads the words of an iterator until one of them has a bit to be returned. The full words are loaded directly, without the end of bit vector checks.
+    \param bviIterator is a bitvector_iterator_t type. It's the iterator.
+    \return Returns false at the end of the bit vector.
+  */
+  static inline bool __BitVector_skipEmptyWords(bitvector_iterator_t bviIterator){
+    uint32_t ui32AmountOfFullWords = bviIterator->ui32AmountOfBits / __BIT_VECTOR_WORD_SIZE__;
+    uint32_t ui32AmountOfWords = (bviIterator->ui32AmountOfBits + __BIT_VECTOR_WORD_SIZE__ - 1) / __BIT_VECTOR_WORD_SIZE__;
+    uint32_t ui32WordPosition = bviIterator->ui32NextWordPosition;
+    bitvector_word_t bwWord = 0;
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      while (ui32WordPosition < ui32AmountOfFullWords){
+        memcpy(&bwWord, &bviIterator->bvBitVector[ui32WordPosition * __BIT_VECTOR_WORD_BYTES__], __BIT_VECTOR_WORD_BYTES__);
+        ui32WordPosition++;
+        bwWord = bwWord ^ bviIterator->bwInvertMask;
+        if (bwWord != 0){
+          bviIterator->ui32NextWordPosition = ui32WordPosition;
+          bviIterator->bwWord = bwWord;
+          return true;
+        }
+      }
+    #endif
+    while (ui32WordPosition < ui32AmountOfWords){
+      bwWord = __BitVector_loadIteratorWord(bviIterator, ui32WordPosition);
+      ui32WordPosition++;
+      if (bwWord != 0){
+        bviIterator->ui32NextWordPosition = ui32WordPosition;
+        bviIterator->bwWord = bwWord;
+        return true;
+      }
+    }
+    bviIterator->ui32NextWordPosition = ui32WordPosition;
+    return false;
+  }
+
+  //! Function: Bit Vector Iterator Seeker
+  /*!
+    Moves an iterator, so the next returned bit is the first one at or after a position.
+    \param bviIterator is a bitvector_iterator_t type. It's the iterator.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the new position.
+  */
+  void BitVector_seekIterator(bitvector_iterator_t bviIterator, uint32_t ui32StartPosition){
+    if (ui32StartPosition >= bviIterator->ui32AmountOfBits){
+      bviIterator->ui32NextWordPosition = UINT32_MAX;
+      bviIterator->bwWord = 0;
+      return;
+    }
+    bviIterator->ui32NextWordPosition = ui32StartPosition / __BIT_VECTOR_WORD_SIZE__;
+    bviIterator->bwWord = __BitVector_loadIteratorWord(bviIterator, bviIterator->ui32NextWordPosition) & (bitvector_word_t) (__BIT_VECTOR_WORD_ONES__ << (ui32StartPosition % __BIT_VECTOR_WORD_SIZE__));
+    bviIterator->ui32NextWordPosition++;
+  }
+
+  //! Function: Bit Vector Iterator Next Bit
+  /*!
+    Gets the next set bit of an iterator (or the next clear bit of a clear bits iterator). Empty words are skipped.
+    \param bviIterator is a bitvector_iterator_t type. It's the iterator.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND at the end of the bit vector.
+  */
+  uint32_t BitVector_nextSet(bitvector_iterator_t bviIterator){
+    uint32_t ui32Bit = 0;
+    if (bviIterator->bwWord == 0 && __BitVector_skipEmptyWords(bviIterator) == false){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    ui32Bit = __BitVector_countTrailingZeros(bviIterator->bwWord);
+    bviIterator->bwWord = bviIterator->bwWord & (bitvector_word_t) (bviIterator->bwWord - 1);
+    return (bviIterator->ui32NextWordPosition - 1) * __BIT_VECTOR_WORD_SIZE__ + ui32Bit;
+  }
+
+  //! Function: Bit Vector Iterator Next Run
+  /*!
+    Gets the next run of contiguous set bits of an iterator (or clear bits of a clear bits iterator). Full words inside the run are added at once.
+    \param bviIterator is a bitvector_iterator_t type. It's the iterator.
+    \param ui32pLength is a unsigned 32-bit integer pointer. It's where the run length will be saved.
+    \return Returns the position of the first bit of the run or BIT_VECTOR_NOT_FOUND at the end of the bit vector.
+  */
+  uint32_t BitVector_nextRun(bitvector_iterator_t bviIterator, uint32_t* ui32pLength){
+    uint32_t ui32AmountOfWords = (bviIterator->ui32AmountOfBits + __BIT_VECTOR_WORD_SIZE__ - 1) / __BIT_VECTOR_WORD_SIZE__;
+    uint32_t ui32Start = 0;
+    bitvector_word_t bwRun = 0;
+    bitvector_word_t bwCarry = 0;
+    *ui32pLength = 0;
+    if (bviIterator->bwWord == 0 && __BitVector_skipEmptyWords(bviIterator) == false){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    ui32Start = (bviIterator->ui32NextWordPosition - 1) * __BIT_VECTOR_WORD_SIZE__ + __BitVector_countTrailingZeros(bviIterator->bwWord);
+    bwCarry = (bitvector_word_t) (bviIterator->bwWord + (bviIterator->bwWord & (bitvector_word_t) (0 - bviIterator->bwWord)));
+    bwRun = bviIterator->bwWord & (bitvector_word_t) ~bwCarry;
+    bviIterator->bwWord = bviIterator->bwWord & bwCarry;
+    *ui32pLength = __BitVector_countOnesOfWord(bwRun);
+    if ((bwRun >> (__BIT_VECTOR_WORD_SIZE__ - 1)) == 0){
+      return ui32Start;
+    }
+    while (bviIterator->ui32NextWordPosition < ui32AmountOfWords){
+      bitvector_word_t bwWord = __BitVector_loadIteratorWord(bviIterator, bviIterator->ui32NextWordPosition);
+      bviIterator->ui32NextWordPosition++;
+      if (bwWord != __BIT_VECTOR_WORD_ONES__){
+        *ui32pLength = *ui32pLength + __BitVector_countTrailingZeros((bitvector_word_t) ~bwWord);
+        bviIterator->bwWord = bwWord & (bitvector_word_t) (bwWord + 1);
+        break;
+      }
+      *ui32pLength = *ui32pLength + __BIT_VECTOR_WORD_SIZE__;
+    }
+    return ui32Start;
+  }
+
+  //! Function: Bit Vector Set Bits Walker
+  /*!
+    Calls a function for each set bit of a bit vector, a word at a time.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param bfpCallback is a function pointer. It receives the bit position and the context and returns false to stop.
+    \param vpContext is a void pointer. It's passed to the callback.
+  */
+  void BitVector_forEachSet(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, bool (*bfpCallback)(uint32_t ui32Position, void* vpContext), void* vpContext){
+    uint32_t ui32Position = 0;
+    newBitVectorIterator(bviIterator, bvBitVector, ui32AmountOfBits);
+    for (ui32Position = BitVector_nextSet(bviIterator) ; ui32Position != BIT_VECTOR_NOT_FOUND ; ui32Position = BitVector_nextSet(bviIterator)){
+      if (bfpCallback(ui32Position, vpContext) == false){
+        return;
+      }
+    }
+  }
+
+  //! Function: Bit Vector Runs Walker
+  /*!
+    Calls a function for each run of contiguous set bits of a bit vector.
+    \param bvBitVector is a bit_vector_t type. It's the bit vector.
+    \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+    \param bfpCallback is a function pointer. It receives the run start, the run length and the context and returns false to stop.
+    \param vpContext is a void pointer. It's passed to the callback.
+  */
+  void BitVector_forEachRun(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, bool (*bfpCallback)(uint32_t ui32Start, uint32_t ui32Length, void* vpContext), void* vpContext){
+    uint32_t ui32Start = 0;
+    uint32_t ui32Length = 0;
+    newBitVectorIterator(bviIterator, bvBitVector, ui32AmountOfBits);
+    for (ui32Start = BitVector_nextRun(bviIterator, &ui32Length) ; ui32Start != BIT_VECTOR_NOT_FOUND ; ui32Start = BitVector_nextRun(bviIterator, &ui32Length)){
+      if (bfpCallback(ui32Start, ui32Length, vpContext) == false){
+        return;
+      }
+    }
+  }
+
+#endif
@@ -53,6 +53,40 @@
     */
     typedef uint8_t bitvector_t;
 
+    //! Type Definition: bitvector_word_t
+    /*!
+      Word used by the bit vector scan functions. Its size is configured by __BIT_VECTOR_WORD_SIZE__ in Configs.h.
+    */
+    #if (__BIT_VECTOR_WORD_SIZE__ == 64)
+      typedef uint64_t bitvector_word_t;
+    #elif (__BIT_VECTOR_WORD_SIZE__ == 16)
+      typedef uint16_t bitvector_word_t;
+    #elif (__BIT_VECTOR_WORD_SIZE__ == 8)
+      typedef uint8_t bitvector_word_t;
+    #else
+      typedef uint32_t bitvector_word_t;
+    #endif
+
+    //! Macro: Bit Vector Not Found Position
+    /*!
+      Position returned by the bit vector scan functions when there is no bit with the requested value.
+    */
+    #define BIT_VECTOR_NOT_FOUND UINT32_MAX
+
+    //! Type Definition: bitvector_iterator_structure_t and bitvector_iterator_t
+    /*!
+      Cursor over the set (or clear) bits of a bit vector. It keeps the current word, so each word is loaded only once and empty words are skipped.
+    */
+    typedef struct{
+      const bitvector_t* bvBitVector;                   /*!< bitvector_t pointer type. */
+      uint32_t ui32AmountOfBits;                        /*!< 32-bit integer type. */
+      uint32_t ui32NextWordPosition;                    /*!< 32-bit integer type. */
+      bitvector_word_t bwWord;                          /*!< bitvector_word_t type. */
+      bitvector_word_t bwInvertMask;                    /*!< bitvector_word_t type. */
+    } bitvector_iterator_structure_t;
+
+    typedef bitvector_iterator_structure_t* bitvector_iterator_t;
+
     //! Macro: Static Bit Vector Allocation
     /*!
       This macro is for calculate the size of cell of bit-vectors type.
@@ -125,6 +159,66 @@
     #define BitVector_readBit(bvBitVector, uiPosition)\
       Bitwise_readBit(bvBitVector[(BitVector_getBytePosition(uiPosition))], (BitVector_getBitPosition(uiPosition)))
 
+    //! Macro: First Set Bit Finder
+    /*!
+      Finds the first set bit of a bit vector.
+      \param bvBitVector is a bit_vector_t type. It's the bit vector.
+      \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+      \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+    */
+    #define BitVector_findFirstSet(bvBitVector, ui32AmountOfBits)\
+      BitVector_findNextSet(bvBitVector, ui32AmountOfBits, 0)
+
+    //! Macro: First Clear Bit Finder
+    /*!
+      Finds the first clear bit of a bit vector.
+      \param bvBitVector is a bit_vector_t type. It's the bit vector.
+      \param ui32AmountOfBits is a unsigned 32-bit integer. It's the amount of bits of the bit vector.
+      \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+    */
+    #define BitVector_findFirstClear(bvBitVector, ui32AmountOfBits)\
+      BitVector_findNextClear(bvBitVector, ui32AmountOfBits, 0)
+
+    //! Macro: Bit Vector Iterator Creator
+    /*!
+      This macro creates an iterator over the set bits of a bit vector.
+      \param bviName is an iterator name.
+      \param bvVector is a bit_vector_t type. It's the bit vector.
+      \param uiAmountOfBit is a unsigned integer. It's the amount of bits of the bit vector.
+    */
+    #define newBitVectorIterator(bviName, bvVector, uiAmountOfBit)\
+      bitvector_iterator_structure_t __##bviName = {.bvBitVector = (bvVector), .ui32AmountOfBits = (uiAmountOfBit), .ui32NextWordPosition = 0, .bwWord = 0, .bwInvertMask = 0};\
+      bitvector_iterator_t bviName = &__##bviName
+
+    //! Macro: Bit Vector Clear Bits Iterator Creator
+    /*!
+      This macro creates an iterator over the clear bits of a bit vector.
+      \param bviName is an iterator name.
+      \param bvVector is a bit_vector_t type. It's the bit vector.
+      \param uiAmountOfBit is a unsigned integer. It's the amount of bits of the bit vector.
+    */
+    #define newBitVectorClearIterator(bviName, bvVector, uiAmountOfBit)\
+      bitvector_iterator_structure_t __##bviName = {.bvBitVector = (bvVector), .ui32AmountOfBits = (uiAmountOfBit), .ui32NextWordPosition = 0, .bwWord = 0, .bwInvertMask = (bitvector_word_t) ~((bitvector_word_t) 0)};\
+      bitvector_iterator_t bviName = &__##bviName
+
+    void BitVector_and(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits);            /*!< void type function. */
+    void BitVector_or(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits);             /*!< void type function. */
+    void BitVector_xor(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits);            /*!< void type function. */
+    void BitVector_andNot(bitvector_t* bvDestination, const bitvector_t* bvBitVectorA, const bitvector_t* bvBitVectorB, uint32_t ui32AmountOfBits);         /*!< void type function. */
+    void BitVector_setRange(bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits);                                                /*!< void type function. */
+    void BitVector_clearRange(bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits);                                              /*!< void type function. */
+    uint32_t BitVector_countRange(const bitvector_t* bvBitVector, uint32_t ui32StartPosition, uint32_t ui32AmountOfBits);                                    /*!< 32-bits integer type function. */
+    bitvector_word_t BitVector_readWord(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32WordPosition);                              /*!< bitvector_word_t type function. */
+    uint32_t BitVector_findNextSet(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition);                                 /*!< 32-bits integer type function. */
+    uint32_t BitVector_findNextClear(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition);                               /*!< 32-bits integer type function. */
+    uint32_t BitVector_findClearRun(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, uint32_t ui32StartPosition, uint32_t ui32RunSize);        /*!< 32-bits integer type function. */
+    uint32_t BitVector_countOnes(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits);                                                              /*!< 32-bits integer type function. */
+    void BitVector_seekIterator(bitvector_iterator_t bviIterator, uint32_t ui32StartPosition);                                                           /*!< void type function. */
+    uint32_t BitVector_nextSet(bitvector_iterator_t bviIterator);                                                                                         /*!< 32-bits integer type function. */
+    uint32_t BitVector_nextRun(bitvector_iterator_t bviIterator, uint32_t* ui32pLength);                                                                  /*!< 32-bits integer type function. */
+    void BitVector_forEachSet(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, bool (*bfpCallback)(uint32_t ui32Position, void* vpContext), void* vpContext);                             /*!< void type function. */
+    void BitVector_forEachRun(const bitvector_t* bvBitVector, uint32_t ui32AmountOfBits, bool (*bfpCallback)(uint32_t ui32Start, uint32_t ui32Length, void* vpContext), void* vpContext);          /*!< void type function. */
+
     #ifdef __cplusplus
       }
     #endif
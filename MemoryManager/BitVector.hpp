@@ -0,0 +1,283 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __BIT_VECTOR_CPP_HEADER__
+  #define __BIT_VECTOR_CPP_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__cplusplus) && defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #include <stdint.h>
+    #include <string.h>
+    #include <type_traits>
+
+    extern "C" {
+      #include "./BitVector.h"
+    }
+
+    namespace MemoryManager {
+
+      //! Class: Compile-Time Bit Vector
+      /*!
+        Bit vector with N bits. Its storage is a bitvector_t array with exactly BitVector_getSize(N) bytes, so a C bit vector created by newBitVector(bvName, N) can be used as a BitVector<N> (see BitVector::fromData) and BitVector::getData can be passed to the C functions. The single bit operations are constexpr. The whole vector operations work on Word values with fixed loop counts, so the compiler unrolls them for small N and vectorizes them for large N. The bits after N are always 0.
+        \param N is the amount of bits (C++14).
+        \param Word is an unsigned integer type. It's the word of the whole vector operations.
+      */
+      template <uint32_t N, typename Word = bitvector_word_t>
+      class BitVector {
+        static_assert(N > 0, "BitVector needs at least one bit.");
+        static_assert(std::is_unsigned<Word>::value && sizeof(Word) <= sizeof(unsigned long long), "BitVector word must be an unsigned integer type.");
+
+        public:
+          static constexpr uint32_t ui32AmountOfBits = N;                                                                        /*!< 32-bits integer type. */
+          static constexpr uint32_t ui32AmountOfBytes = BitVector_getSize(N);                                                    /*!< 32-bits integer type. */
+          static constexpr uint32_t ui32AmountOfWords = ui32AmountOfBytes / sizeof(Word);                                        /*!< 32-bits integer type. */
+
+          //! Constructor: Empty Bit Vector
+          /*!
+            Creates a bit vector with all bits clear.
+          */
+          constexpr BitVector() : bvData{} {
+            static_assert(sizeof(BitVector) == BitVector_getSize(N), "BitVector must have the size of a bitvector_t array.");
+            static_assert(std::is_standard_layout<BitVector>::value, "BitVector must have the layout of a bitvector_t array.");
+          }
+
+          //! Functions: C Storage View
+          /*!
+            Use a C bit vector (a bitvector_t array with BitVector_getSize(N) bytes) as a BitVector<N> with no copy.
+            \param bvBitVector is a bitvector_t pointer. It's the C bit vector.
+            \return Returns the bit vector.
+          */
+          static BitVector& fromData(bitvector_t* bvBitVector){
+            return *reinterpret_cast<BitVector*>(bvBitVector);
+          }
+
+          static const BitVector& fromData(const bitvector_t* bvBitVector){
+            return *reinterpret_cast<const BitVector*>(bvBitVector);
+          }
+
+          //! Functions: C Storage Getter
+          /*!
+            Get the storage, to be used with the C functions.
+            \return Returns the bitvector_t array.
+          */
+          bitvector_t* getData(){
+            return bvData;
+          }
+
+          const bitvector_t* getData() const {
+            return bvData;
+          }
+
+          //! Functions: Single Bit Operations
+          /*!
+            Set, clear, flip and read a bit. The position is not checked.
+            \param ui32Position is a unsigned 32-bit integer. It's the bit position.
+          */
+          constexpr void setBit(uint32_t ui32Position){
+            bvData[ui32Position >> 3] = (bitvector_t) (bvData[ui32Position >> 3] | (1U << (ui32Position & 7)));
+          }
+
+          constexpr void clearBit(uint32_t ui32Position){
+            bvData[ui32Position >> 3] = (bitvector_t) (bvData[ui32Position >> 3] & ~(1U << (ui32Position & 7)));
+          }
+
+          constexpr void flipBit(uint32_t ui32Position){
+            bvData[ui32Position >> 3] = (bitvector_t) (bvData[ui32Position >> 3] ^ (1U << (ui32Position & 7)));
+          }
+
+          constexpr bool readBit(uint32_t ui32Position) const {
+            return ((bvData[ui32Position >> 3] >> (ui32Position & 7)) & 1) != 0;
+          }
+
+          //! Functions: Whole Vector Fill
+          /*!
+            Set, clear or flip all bits.
+          */
+          void setAll(){
+            memset(bvData, 0xFF, ui32AmountOfBytes);
+            bvData[ui32AmountOfBytes - 1] = (bitvector_t) (bvData[ui32AmountOfBytes - 1] & __bvLastByteMask);
+          }
+
+          void clearAll(){
+            memset(bvData, 0, ui32AmountOfBytes);
+          }
+
+          void flipAll(){
+            __operate(*this, [](Word wWordA, Word){ return (Word) ~wWordA; });
+            bvData[ui32AmountOfBytes - 1] = (bitvector_t) (bvData[ui32AmountOfBytes - 1] & __bvLastByteMask);
+          }
+
+          //! Operators: Whole Vector Boolean Operations
+          /*!
+            Apply a boolean operation with other bit vector, a Word at a time.
+            \param bvOther is a BitVector. It's the other operand.
+            \return Returns this bit vector.
+          */
+          BitVector& operator&=(const BitVector& bvOther){
+            __operate(bvOther, [](Word wWordA, Word wWordB){ return (Word) (wWordA & wWordB); });
+            return *this;
+          }
+
+          BitVector& operator|=(const BitVector& bvOther){
+            __operate(bvOther, [](Word wWordA, Word wWordB){ return (Word) (wWordA | wWordB); });
+            return *this;
+          }
+
+          BitVector& operator^=(const BitVector& bvOther){
+            __operate(bvOther, [](Word wWordA, Word wWordB){ return (Word) (wWordA ^ wWordB); });
+            return *this;
+          }
+
+          BitVector& andNot(const BitVector& bvOther){
+            __operate(bvOther, [](Word wWordA, Word wWordB){ return (Word) (wWordA & ~wWordB); });
+            return *this;
+          }
+
+          friend BitVector operator&(BitVector bvA, const BitVector& bvB){
+            return bvA &= bvB;
+          }
+
+          friend BitVector operator|(BitVector bvA, const BitVector& bvB){
+            return bvA |= bvB;
+          }
+
+          friend BitVector operator^(BitVector bvA, const BitVector& bvB){
+            return bvA ^= bvB;
+          }
+
+          //! Functions: Whole Vector Queries
+          /*!
+            Count the set bits, check if any bit is set and compare two bit vectors, a Word at a time.
+          */
+          uint32_t countOnes() const {
+            uint32_t ui32AmountOfOnes = 0;
+            uint32_t ui32Counter = 0;
+            for (ui32Counter = 0 ; ui32Counter < ui32AmountOfWords ; ui32Counter++){
+              ui32AmountOfOnes = ui32AmountOfOnes + __countOnesOfWord(__loadWord(bvData, ui32Counter));
+            }
+            for (ui32Counter = ui32AmountOfWords * sizeof(Word) ; ui32Counter < ui32AmountOfBytes ; ui32Counter++){
+              ui32AmountOfOnes = ui32AmountOfOnes + __countOnesOfWord(bvData[ui32Counter]);
+            }
+            return ui32AmountOfOnes;
+          }
+
+          bool any() const {
+            Word wAccumulator = 0;
+            uint32_t ui32Counter = 0;
+            for (ui32Counter = 0 ; ui32Counter < ui32AmountOfWords ; ui32Counter++){
+              wAccumulator = (Word) (wAccumulator | __loadWord(bvData, ui32Counter));
+            }
+            for (ui32Counter = ui32AmountOfWords * sizeof(Word) ; ui32Counter < ui32AmountOfBytes ; ui32Counter++){
+              wAccumulator = (Word) (wAccumulator | bvData[ui32Counter]);
+            }
+            return wAccumulator != 0;
+          }
+
+          bool operator==(const BitVector& bvOther) const {
+            return memcmp(bvData, bvOther.bvData, ui32AmountOfBytes) == 0;
+          }
+
+          bool operator!=(const BitVector& bvOther) const {
+            return !(*this == bvOther);
+          }
+
+          //! Functions: Bit Scan
+          /*!
+            Find the next set or clear bit with the C scan functions.
+            \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+            \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+          */
+          uint32_t findNextSet(uint32_t ui32StartPosition = 0) const {
+            return BitVector_findNextSet(bvData, N, ui32StartPosition);
+          }
+
+          uint32_t findNextClear(uint32_t ui32StartPosition = 0) const {
+            return BitVector_findNextClear(bvData, N, ui32StartPosition);
+          }
+
+        private:
+          bitvector_t bvData[ui32AmountOfBytes];                                                                                 /*!< bitvector_t array type. */
+
+          static constexpr bitvector_t __bvLastByteMask = (bitvector_t) ((N & 7) == 0 ? 0xFF : ((1U << (N & 7)) - 1));
+
+          //! Private Functions: Word Access
+          /*!
+            Load and store a Word of the storage. memcpy keeps the access valid for any alignment and becomes a single instruction.
+          */
+          static Word __loadWord(const bitvector_t* bvBitVector, uint32_t ui32WordPosition){
+            Word wWord;
+            memcpy(&wWord, &bvBitVector[ui32WordPosition * sizeof(Word)], sizeof(Word));
+            return wWord;
+          }
+
+          static void __storeWord(bitvector_t* bvBitVector, uint32_t ui32WordPosition, Word wWord){
+            memcpy(&bvBitVector[ui32WordPosition * sizeof(Word)], &wWord, sizeof(Word));
+          }
+
+          static uint32_t __countOnesOfWord(Word wWord){
+            #if defined(__GNUC__) || defined(__clang__)
+              return (uint32_t) __builtin_popcountll((unsigned long long) wWord);
+            #else
+              uint32_t ui32AmountOfOnes = 0;
+              for ( ; wWord != 0 ; wWord = (Word) (wWord & (wWord - 1))){
+                ui32AmountOfOnes++;
+              }
+              return ui32AmountOfOnes;
+            #endif
+          }
+
+          //! Private Function: Whole Vector Operation
+          /*!
+            Applies an operation on each Word and then on each remaining byte. N is a constant, so the loop counts are known by the compiler.
+          */
+          template <typename Operation>
+          void __operate(const BitVector& bvOther, Operation oOperation){
+            uint32_t ui32Counter = 0;
+            for (ui32Counter = 0 ; ui32Counter < ui32AmountOfWords ; ui32Counter++){
+              __storeWord(bvData, ui32Counter, oOperation(__loadWord(bvData, ui32Counter), __loadWord(bvOther.bvData, ui32Counter)));
+            }
+            for (ui32Counter = ui32AmountOfWords * sizeof(Word) ; ui32Counter < ui32AmountOfBytes ; ui32Counter++){
+              bvData[ui32Counter] = (bitvector_t) oOperation((Word) bvData[ui32Counter], (Word) bvOther.bvData[ui32Counter]);
+            }
+          }
+      };
+
+    }
+
+  #endif
+#endif
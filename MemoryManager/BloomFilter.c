@@ -0,0 +1,335 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./BloomFilter.h"
+  #include <string.h>
+
+  //! Macro: Batch Prefetch Distance
+  /*!
+    Amount of keys between the prefetch of a key cache line and its use by the batch functions.
+  */
+  #define __BLOOM_FILTER_PREFETCH_DISTANCE__ 16
+
+  //! Macro: Cache Line Prefetch
+  /*!
+    Asks the processor to load the cache line of an address.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __BloomFilter_prefetch(vpAddress) __builtin_prefetch(vpAddress)
+  #else
+    #define __BloomFilter_prefetch(vpAddress)
+  #endif
+
+  //! Macro: Fast Range Reduction
+  /*!
+    Maps a 32-bit value to [0, ui32Range) with a multiplication, instead of a division.
+  */
+  #define __BloomFilter_reduce(ui32Value, ui32Range)\
+    ((uint32_t) (((uint64_t) (ui32Value) * (uint64_t) (ui32Range)) >> 32))
+
+  //! Private Function: 64-bit Mixer
+  /*!
+    Mixes the bits of a 64-bit value (the MurmurHash3 finalizer), so each input bit changes about half of the output bits.
+  */
+  static inline uint64_t __BloomFilter_mix(uint64_t ui64Value){
+    ui64Value = ui64Value ^ (ui64Value >> 33);
+    ui64Value = ui64Value * 0xFF51AFD7ED558CCDULL;
+    ui64Value = ui64Value ^ (ui64Value >> 33);
+    ui64Value = ui64Value * 0xC4CEB9FE1A85EC53ULL;
+    return ui64Value ^ (ui64Value >> 33);
+  }
+
+  //! Type Definition: Key Probe
+  /*!
+    Double hashing state of a key: the bit i of the key is ui32First + i * ui32Step, mapped to the amount of bits.
+  */
+  typedef struct {
+    uint32_t ui32First;                           /*!< 32-bits integer type. It's the hash of the current bit of the key. */
+    uint32_t ui32Step;                            /*!< 32-bits integer type. It's added to ui32First for each bit of the key (always odd). */
+  } bloomfilter_probe_t;
+
+  //! Private Function: Key Probe Creator
+  /*!
+    Creates the probe of a key with the two halves of its hash.
+  */
+  static inline bloomfilter_probe_t __BloomFilter_getProbe(uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe;
+    bpProbe.ui32First = (uint32_t) ui64Hash;
+    bpProbe.ui32Step = (uint32_t) (ui64Hash >> 32) | 1;
+    return bpProbe;
+  }
+
+  //! Private Function: Bit Position
+  /*!
+    Gets the position of the bit of a probe, mapped to the whole bit vector.
+  */
+  static inline uint32_t __BloomFilter_getPosition(uint32_t ui32AmountOfBits, const bloomfilter_probe_t* bppProbe){
+    return __BloomFilter_reduce(bppProbe->ui32First, ui32AmountOfBits);
+  }
+
+  //! Macro: Block Words
+  /*!
+    Amount of 64-bit words of a block of a blocked Bloom filter.
+  */
+  #define __BLOOM_FILTER_BLOCK_WORDS__ (BLOOM_FILTER_BLOCK_SIZE / 64)
+
+  //! Macros: Block Word Mask
+  /*!
+    Gets the bit of a key on a word of its block: one bit in each of the first ui8AmountOfHashes words (up to __BLOOM_FILTER_BLOCK_WORDS__), at the position given by the next 6 bits of the key hash mixed by one multiplication (__BloomFilter_getBlockBits). A block is checked with one comparison for each word, without a branch, a multiplication or a memory read for each bit, so many keys fit in the processor window and their cache misses overlap.
+  */
+  #define __BloomFilter_getBlockBits(ui64Hash) ((ui64Hash) * 0x9E3779B97F4A7C15ULL)
+
+  #define __BloomFilter_getBlockMask(ui64Bits, ui8AmountOfHashes, ui32Word)\
+    ((uint64_t) ((ui32Word) < (ui8AmountOfHashes)) << (((ui64Bits) >> (58 - 6 * (ui32Word))) & 63))
+
+  //! Private Function: Block Getter
+  /*!
+    Gets the first byte of the block of a key, selected by the high half of its hash. The words of a block are accessed with memcpy, which compiles to a single load or store.
+  */
+  static inline bitvector_t* __BloomFilter_getBlock(bloomfilter_t bfFilter, uint64_t ui64Hash){
+    return &bfFilter->bvBits[__BloomFilter_reduce((uint32_t) (ui64Hash >> 32), bfFilter->ui32AmountOfBits / BLOOM_FILTER_BLOCK_SIZE) * (BLOOM_FILTER_BLOCK_SIZE / 8)];
+  }
+
+  //! Function: Key Hash
+  /*!
+    Calculates a 64-bit non-cryptographic hash of a key, 8 bytes at a time.
+    \param vpKey is a void pointer. It's the key.
+    \param ui32Length is a unsigned 32-bit integer. It's the key size in bytes.
+    \return Returns the hash.
+  */
+  uint64_t BloomFilter_hash(const void* vpKey, uint32_t ui32Length){
+    const uint8_t* ui8pKey = (const uint8_t*) vpKey;
+    uint64_t ui64Hash = 0x27D4EB2F165667C5ULL ^ ((uint64_t) ui32Length * 0x9E3779B97F4A7C15ULL);
+    uint64_t ui64Word = 0;
+    uint32_t ui32Counter = 0;
+    for ( ; ui32Counter + 8 <= ui32Length ; ui32Counter = ui32Counter + 8){
+      memcpy(&ui64Word, &ui8pKey[ui32Counter], sizeof(uint64_t));
+      ui64Hash = (ui64Hash ^ __BloomFilter_mix(ui64Word)) * 0x9E3779B97F4A7C15ULL;
+    }
+    if (ui32Counter < ui32Length){
+      ui64Word = 0;
+      memcpy(&ui64Word, &ui8pKey[ui32Counter], ui32Length - ui32Counter);
+      ui64Hash = (ui64Hash ^ __BloomFilter_mix(ui64Word)) * 0x9E3779B97F4A7C15ULL;
+    }
+    return __BloomFilter_mix(ui64Hash);
+  }
+
+  //! Function: Integer Key Hash
+  /*!
+    Calculates the hash of an integer key, faster than BloomFilter_hash.
+    \param ui64Key is a unsigned 64-bit integer. It's the key.
+    \return Returns the hash.
+  */
+  uint64_t BloomFilter_hashInteger(uint64_t ui64Key){
+    return __BloomFilter_mix(ui64Key + 0x9E3779B97F4A7C15ULL);
+  }
+
+  //! Function: Bloom Filter Eraser
+  /*!
+    Removes all keys of a Bloom filter.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+  */
+  void BloomFilter_clear(bloomfilter_t bfFilter){
+    memset(bfFilter->bvBits, 0, BloomFilter_getSize(bfFilter->ui32AmountOfBits) * sizeof(uint64_t));
+  }
+
+  //! Function: Bloom Filter Hash Adder
+  /*!
+    Adds a key, by its hash, to a Bloom filter.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash (see BloomFilter_hash).
+  */
+  void BloomFilter_addHash(bloomfilter_t bfFilter, uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe;
+    uint32_t ui32Counter = 0;
+    if (bfFilter->bBlocked == true){
+      bitvector_t* bvpBlock = __BloomFilter_getBlock(bfFilter, ui64Hash);
+      uint64_t ui64Bits = __BloomFilter_getBlockBits(ui64Hash);
+      for (ui32Counter = 0 ; ui32Counter < __BLOOM_FILTER_BLOCK_WORDS__ ; ui32Counter++){
+        uint64_t ui64Word = 0;
+        memcpy(&ui64Word, &bvpBlock[ui32Counter * sizeof(uint64_t)], sizeof(uint64_t));
+        ui64Word = ui64Word | __BloomFilter_getBlockMask(ui64Bits, bfFilter->ui8AmountOfHashes, ui32Counter);
+        memcpy(&bvpBlock[ui32Counter * sizeof(uint64_t)], &ui64Word, sizeof(uint64_t));
+      }
+      return;
+    }
+    bpProbe = __BloomFilter_getProbe(ui64Hash);
+    for (ui32Counter = 0 ; ui32Counter < bfFilter->ui8AmountOfHashes ; ui32Counter++){
+      uint32_t ui32Position = __BloomFilter_getPosition(bfFilter->ui32AmountOfBits, &bpProbe);
+      BitVector_setBit(bfFilter->bvBits, ui32Position);
+      bpProbe.ui32First = bpProbe.ui32First + bpProbe.ui32Step;
+    }
+  }
+
+  //! Function: Bloom Filter Hash Checker
+  /*!
+    Checks if a key, by its hash, may be in a Bloom filter.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash (see BloomFilter_hash).
+    \return Returns false if the key was not added and true if it was added (or for a false positive).
+  */
+  bool BloomFilter_containsHash(bloomfilter_t bfFilter, uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe;
+    uint32_t ui32Counter = 0;
+    if (bfFilter->bBlocked == true){
+      const bitvector_t* bvpBlock = __BloomFilter_getBlock(bfFilter, ui64Hash);
+      uint64_t ui64Bits = __BloomFilter_getBlockBits(ui64Hash);
+      uint64_t ui64Missing = 0;
+      for (ui32Counter = 0 ; ui32Counter < __BLOOM_FILTER_BLOCK_WORDS__ ; ui32Counter++){
+        uint64_t ui64Word = 0;
+        memcpy(&ui64Word, &bvpBlock[ui32Counter * sizeof(uint64_t)], sizeof(uint64_t));
+        ui64Missing = ui64Missing | (__BloomFilter_getBlockMask(ui64Bits, bfFilter->ui8AmountOfHashes, ui32Counter) & ~ui64Word);
+      }
+      return (ui64Missing == 0);
+    }
+    bpProbe = __BloomFilter_getProbe(ui64Hash);
+    for (ui32Counter = 0 ; ui32Counter < bfFilter->ui8AmountOfHashes ; ui32Counter++){
+      uint32_t ui32Position = __BloomFilter_getPosition(bfFilter->ui32AmountOfBits, &bpProbe);
+      if (BitVector_readBit(bfFilter->bvBits, ui32Position) == 0){
+        return false;
+      }
+      bpProbe.ui32First = bpProbe.ui32First + bpProbe.ui32Step;
+    }
+    return true;
+  }
+
+  //! Private Function: Key Cache Line
+  /*!
+    Gets the cache line of a key: its block on blocked Bloom filters, or the line of one of its bits.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash.
+    \param ui8Bit is a 8-bits integer. It's the index of the key bit (ignored on blocked Bloom filters).
+    \return Returns the address of the cache line.
+  */
+  static inline const bitvector_t* __BloomFilter_getLine(bloomfilter_t bfFilter, uint64_t ui64Hash, uint8_t ui8Bit){
+    bloomfilter_probe_t bpProbe;
+    if (bfFilter->bBlocked == true){
+      return __BloomFilter_getBlock(bfFilter, ui64Hash);
+    }
+    bpProbe = __BloomFilter_getProbe(ui64Hash);
+    bpProbe.ui32First = bpProbe.ui32First + ui8Bit * bpProbe.ui32Step;
+    return &bfFilter->bvBits[__BloomFilter_getPosition(bfFilter->ui32AmountOfBits, &bpProbe) >> 3];
+  }
+
+  //! Function: Bloom Filter Batch Adder
+  /*!
+    Adds many keys, by their hashes, to a Bloom filter. The cache lines of each key are prefetched __BLOOM_FILTER_PREFETCH_DISTANCE__ keys before they're changed, so the cache misses of different keys overlap on filters bigger than the cache.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+    \param ui64pHashes is a unsigned 64-bit integer pointer. It's the array of key hashes.
+    \param ui32AmountOfHashes is a unsigned 32-bit integer. It's the amount of keys.
+  */
+  void BloomFilter_addBatch(bloomfilter_t bfFilter, const uint64_t* ui64pHashes, uint32_t ui32AmountOfHashes){
+    uint8_t ui8AmountOfLines = (bfFilter->bBlocked == true) ? 1 : bfFilter->ui8AmountOfHashes;
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < (uint64_t) ui32AmountOfHashes + __BLOOM_FILTER_PREFETCH_DISTANCE__ ; ui32Counter++){
+      uint8_t ui8Line = 0;
+      for (ui8Line = 0 ; ui32Counter < ui32AmountOfHashes && ui8Line < ui8AmountOfLines ; ui8Line++){
+        __BloomFilter_prefetch(__BloomFilter_getLine(bfFilter, ui64pHashes[ui32Counter], ui8Line));
+      }
+      if (ui32Counter >= __BLOOM_FILTER_PREFETCH_DISTANCE__){
+        BloomFilter_addHash(bfFilter, ui64pHashes[ui32Counter - __BLOOM_FILTER_PREFETCH_DISTANCE__]);
+      }
+    }
+  }
+
+  //! Function: Bloom Filter Batch Checker
+  /*!
+    Checks many keys, by their hashes, in a Bloom filter. The cache line of each key (its first bit, when the filter is not blocked) is prefetched __BLOOM_FILTER_PREFETCH_DISTANCE__ keys before it's read, so the cache misses of different keys overlap on filters bigger than the cache.
+    \param bfFilter is a bloomfilter_t type. It's the Bloom filter.
+    \param ui64pHashes is a unsigned 64-bit integer pointer. It's the array of key hashes.
+    \param ui32AmountOfHashes is a unsigned 32-bit integer. It's the amount of keys.
+    \param bpResults is a bool pointer. It's the array where the result of each key will be saved (it can be NULL).
+    \return Returns the amount of keys that may be in the Bloom filter.
+  */
+  uint32_t BloomFilter_containsBatch(bloomfilter_t bfFilter, const uint64_t* ui64pHashes, uint32_t ui32AmountOfHashes, bool* bpResults){
+    uint32_t ui32AmountOfPositives = 0;
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < (uint64_t) ui32AmountOfHashes + __BLOOM_FILTER_PREFETCH_DISTANCE__ ; ui32Counter++){
+      if (ui32Counter < ui32AmountOfHashes){
+        __BloomFilter_prefetch(__BloomFilter_getLine(bfFilter, ui64pHashes[ui32Counter], 0));
+      }
+      if (ui32Counter >= __BLOOM_FILTER_PREFETCH_DISTANCE__){
+        bool bResult = BloomFilter_containsHash(bfFilter, ui64pHashes[ui32Counter - __BLOOM_FILTER_PREFETCH_DISTANCE__]);
+        ui32AmountOfPositives = ui32AmountOfPositives + (bResult == true);
+        if (bpResults != NULL){
+          bpResults[ui32Counter - __BLOOM_FILTER_PREFETCH_DISTANCE__] = bResult;
+        }
+      }
+    }
+    return ui32AmountOfPositives;
+  }
+
+  //! Function: Counting Bloom Filter Eraser
+  /*!
+    Removes all keys of a counting Bloom filter.
+    \param cbfFilter is a cbloomfilter_t type. It's the counting Bloom filter.
+  */
+  void CountingBloomFilter_clear(cbloomfilter_t cbfFilter){
+    memset(cbfFilter->pvCounters->bvData, 0, PackedVector_getSize(COUNTING_BLOOM_FILTER_COUNTER_SIZE, PackedVector_getAmountOfValues(cbfFilter->pvCounters)));
+  }
+
+  //! Function: Counting Bloom Filter Hash Adder
+  /*!
+    Adds a key, by its hash, to a counting Bloom filter. A counter at its maximum value is not changed.
+    \param cbfFilter is a cbloomfilter_t type. It's the counting Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash (see BloomFilter_hash).
+  */
+  void CountingBloomFilter_addHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe = __BloomFilter_getProbe(ui64Hash);
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < cbfFilter->ui8AmountOfHashes ; ui32Counter++){
+      uint32_t ui32Position = __BloomFilter_getPosition(PackedVector_getAmountOfValues(cbfFilter->pvCounters), &bpProbe);
+      uint32_t ui32Value = PackedVector_get(cbfFilter->pvCounters, ui32Position);
+      if (ui32Value < PackedVector_getMaxValue(cbfFilter->pvCounters)){
+        PackedVector_set(cbfFilter->pvCounters, ui32Position, ui32Value + 1);
+      }
+      bpProbe.ui32First = bpProbe.ui32First + bpProbe.ui32Step;
+    }
+  }
+
+  //! Function: Counting Bloom Filter Hash Remover
+  /*!
+    Removes a key, by its hash, from a counting Bloom filter. A counter at its maximum value is not changed, because it may count more keys than its maximum value. Only added keys should be removed: removing a false positive removes other keys.
+    \param cbfFilter is a cbloomfilter_t type. It's the counting Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash (see BloomFilter_hash).
+    \return Returns false if the key is not in the counting Bloom filter (nothing is changed).
+  */
+  bool CountingBloomFilter_removeHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe = __BloomFilter_getProbe(ui64Hash);
+    uint32_t ui32Counter = 0;
+    if (CountingBloomFilter_containsHash(cbfFilter, ui64Hash) == false){
+      return false;
+    }
+    for (ui32Counter = 0 ; ui32Counter < cbfFilter->ui8AmountOfHashes ; ui32Counter++){
+      uint32_t ui32Position = __BloomFilter_getPosition(PackedVector_getAmountOfValues(cbfFilter->pvCounters), &bpProbe);
+      uint32_t ui32Value = PackedVector_get(cbfFilter->pvCounters, ui32Position);
+      if (ui32Value > 0 && ui32Value < PackedVector_getMaxValue(cbfFilter->pvCounters)){
+        PackedVector_set(cbfFilter->pvCounters, ui32Position, ui32Value - 1);
+      }
+      bpProbe.ui32First = bpProbe.ui32First + bpProbe.ui32Step;
+    }
+    return true;
+  }
+
+  //! Function: Counting Bloom Filter Hash Checker
+  /*!
+    Checks if a key, by its hash, may be in a counting Bloom filter.
+    \param cbfFilter is a cbloomfilter_t type. It's the counting Bloom filter.
+    \param ui64Hash is a unsigned 64-bit integer. It's the key hash (see BloomFilter_hash).
+    \return Returns false if the key is not in the filter and true if it is (or for a false positive).
+  */
+  bool CountingBloomFilter_containsHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash){
+    bloomfilter_probe_t bpProbe = __BloomFilter_getProbe(ui64Hash);
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < cbfFilter->ui8AmountOfHashes ; ui32Counter++){
+      uint32_t ui32Position = __BloomFilter_getPosition(PackedVector_getAmountOfValues(cbfFilter->pvCounters), &bpProbe);
+      if (PackedVector_get(cbfFilter->pvCounters, ui32Position) == 0){
+        return false;
+      }
+      bpProbe.ui32First = bpProbe.ui32First + bpProbe.ui32Step;
+    }
+    return true;
+  }
+
+#endif
@@ -0,0 +1,265 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __BLOOM_FILTER_HEADER__
+  #define __BLOOM_FILTER_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+    #include "./PackedVector.h"
+
+    //! Macro: Bloom Filter Block Size
+    /*!
+      Amount of bits of each block of a blocked Bloom filter: a 64-byte cache line. All bits of a key are in the same block.
+    */
+    #define BLOOM_FILTER_BLOCK_SIZE 512
+
+    //! Macro: Counting Bloom Filter Counter Size
+    /*!
+      Amount of bits of each counter of a counting Bloom filter. Counters stop at their maximum value and are not decremented after it.
+    */
+    #define COUNTING_BLOOM_FILTER_COUNTER_SIZE 4
+
+    //! Macro: Bloom Filter Storage Alignment
+    /*!
+      Aligns the bits of the Bloom filters to the cache lines, so each block of a blocked Bloom filter is a single cache line.
+    */
+    #if defined(__GNUC__) || defined(__clang__)
+      #define __BLOOM_FILTER_ALIGNED__ __attribute__((aligned(64)))
+    #else
+      #define __BLOOM_FILTER_ALIGNED__
+    #endif
+
+    //! Type Definition: Bloom Filter Structure
+    /*!
+      Probabilistic set of keys on a bit vector: contains never fails for an added key, but it can be true for a key that was not added (false positive). A blocked Bloom filter puts all bits of a key in one cache line, one bit in each 64-bit word: a key is checked with one memory access and no branch for each bit, with a little more false positives.
+    */
+    typedef struct {
+      bitvector_t* const bvBits;                                                                                                    /*!< const bitvector_t pointer type. */
+      const uint32_t ui32AmountOfBits;                                                                                              /*!< const 32-bits integer type. */
+      const uint8_t ui8AmountOfHashes;                                                                                              /*!< const 8-bits integer type. */
+      const bool bBlocked;                                                                                                          /*!< const bool type. */
+    } bloomfilter_structure_t;
+
+    //! Type Definition: Bloom Filter Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef bloomfilter_structure_t* bloomfilter_t;
+
+    //! Type Definition: Counting Bloom Filter Structure
+    /*!
+      Bloom filter with a small counter (packed in a PackedVector) instead of each bit, so keys can be removed.
+    */
+    typedef struct {
+      packedvector_t const pvCounters;                                                                                              /*!< const packedvector_t type. */
+      const uint8_t ui8AmountOfHashes;                                                                                              /*!< const 8-bits integer type. */
+    } cbloomfilter_structure_t;
+
+    //! Type Definition: Counting Bloom Filter Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef cbloomfilter_structure_t* cbloomfilter_t;
+
+    //! Macros: Bloom Filter Size
+    /*!
+      Calculate the amount of blocks of a Bloom filter and the amount of 64-bit words of its bits. The bits are always a multiple of BLOOM_FILTER_BLOCK_SIZE.
+      \param uiAmountOfBits is a unsigned integer. It's the desirable amount of bits.
+      \return Returns the amount of blocks or words.
+    */
+    #define BloomFilter_getAmountOfBlocks(uiAmountOfBits)\
+      ((((uint32_t) (uiAmountOfBits)) + BLOOM_FILTER_BLOCK_SIZE - 1) / BLOOM_FILTER_BLOCK_SIZE)
+
+    #define BloomFilter_getSize(uiAmountOfBits)\
+      (BloomFilter_getAmountOfBlocks(uiAmountOfBits) * (BLOOM_FILTER_BLOCK_SIZE / 64))
+
+    //! Macro: Bloom Filter Creator
+    /*!
+      This macro creates an empty Bloom filter. About 10 bits and 7 hashes per key give 1% of false positives.
+      \param bfName is the Bloom filter name.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of bits set by each key.
+    */
+    #define newBloomFilter(bfName, uiAmountOfBits, uiAmountOfHashes)\
+      uint64_t __ui64BloomFilterBits##bfName[BloomFilter_getSize(uiAmountOfBits)] __BLOOM_FILTER_ALIGNED__ = {0};\
+      bloomfilter_structure_t __bfsBloomFilter##bfName = {\
+        .bvBits = (bitvector_t*) __ui64BloomFilterBits##bfName,\
+        .ui32AmountOfBits = uiAmountOfBits,\
+        .ui8AmountOfHashes = uiAmountOfHashes,\
+        .bBlocked = false\
+      };\
+      bloomfilter_t bfName = &__bfsBloomFilter##bfName
+
+    //! Macro: Static Bloom Filter Creator
+    /*!
+      This macro creates a static empty Bloom filter.
+      \param bfName is the Bloom filter name.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of bits set by each key.
+    */
+    #define newStaticBloomFilter(bfName, uiAmountOfBits, uiAmountOfHashes)\
+      static uint64_t __ui64BloomFilterBits##bfName[BloomFilter_getSize(uiAmountOfBits)] __BLOOM_FILTER_ALIGNED__ = {0};\
+      static bloomfilter_structure_t __bfsBloomFilter##bfName = {\
+        .bvBits = (bitvector_t*) __ui64BloomFilterBits##bfName,\
+        .ui32AmountOfBits = uiAmountOfBits,\
+        .ui8AmountOfHashes = uiAmountOfHashes,\
+        .bBlocked = false\
+      };\
+      static bloomfilter_t bfName = &__bfsBloomFilter##bfName
+
+    //! Macro: Blocked Bloom Filter Creator
+    /*!
+      This macro creates an empty blocked Bloom filter. The amount of bits is rounded up to a multiple of BLOOM_FILTER_BLOCK_SIZE.
+      \param bfName is the Bloom filter name.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of bits set by each key, up to 8 (one bit in each 64-bit word of the block).
+    */
+    #define newBlockedBloomFilter(bfName, uiAmountOfBits, uiAmountOfHashes)\
+      uint64_t __ui64BloomFilterBits##bfName[BloomFilter_getSize(uiAmountOfBits)] __BLOOM_FILTER_ALIGNED__ = {0};\
+      bloomfilter_structure_t __bfsBloomFilter##bfName = {\
+        .bvBits = (bitvector_t*) __ui64BloomFilterBits##bfName,\
+        .ui32AmountOfBits = BloomFilter_getAmountOfBlocks(uiAmountOfBits) * BLOOM_FILTER_BLOCK_SIZE,\
+        .ui8AmountOfHashes = uiAmountOfHashes,\
+        .bBlocked = true\
+      };\
+      bloomfilter_t bfName = &__bfsBloomFilter##bfName
+
+    //! Macro: Static Blocked Bloom Filter Creator
+    /*!
+      This macro creates a static empty blocked Bloom filter. The amount of bits is rounded up to a multiple of BLOOM_FILTER_BLOCK_SIZE.
+      \param bfName is the Bloom filter name.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of bits set by each key, up to 8 (one bit in each 64-bit word of the block).
+    */
+    #define newStaticBlockedBloomFilter(bfName, uiAmountOfBits, uiAmountOfHashes)\
+      static uint64_t __ui64BloomFilterBits##bfName[BloomFilter_getSize(uiAmountOfBits)] __BLOOM_FILTER_ALIGNED__ = {0};\
+      static bloomfilter_structure_t __bfsBloomFilter##bfName = {\
+        .bvBits = (bitvector_t*) __ui64BloomFilterBits##bfName,\
+        .ui32AmountOfBits = BloomFilter_getAmountOfBlocks(uiAmountOfBits) * BLOOM_FILTER_BLOCK_SIZE,\
+        .ui8AmountOfHashes = uiAmountOfHashes,\
+        .bBlocked = true\
+      };\
+      static bloomfilter_t bfName = &__bfsBloomFilter##bfName
+
+    //! Macro: Counting Bloom Filter Creator
+    /*!
+      This macro creates an empty counting Bloom filter.
+      \param cbfName is the counting Bloom filter name.
+      \param uiAmountOfCounters is a unsigned integer. It's the amount of counters.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of counters changed by each key.
+    */
+    #define newCountingBloomFilter(cbfName, uiAmountOfCounters, uiAmountOfHashes)\
+      bitvector_t __bvCountingBloomFilterCounters##cbfName[PackedVector_getSize(COUNTING_BLOOM_FILTER_COUNTER_SIZE, uiAmountOfCounters)] = {0};\
+      packedvector_structure_t __pvsCountingBloomFilterCounters##cbfName = {\
+        .bvData = __bvCountingBloomFilterCounters##cbfName,\
+        .ui32AmountOfValues = uiAmountOfCounters,\
+        .ui8BitWidth = COUNTING_BLOOM_FILTER_COUNTER_SIZE\
+      };\
+      cbloomfilter_structure_t __cbfsCountingBloomFilter##cbfName = {\
+        .pvCounters = &__pvsCountingBloomFilterCounters##cbfName,\
+        .ui8AmountOfHashes = uiAmountOfHashes\
+      };\
+      cbloomfilter_t cbfName = &__cbfsCountingBloomFilter##cbfName
+
+    //! Macro: Static Counting Bloom Filter Creator
+    /*!
+      This macro creates a static empty counting Bloom filter.
+      \param cbfName is the counting Bloom filter name.
+      \param uiAmountOfCounters is a unsigned integer. It's the amount of counters.
+      \param uiAmountOfHashes is a unsigned integer. It's the amount of counters changed by each key.
+    */
+    #define newStaticCountingBloomFilter(cbfName, uiAmountOfCounters, uiAmountOfHashes)\
+      static bitvector_t __bvCountingBloomFilterCounters##cbfName[PackedVector_getSize(COUNTING_BLOOM_FILTER_COUNTER_SIZE, uiAmountOfCounters)] = {0};\
+      static packedvector_structure_t __pvsCountingBloomFilterCounters##cbfName = {\
+        .bvData = __bvCountingBloomFilterCounters##cbfName,\
+        .ui32AmountOfValues = uiAmountOfCounters,\
+        .ui8BitWidth = COUNTING_BLOOM_FILTER_COUNTER_SIZE\
+      };\
+      static cbloomfilter_structure_t __cbfsCountingBloomFilter##cbfName = {\
+        .pvCounters = &__pvsCountingBloomFilterCounters##cbfName,\
+        .ui8AmountOfHashes = uiAmountOfHashes\
+      };\
+      static cbloomfilter_t cbfName = &__cbfsCountingBloomFilter##cbfName
+
+    //! Macros: Bloom Filter Key Operations
+    /*!
+      Add and check a key of any type. The key is hashed by BloomFilter_hash.
+      \param bfFilter is a bloomfilter_t or a cbloomfilter_t type. It's the filter.
+      \param vpKey is a void pointer. It's the key.
+      \param uiLength is a unsigned integer. It's the key size in bytes.
+    */
+    #define BloomFilter_add(bfFilter, vpKey, uiLength)\
+      BloomFilter_addHash(bfFilter, BloomFilter_hash(vpKey, uiLength))
+
+    #define BloomFilter_contains(bfFilter, vpKey, uiLength)\
+      BloomFilter_containsHash(bfFilter, BloomFilter_hash(vpKey, uiLength))
+
+    #define CountingBloomFilter_add(cbfFilter, vpKey, uiLength)\
+      CountingBloomFilter_addHash(cbfFilter, BloomFilter_hash(vpKey, uiLength))
+
+    #define CountingBloomFilter_remove(cbfFilter, vpKey, uiLength)\
+      CountingBloomFilter_removeHash(cbfFilter, BloomFilter_hash(vpKey, uiLength))
+
+    #define CountingBloomFilter_contains(cbfFilter, vpKey, uiLength)\
+      CountingBloomFilter_containsHash(cbfFilter, BloomFilter_hash(vpKey, uiLength))
+
+    uint64_t BloomFilter_hash(const void* vpKey, uint32_t ui32Length);                                                                               /*!< 64-bits integer type function. */
+    uint64_t BloomFilter_hashInteger(uint64_t ui64Key);                                                                                              /*!< 64-bits integer type function. */
+    void BloomFilter_clear(bloomfilter_t bfFilter);                                                                                                  /*!< void type function. */
+    void BloomFilter_addHash(bloomfilter_t bfFilter, uint64_t ui64Hash);                                                                             /*!< void type function. */
+    bool BloomFilter_containsHash(bloomfilter_t bfFilter, uint64_t ui64Hash);                                                                        /*!< bool type function. */
+    void BloomFilter_addBatch(bloomfilter_t bfFilter, const uint64_t* ui64pHashes, uint32_t ui32AmountOfHashes);                                     /*!< void type function. */
+    uint32_t BloomFilter_containsBatch(bloomfilter_t bfFilter, const uint64_t* ui64pHashes, uint32_t ui32AmountOfHashes, bool* bpResults);           /*!< 32-bits integer type function. */
+    void CountingBloomFilter_clear(cbloomfilter_t cbfFilter);                                                                                        /*!< void type function. */
+    void CountingBloomFilter_addHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash);                                                                   /*!< void type function. */
+    bool CountingBloomFilter_removeHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash);                                                                /*!< bool type function. */
+    bool CountingBloomFilter_containsHash(cbloomfilter_t cbfFilter, uint64_t ui64Hash);                                                              /*!< bool type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
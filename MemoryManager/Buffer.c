@@ -11,53 +11,535 @@
   #include "./Queue.h"
   #include "./Stack.h"
   #include "./Circular.h"
+  #include "./SPSC.h"
+  #include "./MPMC.h"
+  #if defined(__linux__)
+    #include "./BufferWait.h"
+  #endif
+
+  //! Private Function: Overwrite Policy Checker
+  /*!
+    Tell if the overflow policy of a queue, stack or circular buffer keeps the newest data.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns true if the oldest data is overwritten on overflow.
+  */
+  static inline bool __Buffer_dropsOldest(buffer_t bfBuffer){
+    return bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DEFAULT || bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_OLDEST;
+  }
+
+  #if defined(__BUFFER_CONCURRENT__)
+    //! Private Function: Concurrent Buffer Checker
+    /*!
+      Tell if a buffer can be shared by threads, so its indexes and statistics need atomic accesses.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \return Returns true on BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers.
+    */
+    static inline bool __Buffer_isConcurrent(buffer_t bfBuffer){
+      return bfBuffer->btBufferType == BUFFER_TYPE_SPSC || bfBuffer->btBufferType == BUFFER_TYPE_MPMC;
+    }
+
+    //! Private Functions: Parked Threads Wakers
+    /*!
+      Wake a thread parked by Buffer_popWait after data is published (data event), or a thread parked by Buffer_pushWait after slots are released (space event). Threads only park on Linux, so elsewhere they do nothing.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    */
+    static inline void __Buffer_wakeConsumer(buffer_t bfBuffer){
+      #if defined(__linux__)
+        __BufferWait_wake(&bfBuffer->biIndexes->ui32DataEvent, &bfBuffer->biIndexes->ui32DataWaiters);
+      #else
+        (void) bfBuffer;
+      #endif
+    }
+
+    static inline void __Buffer_wakeProducer(buffer_t bfBuffer){
+      #if defined(__linux__)
+        __BufferWait_wake(&bfBuffer->biIndexes->ui32SpaceEvent, &bfBuffer->biIndexes->ui32SpaceWaiters);
+      #else
+        (void) bfBuffer;
+      #endif
+    }
+
+    //! Private Function: Concurrent Buffer Writer
+    /*!
+      Write a data on a BUFFER_TYPE_SPSC or BUFFER_TYPE_MPMC buffer following its overflow policy, and wake a consumer parked by Buffer_popWait. A BUFFER_TYPE_MPMC producer drops the oldest data popping it, since any thread can pop; a BUFFER_TYPE_SPSC producer can't, so it drops the newest.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+      \return Returns false if the data was rejected.
+    */
+    static bool __Buffer_pushConcurrent(buffer_t bfBuffer, void* vpData){
+      buffer_overflow_t boOverflowPolicy = bfBuffer->boOverflowPolicy;
+      #if defined(__linux__)
+        if (boOverflowPolicy == BUFFER_OVERFLOW_BLOCK){
+          return Buffer_pushWait(bfBuffer, vpData, BUFFER_WAIT_FOREVER);
+        }
+      #endif
+      bool bPushed = (bfBuffer->btBufferType == BUFFER_TYPE_SPSC) ? __SPSCBuffer_push(bfBuffer, vpData) : __MPMCBuffer_push(bfBuffer, vpData);
+      if (bPushed == false && bfBuffer->btBufferType == BUFFER_TYPE_MPMC && boOverflowPolicy == BUFFER_OVERFLOW_DROP_OLDEST){
+        uint8_t ui8aOldestData[UINT8_MAX];
+        do {
+          if (__MPMCBuffer_tryPop(bfBuffer, ui8aOldestData) == true){
+            __Buffer_countOverruns(bfBuffer, 1);
+          }
+        } while (__MPMCBuffer_push(bfBuffer, vpData) == false);
+        bPushed = true;
+      }
+      if (bPushed == true){
+        __Buffer_wakeConsumer(bfBuffer);
+        return true;
+      }
+      __Buffer_countOverruns(bfBuffer, 1);
+      return boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST || boOverflowPolicy == BUFFER_OVERFLOW_DROP_OLDEST;
+    }
+  #endif
 
   //! Function: Buffer Writer
   /*!
-    Write a data on a buffer.
+    Write a data on a buffer, following its overflow policy (see Buffer_tryPush).
     \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
     \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
   */
   void Buffer_push(buffer_t bfBuffer, void* vpData){
+    Buffer_tryPush(bfBuffer, vpData);
+  }
+
+  //! Function: Buffer Try Writer
+  /*!
+    Write a data on a buffer. When the buffer is full, the overflow policy decides (see buffer_overflow_t): by default queue, stack and circular buffers overwrite their oldest data and BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers reject the new data. Every push on a full buffer counts an overrun.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the data was rejected (BUFFER_OVERFLOW_REJECT, or BUFFER_OVERFLOW_BLOCK where it can't wait).
+  */
+  bool Buffer_tryPush(buffer_t bfBuffer, void* vpData){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        return __Buffer_pushConcurrent(bfBuffer, vpData);
+      }
+    #endif
+    bool bPushed;
     switch(bfBuffer->btBufferType){
 
       case BUFFER_TYPE_QUEUE:
-        __QueueBuffer_push(bfBuffer, vpData);
+        bPushed = __QueueBuffer_push(bfBuffer, vpData);
         break;
 
       case BUFFER_TYPE_STACK:
-        __StackBuffer_push(bfBuffer, vpData);
+        bPushed = __StackBuffer_push(bfBuffer, vpData);
         break;
 
-      case BUFFER_TYPE_CIRCULAR:
-        __CircularBuffer_push(bfBuffer, vpData);
+      default:
+        bPushed = __CircularBuffer_push(bfBuffer, vpData);
+        break;
+
+    }
+    return bPushed == true || bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST;
+  }
+
+  //! Function: Buffer Try Reader
+  /*!
+    Copy the next data of a buffer. On BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers, the slot is released to the producers after the copy (and a producer parked by Buffer_pushWait is woken). A pop on an empty buffer counts an underrun.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \return Returns false if the buffer is empty.
+  */
+  bool Buffer_tryPop(buffer_t bfBuffer, void* vpData){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        #if defined(__linux__)
+          if (bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_BLOCK){
+            return Buffer_popWait(bfBuffer, vpData, 0);
+          }
+        #endif
+        bool bPopped = (bfBuffer->btBufferType == BUFFER_TYPE_SPSC) ? __SPSCBuffer_tryPop(bfBuffer, vpData) : __MPMCBuffer_tryPop(bfBuffer, vpData);
+        if (bPopped == false){
+          __Buffer_countUnderrun(bfBuffer);
+          return false;
+        }
+        __Buffer_wakeProducer(bfBuffer);
+        return true;
+      }
+    #endif
+    void* vpAdressBuffer = (Buffer_popAddress)(bfBuffer);
+    if (vpAdressBuffer == NULL){
+      return false;
+    }
+    memcpy(vpData, vpAdressBuffer, bfBuffer->ui8ElementSize);
+    return true;
+  }
+
+  //! Function: Buffer Bulk Writer
+  /*!
+    Write some data on a buffer, as many Buffer_push calls, with at most two copies (before and after the end of the vector) and one update of the indexes. Each data that doesn't fit follows the overflow policy and counts an overrun: by default, queue, stack and circular buffers keep only the newest data and BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers write the data that fits.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param vpData is a const void pointer. It's the vector of data to be inserted on the buffer (or NULL to insert zeros).
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data written (or accepted and dropped by BUFFER_OVERFLOW_DROP_NEWEST).
+  */
+  uint32_t Buffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData){
+    #if defined(__BUFFER_CONCURRENT__)
+      uint32_t ui32Counter = 0;
+    #endif
+    uint32_t ui32Accepted = ui32AmountOfData;
+    if (bfBuffer->btBufferType == BUFFER_TYPE_QUEUE || bfBuffer->btBufferType == BUFFER_TYPE_STACK || bfBuffer->btBufferType == BUFFER_TYPE_CIRCULAR){
+      uint32_t ui32Free = (uint32_t) (bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData);
+      if (ui32AmountOfData > ui32Free){
+        bfBuffer->ui32Overruns += ui32AmountOfData - ui32Free;
+        if (__Buffer_dropsOldest(bfBuffer) == false){
+          ui32AmountOfData = ui32Free;                                                                                            /*!< The newest data is discarded. */
+          ui32Accepted = (bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST) ? ui32Accepted : ui32Free;
+        }
+      }
+    }
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        __QueueBuffer_pushN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+      case BUFFER_TYPE_STACK:
+        __StackBuffer_pushN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          if (bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DEFAULT || bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_REJECT){
+            ui32Counter = __SPSCBuffer_pushN(bfBuffer, vpData, ui32AmountOfData);
+            if (ui32Counter < ui32AmountOfData){
+              __Buffer_countOverruns(bfBuffer, ui32AmountOfData - ui32Counter);
+            }
+            if (ui32Counter != 0){
+              __Buffer_wakeConsumer(bfBuffer);
+            }
+            return ui32Counter;
+          }
+          __attribute__((fallthrough));
+
+        case BUFFER_TYPE_MPMC:
+          for (ui32Counter = 0 ; ui32Counter < ui32AmountOfData ; ui32Counter++){
+            void* vpElement = (vpData == NULL) ? NULL : (char*) vpData + ui32Counter * bfBuffer->ui8ElementSize;
+            if (Buffer_tryPush(bfBuffer, vpElement) == false){
+              __Buffer_countOverruns(bfBuffer, ui32AmountOfData - ui32Counter - 1);                                                /*!< The rejected data after this one. */
+              break;
+            }
+          }
+          return ui32Counter;
+      #endif
+
+      default:
+        __CircularBuffer_pushN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+    }
+    __Buffer_raiseHighWaterMark(bfBuffer, bfBuffer->ui8AmountOfData);
+    return ui32Accepted;
+  }
+
+  //! Function: Buffer Bulk Reader
+  /*!
+    Copy some data of a buffer with at most two copies and one update of the indexes. The data is removed as Buffer_pop would remove it, but it's not always copied in the same order: a stack gives its newest data in the order they were pushed, so Buffer_popN after Buffer_pushN returns the same vector. A circular buffer keeps its data, so it keeps cycling over it as Buffer_tryPop does and only runs out of data when it's empty. If the buffer runs out of data, an underrun is counted.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfData is a 32-bits integer. It's the maximum amount of data.
+    \return Returns the amount of data read.
+  */
+  uint32_t Buffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData){
+    uint32_t ui32Counter = 0;
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        ui32Counter = __QueueBuffer_popN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+      case BUFFER_TYPE_STACK:
+        ui32Counter = __StackBuffer_popN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          if (bfBuffer->boOverflowPolicy != BUFFER_OVERFLOW_BLOCK){
+            ui32Counter = __SPSCBuffer_popN(bfBuffer, vpData, ui32AmountOfData);
+            if (ui32Counter < ui32AmountOfData){
+              __Buffer_countUnderrun(bfBuffer);
+            }
+            if (ui32Counter != 0){
+              __Buffer_wakeProducer(bfBuffer);
+            }
+            return ui32Counter;
+          }
+          __attribute__((fallthrough));
+
+        case BUFFER_TYPE_MPMC:
+          for (ui32Counter = 0 ; ui32Counter < ui32AmountOfData ; ui32Counter++){
+            if (Buffer_tryPop(bfBuffer, (char*) vpData + ui32Counter * bfBuffer->ui8ElementSize) == false){
+              break;
+            }
+          }
+          return ui32Counter;
+      #endif
+
+      default:
+        ui32Counter = __CircularBuffer_popN(bfBuffer, vpData, ui32AmountOfData);
+        break;
+
+    }
+    if (ui32Counter < ui32AmountOfData){
+      __Buffer_underflow(bfBuffer);
+    }
+    return ui32Counter;
+  }
+
+  //! Function: Buffer Slots Reserver
+  /*!
+    Reserve contiguous free slots of a BUFFER_TYPE_QUEUE or BUFFER_TYPE_SPSC buffer, so the data can be written straight on the buffer and published later with Buffer_commit. The slots end at the end of the vector: if less slots than desired are reserved, commit them and reserve again to continue from the start of the vector.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It's the desirable amount of slots and receives the amount of slots reserved.
+    \return Returns the address of the first slot or NULL if there are no free slots (or the buffer type doesn't support it).
+  */
+  void* Buffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        return __QueueBuffer_reserve(bfBuffer, ui8pAmountOfData);
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          return __SPSCBuffer_reserve(bfBuffer, ui8pAmountOfData);
+      #endif
+
+      default:
+        *ui8pAmountOfData = 0;
+        return NULL;
+
+    }
+  }
+
+  //! Function: Buffer Slots Committer
+  /*!
+    Publish the first slots reserved by Buffer_reserve as pending data.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of slots written, up to the amount reserved.
+  */
+  void Buffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        __QueueBuffer_commit(bfBuffer, ui8AmountOfData);
+        __Buffer_raiseHighWaterMark(bfBuffer, bfBuffer->ui8AmountOfData);
+        break;
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          __SPSCBuffer_commit(bfBuffer, ui8AmountOfData);
+          __Buffer_wakeConsumer(bfBuffer);
+          break;
+      #endif
+
+      default:
+        break;
+
+    }
+  }
+
+  //! Function: Buffer Data Peeker
+  /*!
+    Get the contiguous pending data of a BUFFER_TYPE_QUEUE or BUFFER_TYPE_SPSC buffer without removing it, so it can be read straight on the buffer and removed later with Buffer_consume. The data ends at the end of the vector: consume it and peek again to get the data at the start of the vector.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It receives the amount of contiguous pending data.
+    \return Returns the address of the oldest data or NULL if the buffer is empty (or the buffer type doesn't support it).
+  */
+  void* Buffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        return __QueueBuffer_peek(bfBuffer, ui8pAmountOfData);
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          return __SPSCBuffer_peek(bfBuffer, ui8pAmountOfData);
+      #endif
+
+      default:
+        *ui8pAmountOfData = 0;
+        return NULL;
+
+    }
+  }
+
+  //! Function: Buffer Data Consumer
+  /*!
+    Remove the oldest data returned by Buffer_peek.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of data, up to the amount peeked.
+  */
+  void Buffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        __QueueBuffer_consume(bfBuffer, ui8AmountOfData);
+        break;
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          __SPSCBuffer_consume(bfBuffer, ui8AmountOfData);
+          __Buffer_wakeProducer(bfBuffer);
+          break;
+      #endif
+
+      default:
+        break;
+
+    }
+  }
+
+  //! Private Function: Oldest Data Position Getter
+  /*!
+    Get the slot of the oldest pending data of a queue, stack or circular buffer. The pending data of a stack buffer ends at its read position (the top) and the pending data of a circular buffer ends before its write position.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns the slot of the oldest data.
+  */
+  static uint8_t __Buffer_getOldestPosition(buffer_t bfBuffer){
+    uint32_t ui32Position;
+    switch(bfBuffer->btBufferType){
+
+      case BUFFER_TYPE_QUEUE:
+        return bfBuffer->ui8ReadPosition;
+
+      case BUFFER_TYPE_STACK:
+        ui32Position = (uint32_t) bfBuffer->ui8ReadPosition + 1 + bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData;
+        break;
+
+      default:
+        ui32Position = (uint32_t) bfBuffer->ui8WritePosition + bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData;
         break;
 
     }
+    return (uint8_t) (ui32Position % bfBuffer->ui8BufferSize);
+  }
+
+  //! Function: Buffer Indexed Data Getter
+  /*!
+    Get the address of a pending data of a BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR buffer without removing it or moving its read position. The index 0 is the oldest data and the index Buffer_getAmountOfPendingData - 1 is the newest data, on every buffer type.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param ui8Index is a 8-bits integer. It's the index of the data.
+    \return Returns the address of the data or NULL if the index is out of the pending data (or the buffer type doesn't support it).
+  */
+  void* Buffer_at(buffer_t bfBuffer, uint8_t ui8Index){
+    if (bfBuffer->btBufferType == BUFFER_TYPE_SPSC || bfBuffer->btBufferType == BUFFER_TYPE_MPMC || ui8Index >= bfBuffer->ui8AmountOfData){
+      return NULL;
+    }
+    uint32_t ui32Position = (uint32_t) __Buffer_getOldestPosition(bfBuffer) + ui8Index;
+    if (ui32Position >= bfBuffer->ui8BufferSize){
+      ui32Position = ui32Position - bfBuffer->ui8BufferSize;
+    }
+    return (char*) bfBuffer->vpVector + ui32Position * bfBuffer->ui8ElementSize;
+  }
+
+  //! Function: Buffer Span Getter
+  /*!
+    Get all the pending data of a BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR buffer as two contiguous segments, from the oldest to the newest data, without removing it. The span is valid until the next change of the buffer.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param bsSpan is a bufferspan_t type. It receives the segments (both empty if the buffer type doesn't support it).
+    \return Returns false if the buffer type doesn't support it.
+  */
+  bool Buffer_getSpan(buffer_t bfBuffer, bufferspan_t bsSpan){
+    bsSpan->vpFirst = bfBuffer->vpVector;
+    bsSpan->ui8FirstAmount = 0;
+    bsSpan->vpSecond = bfBuffer->vpVector;
+    bsSpan->ui8SecondAmount = 0;
+    if (bfBuffer->btBufferType == BUFFER_TYPE_SPSC || bfBuffer->btBufferType == BUFFER_TYPE_MPMC){
+      return false;
+    }
+    if (bfBuffer->ui8AmountOfData == 0){
+      return true;
+    }
+    uint8_t ui8Position = __Buffer_getOldestPosition(bfBuffer);
+    uint8_t ui8Contiguous = bfBuffer->ui8BufferSize - ui8Position;
+    bsSpan->vpFirst = (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
+    bsSpan->ui8FirstAmount = (bfBuffer->ui8AmountOfData < ui8Contiguous) ? bfBuffer->ui8AmountOfData : ui8Contiguous;
+    bsSpan->ui8SecondAmount = bfBuffer->ui8AmountOfData - bsSpan->ui8FirstAmount;
+    return true;
+  }
+
+  //! Private Function: Buffer Slots Writer
+  /*!
+    Copy data to consecutive slots of a buffer, wrapping to the first slot at a limit.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8Position is a 8-bits integer. It's the first slot.
+    \param ui8Limit is a 8-bits integer. It's the slot where the copy wraps.
+    \param vpData is a const void pointer. It's the data (or NULL to write zeros).
+    \param ui8Amount is a 8-bits integer. It's the amount of slots, up to the limit.
+  */
+  void __Buffer_writeSlots(buffer_t bfBuffer, uint8_t ui8Position, uint8_t ui8Limit, const void* vpData, uint8_t ui8Amount){
+    size_t szFirstAmount = (ui8Amount < ui8Limit - ui8Position) ? ui8Amount : (size_t) (ui8Limit - ui8Position);
+    size_t szFirstSize = szFirstAmount * bfBuffer->ui8ElementSize;
+    size_t szSecondSize = (ui8Amount - szFirstAmount) * bfBuffer->ui8ElementSize;
+    char* cpSlot = (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
+    if (vpData != NULL){
+      memcpy(cpSlot, vpData, szFirstSize);
+      memcpy(bfBuffer->vpVector, (const char*) vpData + szFirstSize, szSecondSize);
+    }
+    else{
+      memset(cpSlot, 0, szFirstSize);
+      memset(bfBuffer->vpVector, 0, szSecondSize);
+    }
+  }
+
+  //! Private Function: Buffer Slots Reader
+  /*!
+    Copy data of consecutive slots of a buffer, wrapping to the first slot at a limit.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8Position is a 8-bits integer. It's the first slot.
+    \param ui8Limit is a 8-bits integer. It's the slot where the copy wraps.
+    \param vpData is a void pointer. It receives the data.
+    \param ui8Amount is a 8-bits integer. It's the amount of slots, up to the limit.
+  */
+  void __Buffer_readSlots(buffer_t bfBuffer, uint8_t ui8Position, uint8_t ui8Limit, void* vpData, uint8_t ui8Amount){
+    size_t szFirstAmount = (ui8Amount < ui8Limit - ui8Position) ? ui8Amount : (size_t) (ui8Limit - ui8Position);
+    size_t szFirstSize = szFirstAmount * bfBuffer->ui8ElementSize;
+    memcpy(vpData, (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize, szFirstSize);
+    memcpy((char*) vpData + szFirstSize, bfBuffer->vpVector, (ui8Amount - szFirstAmount) * bfBuffer->ui8ElementSize);
   }
 
   //! Private Function: Buffer Reader
   /*!
-    Pull buffer address data.
+    Pull buffer address data. A BUFFER_TYPE_MPMC buffer can't lend its slots, so it always returns NULL (use Buffer_tryPop). A pop on an empty buffer counts an underrun.
     \param bfBuffer is a buffer_t type. This parameter is a initialized buffer.
     \return Returns data buffer adress.
   */
   void* (Buffer_popAddress)(buffer_t bfBuffer){
+    void* vpAdressBuffer;
     switch(bfBuffer->btBufferType){
 
       case BUFFER_TYPE_QUEUE:
-        return __QueueBuffer_pop(bfBuffer);
+        vpAdressBuffer = __QueueBuffer_pop(bfBuffer);
+        break;
 
       case BUFFER_TYPE_STACK:
-        return __StackBuffer_pop(bfBuffer);
+        vpAdressBuffer = __StackBuffer_pop(bfBuffer);
+        break;
 
       case BUFFER_TYPE_CIRCULAR:
-        return __CircularBuffer_pop(bfBuffer);
+        vpAdressBuffer = __CircularBuffer_pop(bfBuffer);
+        break;
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          vpAdressBuffer = __SPSCBuffer_pop(bfBuffer);
+          if (vpAdressBuffer == NULL){
+            __Buffer_countUnderrun(bfBuffer);
+            return NULL;
+          }
+          __Buffer_wakeProducer(bfBuffer);
+          return vpAdressBuffer;
+      #endif
 
       default:
         return NULL;
 
     }
+    if (vpAdressBuffer == NULL){
+      __Buffer_underflow(bfBuffer);
+    }
+    return vpAdressBuffer;
   }
 
   //! Function: Amount of Pending Data Getter
@@ -67,7 +549,20 @@
     \return Returns the amount of pending data.
   */
   uint8_t Buffer_getAmountOfPendingData(buffer_t bfBuffer){
-    return bfBuffer->ui8AmountOfData;
+    switch(bfBuffer->btBufferType){
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          return __SPSCBuffer_getAmountOfPendingData(bfBuffer);
+
+        case BUFFER_TYPE_MPMC:
+          return __MPMCBuffer_getAmountOfPendingData(bfBuffer);
+      #endif
+
+      default:
+        return bfBuffer->ui8AmountOfData;
+
+    }
   }
 
   //! Function: Buffer Cleaner
@@ -76,9 +571,25 @@
     \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
   */
   void Buffer_clear(buffer_t bfBuffer){
-    bfBuffer->ui8ReadPosition = 0;
-    bfBuffer->ui8WritePosition = 0;
-    bfBuffer->ui8AmountOfData = 0;
+    switch(bfBuffer->btBufferType){
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          __SPSCBuffer_clear(bfBuffer);
+          break;
+
+        case BUFFER_TYPE_MPMC:
+          __MPMCBuffer_clear(bfBuffer);
+          break;
+      #endif
+
+      default:
+        bfBuffer->ui8ReadPosition = 0;
+        bfBuffer->ui8WritePosition = 0;
+        bfBuffer->ui8AmountOfData = 0;
+        break;
+
+    }
   }
 
   //! Function: Write Position Getter
@@ -88,7 +599,20 @@
     \return Returns write position.
   */
   uint8_t Buffer_getWritePosition(buffer_t bfBuffer){
-    return bfBuffer->ui8WritePosition;
+    switch(bfBuffer->btBufferType){
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          return __SPSCBuffer_getWritePosition(bfBuffer);
+
+        case BUFFER_TYPE_MPMC:
+          return __MPMCBuffer_getWritePosition(bfBuffer);
+      #endif
+
+      default:
+        return bfBuffer->ui8WritePosition;
+
+    }
   }
 
   //! Function: Read Position Getter
@@ -98,7 +622,94 @@
     \return Returns read position.
   */
   uint8_t Buffer_getReadPosition(buffer_t bfBuffer){
-    return bfBuffer->ui8ReadPosition;
+    switch(bfBuffer->btBufferType){
+
+      #if defined(__BUFFER_CONCURRENT__)
+        case BUFFER_TYPE_SPSC:
+          return __SPSCBuffer_getReadPosition(bfBuffer);
+
+        case BUFFER_TYPE_MPMC:
+          return __MPMCBuffer_getReadPosition(bfBuffer);
+      #endif
+
+      default:
+        return bfBuffer->ui8ReadPosition;
+
+    }
+  }
+
+  //! Function: Overflow Policy Setter
+  /*!
+    Set what a push does when the buffer is full (see buffer_overflow_t). Set it before the buffer is shared by threads.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param boOverflowPolicy is a buffer_overflow_t type. It's the overflow policy.
+  */
+  void Buffer_setOverflowPolicy(buffer_t bfBuffer, buffer_overflow_t boOverflowPolicy){
+    bfBuffer->boOverflowPolicy = boOverflowPolicy;
+  }
+
+  //! Function: Overruns Getter
+  /*!
+    Get the amount of data dropped or rejected (or delayed, with BUFFER_OVERFLOW_BLOCK) because the buffer was full.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \return Returns the amount of overruns.
+  */
+  uint32_t Buffer_getOverruns(buffer_t bfBuffer){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        return __atomic_load_n(&bfBuffer->ui32Overruns, __ATOMIC_RELAXED);
+      }
+    #endif
+    return bfBuffer->ui32Overruns;
+  }
+
+  //! Function: Underruns Getter
+  /*!
+    Get the amount of pops that found the buffer empty.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \return Returns the amount of underruns.
+  */
+  uint32_t Buffer_getUnderruns(buffer_t bfBuffer){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        return __atomic_load_n(&bfBuffer->ui32Underruns, __ATOMIC_RELAXED);
+      }
+    #endif
+    return bfBuffer->ui32Underruns;
+  }
+
+  //! Function: High-Water Mark Getter
+  /*!
+    Get the biggest amount of pending data since the buffer was created or its statistics were reset. BUFFER_TYPE_SPSC buffers sample it when a thread reloads the counter of the other thread (always when the buffer gets full or empty), and BUFFER_TYPE_MPMC buffers sample it once per turn of the buffer and when a push finds it full, so short peaks between samples can be missed.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \return Returns the high-water mark.
+  */
+  uint8_t Buffer_getHighWaterMark(buffer_t bfBuffer){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        return __atomic_load_n(&bfBuffer->ui8HighWaterMark, __ATOMIC_RELAXED);
+      }
+    #endif
+    return bfBuffer->ui8HighWaterMark;
+  }
+
+  //! Function: Statistics Cleaner
+  /*!
+    Reset the overruns, the underruns and the high-water mark of a buffer. Buffer_clear keeps them.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+  */
+  void Buffer_resetStatistics(buffer_t bfBuffer){
+    #if defined(__BUFFER_CONCURRENT__)
+      if (__Buffer_isConcurrent(bfBuffer) == true){
+        __atomic_store_n(&bfBuffer->ui32Overruns, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&bfBuffer->ui32Underruns, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&bfBuffer->ui8HighWaterMark, 0, __ATOMIC_RELAXED);
+        return;
+      }
+    #endif
+    bfBuffer->ui32Overruns = 0;
+    bfBuffer->ui32Underruns = 0;
+    bfBuffer->ui8HighWaterMark = 0;
   }
 
 #endif
@@ -45,6 +45,12 @@
     #endif
 
     #include <stdint.h>
+    #include <stddef.h>
+    #include <EmbeddedTools.h>
+
+    #if defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+      #define __BUFFER_CONCURRENT__
+    #endif
 
     //! Enumeration Definition: Buffer Type
     /*!
@@ -53,12 +59,65 @@
     typedef enum {
       BUFFER_TYPE_STACK = 0,
       BUFFER_TYPE_QUEUE,
-      BUFFER_TYPE_CIRCULAR
+      BUFFER_TYPE_CIRCULAR,
+      BUFFER_TYPE_SPSC,
+      BUFFER_TYPE_MPMC
     } buffer_type_t;
 
+    //! Enumeration Definition: Buffer Overflow Policy
+    /*!
+      What a push does when the buffer is full:
+        - BUFFER_OVERFLOW_DEFAULT: the behavior of the buffer type (drop oldest on queue, stack and circular buffers; reject on BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers);
+        - BUFFER_OVERFLOW_DROP_OLDEST: the oldest data is discarded to insert the new data (a BUFFER_TYPE_SPSC producer can't remove data, so it drops the newest);
+        - BUFFER_OVERFLOW_DROP_NEWEST: the new data is discarded and the push still succeeds;
+        - BUFFER_OVERFLOW_REJECT: the new data is discarded and the push fails (Buffer_tryPush returns false);
+        - BUFFER_OVERFLOW_BLOCK: the push waits for a free slot with Buffer_pushWait (BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers on Linux; the other cases reject, since nobody else could free a slot). The producers are woken by any pop of the buffer.
+    */
+    typedef enum {
+      BUFFER_OVERFLOW_DEFAULT = 0,
+      BUFFER_OVERFLOW_DROP_OLDEST,
+      BUFFER_OVERFLOW_DROP_NEWEST,
+      BUFFER_OVERFLOW_REJECT,
+      BUFFER_OVERFLOW_BLOCK
+    } buffer_overflow_t;
+
+    //! Macro: Buffer Index Alignment
+    /*!
+      Aligns the indexes of a single-producer/single-consumer or multi-producer/multi-consumer buffer to the cache lines, so the producers and the consumers never write on the same cache line.
+    */
+    #if defined(__GNUC__) || defined(__clang__)
+      #define __BUFFER_ALIGNED__ __attribute__((aligned(64)))
+    #else
+      #define __BUFFER_ALIGNED__
+    #endif
+
+    //! Type Definition: Buffer Indexes Structure
+    /*!
+      Indexes of a single-producer/single-consumer buffer. The counters run from 0 to twice the buffer size, so a full buffer is different of an empty buffer without an amount of data shared by both threads. The producer line is only written by the producer and the consumer line only by the consumer; each side keeps a cached copy of the other counter and only reloads it when the buffer seems full or empty. The last line is only used by the threads parked by Buffer_popWait (data events) and Buffer_pushWait (space events). A multi-producer/multi-consumer buffer only uses the write and read counters, which run freely and are claimed with compare-and-swap.
+    */
+    typedef struct {
+      __BUFFER_ALIGNED__ uint32_t ui32WriteCounter;                                                                                 /*!< 32-bits integer type. */
+      uint32_t ui32CachedReadCounter;                                                                                               /*!< 32-bits integer type. */
+      __BUFFER_ALIGNED__ uint32_t ui32ReadCounter;                                                                                  /*!< 32-bits integer type. */
+      uint32_t ui32CachedWriteCounter;                                                                                              /*!< 32-bits integer type. */
+      uint32_t ui32PopCounter;                                                                                                      /*!< 32-bits integer type. */
+      __BUFFER_ALIGNED__ uint32_t ui32DataEvent;                                                                                    /*!< 32-bits integer type. */
+      uint32_t ui32DataWaiters;                                                                                                     /*!< 32-bits integer type. */
+      uint32_t ui32DataSpinLimit;                                                                                                   /*!< 32-bits integer type. */
+      uint32_t ui32SpaceEvent;                                                                                                      /*!< 32-bits integer type. */
+      uint32_t ui32SpaceWaiters;                                                                                                    /*!< 32-bits integer type. */
+      uint32_t ui32SpaceSpinLimit;                                                                                                  /*!< 32-bits integer type. */
+    } bufferindexes_structure_t;
+
+    //! Type Definition: Buffer Indexes Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef bufferindexes_structure_t* bufferindexes_t;
+
     //! Type Definition: Buffer Structure
     /*!
-      Structure of circular buffer.
+      Structure of circular buffer. The overflow policy and the statistics (overruns, underruns and high-water mark) start zeroed: default policy and nothing counted.
     */
     typedef struct {
       void* const vpVector;                                                                                                         /*!< const void pointer type. */
@@ -68,6 +127,12 @@
       uint8_t ui8WritePosition;                                                                                                     /*!< 8-bits integer type. */
       uint8_t ui8AmountOfData;                                                                                                      /*!< const 8-bits integer type. */
       const buffer_type_t btBufferType;                                                                                             /*!< const buffer_type_t type. */
+      bufferindexes_t const biIndexes;                                                                                              /*!< const bufferindexes_t type. */
+      uint32_t* const ui32pSequences;                                                                                               /*!< const 32-bits integer pointer type. */
+      buffer_overflow_t boOverflowPolicy;                                                                                           /*!< buffer_overflow_t type. */
+      uint32_t ui32Overruns;                                                                                                        /*!< 32-bits integer type. */
+      uint32_t ui32Underruns;                                                                                                       /*!< 32-bits integer type. */
+      uint8_t ui8HighWaterMark;                                                                                                     /*!< 8-bits integer type. */
     } buffer_structure_t;
 
     //! Type Definition: Buffer Pointer
@@ -76,11 +141,28 @@
     */
     typedef buffer_structure_t* buffer_t;
 
+    //! Type Definition: Buffer Span Structure
+    /*!
+      View of the pending data of a buffer, from the oldest to the newest data, as two contiguous segments of the vector: the second segment is the data wrapped to the start of the vector (it's empty if the data doesn't wrap).
+    */
+    typedef struct {
+      void* vpFirst;                                                                                                                /*!< void pointer type. */
+      uint8_t ui8FirstAmount;                                                                                                       /*!< 8-bits integer type. */
+      void* vpSecond;                                                                                                               /*!< void pointer type. */
+      uint8_t ui8SecondAmount;                                                                                                      /*!< 8-bits integer type. */
+    } bufferspan_structure_t;
+
+    //! Type Definition: Buffer Span Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef bufferspan_structure_t* bufferspan_t;
+
     //! Private Function: Buffer Creator
     /*!
       Create a buffer.
       \param bfBufferName is a buffer name.
-      \param btTypeOfBuffer is a buffer_type_t type. The available values are BUFFER_TYPE_STACK, BUFFER_TYPE_QUEUE or BUFFER_TYPE_CIRCULAR.
+      \param btTypeOfBuffer is a buffer_type_t type. The available values are BUFFER_TYPE_STACK, BUFFER_TYPE_QUEUE or BUFFER_TYPE_CIRCULAR (BUFFER_TYPE_SPSC buffers are created with newSPSCBuffer).
       \param xDataType is the type of receiving buffer data.
       \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size.
     */
@@ -101,7 +183,7 @@
     /*!
       Create a static buffer.
       \param bfBufferName is a buffer name.
-      \param btTypeOfBuffer is a buffer_type_t type. The available values are BUFFER_TYPE_STACK, BUFFER_TYPE_QUEUE or BUFFER_TYPE_CIRCULAR.
+      \param btTypeOfBuffer is a buffer_type_t type. The available values are BUFFER_TYPE_STACK, BUFFER_TYPE_QUEUE or BUFFER_TYPE_CIRCULAR (BUFFER_TYPE_SPSC buffers are created with newSPSCBuffer).
       \param xDataType is the type of receiving buffer data.
       \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size.
     */
@@ -118,6 +200,283 @@
       };\
       static buffer_t bfBufferName = &__bfhBufferHandler##bfBufferName;
 
+    #if defined(__BUFFER_CONCURRENT__)
+      //! Macro: Single-Producer/Single-Consumer Buffer Creator
+      /*!
+        Create a BUFFER_TYPE_SPSC buffer. One thread can push while another thread pops, without locks: Buffer_tryPush fails when the buffer is full instead of discarding data. The address returned by Buffer_popAddress is valid until the next pop of the consumer; use Buffer_tryPop to copy the data and release the slot at once. Buffer_clear is not thread safe.
+        \param bfBufferName is a buffer name.
+        \param xDataType is the type of receiving buffer data.
+        \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size.
+      */
+      #define newSPSCBuffer(bfBufferName, xDataType, ui8SizeOfBuffer)\
+        xDataType __xBufferVector##bfBufferName[ui8SizeOfBuffer] = {0};\
+        bufferindexes_structure_t __bisBufferIndexes##bfBufferName = {0};\
+        buffer_structure_t __bfhBufferStructure##bfBufferName = {\
+          .vpVector = (void*) __xBufferVector##bfBufferName,\
+          .ui8ElementSize = sizeof(xDataType),\
+          .ui8BufferSize = ui8SizeOfBuffer,\
+          .ui8ReadPosition = 0,\
+          .ui8WritePosition = 0,\
+          .ui8AmountOfData = 0,\
+          .btBufferType = BUFFER_TYPE_SPSC,\
+          .biIndexes = &(__bisBufferIndexes##bfBufferName)\
+        };\
+        buffer_t bfBufferName = &(__bfhBufferStructure##bfBufferName);\
+
+      //! Macro: Static Single-Producer/Single-Consumer Buffer Creator
+      /*!
+        Create a static BUFFER_TYPE_SPSC buffer (see newSPSCBuffer).
+        \param bfBufferName is a buffer name.
+        \param xDataType is the type of receiving buffer data.
+        \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size.
+      */
+      #define newStaticSPSCBuffer(bfBufferName, xDataType, ui8SizeOfBuffer)\
+        static xDataType __xBufferVector##bfBufferName[ui8SizeOfBuffer] = {0};\
+        static bufferindexes_structure_t __bisBufferIndexes##bfBufferName = {0};\
+        static buffer_structure_t __bfhBufferHandler##bfBufferName = {\
+          .vpVector = (void*) __xBufferVector##bfBufferName,\
+          .ui8ElementSize = sizeof(xDataType),\
+          .ui8BufferSize = ui8SizeOfBuffer,\
+          .ui8ReadPosition = 0,\
+          .ui8WritePosition = 0,\
+          .ui8AmountOfData = 0,\
+          .btBufferType = BUFFER_TYPE_SPSC,\
+          .biIndexes = &__bisBufferIndexes##bfBufferName\
+        };\
+        static buffer_t bfBufferName = &__bfhBufferHandler##bfBufferName;
+
+      //! Macro: Multi-Producer/Multi-Consumer Buffer Creator
+      /*!
+        Create a BUFFER_TYPE_MPMC buffer: a bounded lock-free queue shared by any amount of producer and consumer threads. Each slot has a sequence number that tells if it's ready to be written or read at a position, so a thread only needs a compare-and-swap on one counter to claim a slot. The sequences are stored relative to the slot index, so a zeroed buffer is an empty buffer. Use Buffer_tryPush and Buffer_tryPop: the data is copied out of the slot before it's released, so Buffer_popAddress always returns NULL on this type.
+        \param bfBufferName is a buffer name.
+        \param xDataType is the type of receiving buffer data.
+        \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size. It must be a power of two (a compilation error is generated otherwise).
+      */
+      #define newMPMCBuffer(bfBufferName, xDataType, ui8SizeOfBuffer)\
+        xDataType __xBufferVector##bfBufferName[(((ui8SizeOfBuffer) & ((ui8SizeOfBuffer) - 1)) == 0) ? (ui8SizeOfBuffer) : -1] = {0};\
+        uint32_t __ui32BufferSequences##bfBufferName[ui8SizeOfBuffer] = {0};\
+        bufferindexes_structure_t __bisBufferIndexes##bfBufferName = {0};\
+        buffer_structure_t __bfhBufferStructure##bfBufferName = {\
+          .vpVector = (void*) __xBufferVector##bfBufferName,\
+          .ui8ElementSize = sizeof(xDataType),\
+          .ui8BufferSize = ui8SizeOfBuffer,\
+          .ui8ReadPosition = 0,\
+          .ui8WritePosition = 0,\
+          .ui8AmountOfData = 0,\
+          .btBufferType = BUFFER_TYPE_MPMC,\
+          .biIndexes = &(__bisBufferIndexes##bfBufferName),\
+          .ui32pSequences = __ui32BufferSequences##bfBufferName\
+        };\
+        buffer_t bfBufferName = &(__bfhBufferStructure##bfBufferName);\
+
+      //! Macro: Static Multi-Producer/Multi-Consumer Buffer Creator
+      /*!
+        Create a static BUFFER_TYPE_MPMC buffer (see newMPMCBuffer).
+        \param bfBufferName is a buffer name.
+        \param xDataType is the type of receiving buffer data.
+        \param ui8SizeOfBuffer is a 8-Bit integer. Its buffer size. It must be a power of two.
+      */
+      #define newStaticMPMCBuffer(bfBufferName, xDataType, ui8SizeOfBuffer)\
+        static xDataType __xBufferVector##bfBufferName[(((ui8SizeOfBuffer) & ((ui8SizeOfBuffer) - 1)) == 0) ? (ui8SizeOfBuffer) : -1] = {0};\
+        static uint32_t __ui32BufferSequences##bfBufferName[ui8SizeOfBuffer] = {0};\
+        static bufferindexes_structure_t __bisBufferIndexes##bfBufferName = {0};\
+        static buffer_structure_t __bfhBufferHandler##bfBufferName = {\
+          .vpVector = (void*) __xBufferVector##bfBufferName,\
+          .ui8ElementSize = sizeof(xDataType),\
+          .ui8BufferSize = ui8SizeOfBuffer,\
+          .ui8ReadPosition = 0,\
+          .ui8WritePosition = 0,\
+          .ui8AmountOfData = 0,\
+          .btBufferType = BUFFER_TYPE_MPMC,\
+          .biIndexes = &__bisBufferIndexes##bfBufferName,\
+          .ui32pSequences = __ui32BufferSequences##bfBufferName\
+        };\
+        static buffer_t bfBufferName = &__bfhBufferHandler##bfBufferName;
+    #endif
+
+    //! Private Functions: Buffer Statistics
+    /*!
+      Count a read of an empty buffer (underrun) and raise the high-water mark to an amount of pending data. Queue, stack and circular buffers are never shared by threads, so they use these plain versions (and __Buffer_overflow) and the compiler can keep optimizing the loops around them.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \param ui8Amount is a 8-bits integer. It's the amount of pending data.
+    */
+    static inline void __Buffer_underflow(buffer_t bfBuffer){
+      bfBuffer->ui32Underruns++;
+    }
+
+    static inline void __Buffer_raiseHighWaterMark(buffer_t bfBuffer, uint8_t ui8Amount){
+      if (ui8Amount > bfBuffer->ui8HighWaterMark){
+        bfBuffer->ui8HighWaterMark = ui8Amount;
+      }
+    }
+
+    #if defined(__BUFFER_CONCURRENT__)
+      //! Private Functions: Concurrent Buffer Statistics
+      /*!
+        Count data dropped or rejected on a full buffer (overruns) and reads of an empty buffer (underruns), and raise the high-water mark of a BUFFER_TYPE_SPSC or BUFFER_TYPE_MPMC buffer. They are relaxed atomics, so the threads can share them, and the mark is only written when it grows.
+        \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+        \param ui32Amount is a 32-bits integer. It's the amount of data dropped or pending.
+      */
+      static inline void __Buffer_countOverruns(buffer_t bfBuffer, uint32_t ui32Amount){
+        __atomic_fetch_add(&bfBuffer->ui32Overruns, ui32Amount, __ATOMIC_RELAXED);
+      }
+
+      static inline void __Buffer_countUnderrun(buffer_t bfBuffer){
+        __atomic_fetch_add(&bfBuffer->ui32Underruns, 1, __ATOMIC_RELAXED);
+      }
+
+      static inline void __Buffer_updateHighWaterMark(buffer_t bfBuffer, uint32_t ui32Amount){
+        uint8_t ui8HighWaterMark = __atomic_load_n(&bfBuffer->ui8HighWaterMark, __ATOMIC_RELAXED);
+        while (ui32Amount > ui8HighWaterMark && __atomic_compare_exchange_n(&bfBuffer->ui8HighWaterMark, &ui8HighWaterMark, (uint8_t) ui32Amount, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == false){
+        }
+      }
+    #endif
+
+    //! Private Function: Full Buffer Push Checker
+    /*!
+      Count the overrun of a push on a full queue, stack or circular buffer and tell if the push can go on overwriting the oldest data.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \return Returns true if the oldest data is dropped; false if the new data must be discarded.
+    */
+    static inline bool __Buffer_overflow(buffer_t bfBuffer){
+      bfBuffer->ui32Overruns++;
+      return bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DEFAULT || bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_OLDEST;
+    }
+
+    //! Private Macro: Discarded Position
+    /*!
+      Position returned for a push that must be discarded. Buffers have up to 255 slots, so it's never a slot.
+    */
+    #define __BUFFER_DISCARDED_POSITION__ UINT8_MAX
+
+    //! Private Functions: Queue Buffer Positions
+    /*!
+      Get the slot of the next push or pop of a queue buffer and update its indexes. The pop position needs pending data. They don't depend on the element type, so the generic and the typed buffers share them.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \return Returns the slot position (or __BUFFER_DISCARDED_POSITION__ if a push on a full buffer must discard the new data, following the overflow policy).
+    */
+    static inline uint8_t __QueueBuffer_nextWritePosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8WritePosition;
+      if (bfBuffer->ui8AmountOfData == bfBuffer->ui8BufferSize){
+        if (__Buffer_overflow(bfBuffer) == false){
+          return __BUFFER_DISCARDED_POSITION__;
+        }
+        bfBuffer->ui8ReadPosition = (bfBuffer->ui8ReadPosition == bfBuffer->ui8BufferSize - 1) ? 0 : bfBuffer->ui8ReadPosition + 1;
+      }
+      else{
+        bfBuffer->ui8AmountOfData++;
+        __Buffer_raiseHighWaterMark(bfBuffer, bfBuffer->ui8AmountOfData);
+      }
+      bfBuffer->ui8WritePosition = (ui8Position == bfBuffer->ui8BufferSize - 1) ? 0 : ui8Position + 1;
+      return ui8Position;
+    }
+
+    static inline uint8_t __QueueBuffer_nextReadPosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8ReadPosition;
+      bfBuffer->ui8ReadPosition = (ui8Position == bfBuffer->ui8BufferSize - 1) ? 0 : ui8Position + 1;
+      bfBuffer->ui8AmountOfData--;
+      return ui8Position;
+    }
+
+    //! Private Functions: Stack Buffer Positions
+    /*!
+      Get the slot of the next push or pop of a stack buffer and update its indexes. The pop position needs pending data.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \return Returns the slot position (or __BUFFER_DISCARDED_POSITION__ if a push on a full buffer must discard the new data, following the overflow policy).
+    */
+    static inline uint8_t __StackBuffer_nextWritePosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8WritePosition;
+      if (bfBuffer->ui8AmountOfData < bfBuffer->ui8BufferSize){
+        bfBuffer->ui8AmountOfData++;
+        __Buffer_raiseHighWaterMark(bfBuffer, bfBuffer->ui8AmountOfData);
+      }
+      else if (__Buffer_overflow(bfBuffer) == false){
+        return __BUFFER_DISCARDED_POSITION__;
+      }
+      bfBuffer->ui8ReadPosition = ui8Position;
+      bfBuffer->ui8WritePosition = (ui8Position == bfBuffer->ui8BufferSize - 1) ? 0 : ui8Position + 1;
+      return ui8Position;
+    }
+
+    static inline uint8_t __StackBuffer_nextReadPosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8ReadPosition;
+      bfBuffer->ui8ReadPosition = (ui8Position == 0) ? bfBuffer->ui8BufferSize - 1 : ui8Position - 1;
+      bfBuffer->ui8AmountOfData--;
+      return ui8Position;
+    }
+
+    //! Private Functions: Circular Buffer Positions
+    /*!
+      Get the slot of the next push or read of a circular buffer and update its indexes. Reading doesn't remove data: it cycles over the pending data. The read position needs pending data.
+      \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+      \return Returns the slot position (or __BUFFER_DISCARDED_POSITION__ if a push on a full buffer must discard the new data, following the overflow policy).
+    */
+    static inline uint8_t __CircularBuffer_nextWritePosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8WritePosition;
+      if (bfBuffer->ui8AmountOfData < bfBuffer->ui8BufferSize){
+        bfBuffer->ui8AmountOfData++;
+        __Buffer_raiseHighWaterMark(bfBuffer, bfBuffer->ui8AmountOfData);
+      }
+      else if (__Buffer_overflow(bfBuffer) == false){
+        return __BUFFER_DISCARDED_POSITION__;
+      }
+      bfBuffer->ui8WritePosition = (ui8Position == bfBuffer->ui8BufferSize - 1) ? 0 : ui8Position + 1;
+      return ui8Position;
+    }
+
+    static inline uint8_t __CircularBuffer_nextReadPosition(buffer_t bfBuffer){
+      uint8_t ui8Position = bfBuffer->ui8ReadPosition;
+      bfBuffer->ui8ReadPosition = (ui8Position == bfBuffer->ui8AmountOfData - 1) ? 0 : ui8Position + 1;
+      return ui8Position;
+    }
+
+    //! Private Macros: Buffer Positions by Type
+    /*!
+      Select the position functions of a buffer type at compilation time.
+    */
+    #define __BUFFER_NEXT_WRITE_POSITION_BUFFER_TYPE_QUEUE__(bfBuffer) __QueueBuffer_nextWritePosition(bfBuffer)
+    #define __BUFFER_NEXT_READ_POSITION_BUFFER_TYPE_QUEUE__(bfBuffer) __QueueBuffer_nextReadPosition(bfBuffer)
+    #define __BUFFER_NEXT_WRITE_POSITION_BUFFER_TYPE_STACK__(bfBuffer) __StackBuffer_nextWritePosition(bfBuffer)
+    #define __BUFFER_NEXT_READ_POSITION_BUFFER_TYPE_STACK__(bfBuffer) __StackBuffer_nextReadPosition(bfBuffer)
+    #define __BUFFER_NEXT_WRITE_POSITION_BUFFER_TYPE_CIRCULAR__(bfBuffer) __CircularBuffer_nextWritePosition(bfBuffer)
+    #define __BUFFER_NEXT_READ_POSITION_BUFFER_TYPE_CIRCULAR__(bfBuffer) __CircularBuffer_nextReadPosition(bfBuffer)
+
+    //! Macro: Typed Buffer Functions Creator
+    /*!
+      Create inline functions for buffers of a type and element type, with no type switch and no memcpy:
+        - tbName_push(bfBuffer, xData): writes a data, following the overflow policy, and returns false if it was rejected;
+        - tbName_pop(bfBuffer, xpData): copies the next data and returns false if the buffer is empty;
+        - tbName_popAddress(bfBuffer): returns the address of the next data or NULL if the buffer is empty.
+      The buffers are created by newBuffer or newStaticBuffer with the same type and element type, and the generic functions keep working on them. Use it out of functions.
+      \param tbName is the prefix of the functions.
+      \param btTypeOfBuffer is a buffer type, written as BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR.
+      \param xDataType is the type of buffer data.
+    */
+    #define declareTypedBuffer(tbName, btTypeOfBuffer, xDataType)\
+      static inline bool tbName##_push(buffer_t bfBuffer, xDataType xData){\
+        uint8_t ui8Position = __BUFFER_NEXT_WRITE_POSITION_##btTypeOfBuffer##__(bfBuffer);\
+        if (ui8Position == __BUFFER_DISCARDED_POSITION__){\
+          return bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST;\
+        }\
+        ((xDataType*) bfBuffer->vpVector)[ui8Position] = xData;\
+        return true;\
+      }\
+      static inline xDataType* tbName##_popAddress(buffer_t bfBuffer){\
+        if (bfBuffer->ui8AmountOfData == 0){\
+          __Buffer_underflow(bfBuffer);\
+          return NULL;\
+        }\
+        return &((xDataType*) bfBuffer->vpVector)[__BUFFER_NEXT_READ_POSITION_##btTypeOfBuffer##__(bfBuffer)];\
+      }\
+      static inline bool tbName##_pop(buffer_t bfBuffer, xDataType* xpData){\
+        if (bfBuffer->ui8AmountOfData == 0){\
+          __Buffer_underflow(bfBuffer);\
+          return false;\
+        }\
+        *xpData = ((xDataType*) bfBuffer->vpVector)[__BUFFER_NEXT_READ_POSITION_##btTypeOfBuffer##__(bfBuffer)];\
+        return true;\
+      }
+
     //! Private Function: Pointer Buffer Data Getter
     /*!
       Pull buffer address data.
@@ -140,10 +499,27 @@
 
     void Buffer_clear(buffer_t bfBuffer);                                                                                           /*!< void type function. */
     void Buffer_push(buffer_t bfBuffer, void* vpData);                                                                              /*!< void type function. */
+    bool Buffer_tryPush(buffer_t bfBuffer, void* vpData);                                                                           /*!< bool type function. */
+    bool Buffer_tryPop(buffer_t bfBuffer, void* vpData);                                                                            /*!< bool type function. */
+    uint32_t Buffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData);                                        /*!< 32-bits integer type. */
+    uint32_t Buffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData);                                               /*!< 32-bits integer type. */
+    void* Buffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);                                                             /*!< void pointer type function. */
+    void Buffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData);                                                                 /*!< void type function. */
+    void* Buffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);                                                                /*!< void pointer type function. */
+    void Buffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData);                                                                /*!< void type function. */
+    void* Buffer_at(buffer_t bfBuffer, uint8_t ui8Index);                                                                           /*!< void pointer type function. */
+    bool Buffer_getSpan(buffer_t bfBuffer, bufferspan_t bsSpan);                                                                    /*!< bool type function. */
     uint8_t Buffer_getAmountOfPendingData(buffer_t bfBuffer);                                                                       /*!< 8-bits integer type. */
     uint8_t Buffer_getWritePosition(buffer_t bfBuffer);                                                                             /*!< 8-bits integer type. */
     uint8_t Buffer_getReadPosition(buffer_t bfBuffer);                                                                              /*!< 8-bits integer type. */
+    void Buffer_setOverflowPolicy(buffer_t bfBuffer, buffer_overflow_t boOverflowPolicy);                                           /*!< void type function. */
+    uint32_t Buffer_getOverruns(buffer_t bfBuffer);                                                                                 /*!< 32-bits integer type. */
+    uint32_t Buffer_getUnderruns(buffer_t bfBuffer);                                                                                /*!< 32-bits integer type. */
+    uint8_t Buffer_getHighWaterMark(buffer_t bfBuffer);                                                                             /*!< 8-bits integer type. */
+    void Buffer_resetStatistics(buffer_t bfBuffer);                                                                                 /*!< void type function. */
     void* (Buffer_popAddress)(buffer_t bfBuffer);                                                                                   /*!< private void pointer type function. */
+    void __Buffer_writeSlots(buffer_t bfBuffer, uint8_t ui8Position, uint8_t ui8Limit, const void* vpData, uint8_t ui8Amount);      /*!< private void type function. */
+    void __Buffer_readSlots(buffer_t bfBuffer, uint8_t ui8Position, uint8_t ui8Limit, void* vpData, uint8_t ui8Amount);            /*!< private void type function. */
 
     #ifdef __cplusplus
       }
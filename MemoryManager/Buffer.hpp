@@ -0,0 +1,179 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __BUFFER_CPP_HEADER__
+  #define __BUFFER_CPP_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__cplusplus) && defined(__BUFFER_MANAGER_ENABLE__)
+
+    #include <stdint.h>
+    #include <type_traits>
+
+    extern "C" {
+      #include "./Buffer.h"
+    }
+
+    namespace MemoryManager {
+
+      //! Template: Buffer Positions
+      /*!
+        Position functions of each buffer type, selected at compilation time.
+      */
+      template <buffer_type_t Type>
+      struct BufferPositions;
+
+      template <>
+      struct BufferPositions<BUFFER_TYPE_QUEUE> {
+        static uint8_t nextWrite(buffer_t bfBuffer){ return __QueueBuffer_nextWritePosition(bfBuffer); }
+        static uint8_t nextRead(buffer_t bfBuffer){ return __QueueBuffer_nextReadPosition(bfBuffer); }
+      };
+
+      template <>
+      struct BufferPositions<BUFFER_TYPE_STACK> {
+        static uint8_t nextWrite(buffer_t bfBuffer){ return __StackBuffer_nextWritePosition(bfBuffer); }
+        static uint8_t nextRead(buffer_t bfBuffer){ return __StackBuffer_nextReadPosition(bfBuffer); }
+      };
+
+      template <>
+      struct BufferPositions<BUFFER_TYPE_CIRCULAR> {
+        static uint8_t nextWrite(buffer_t bfBuffer){ return __CircularBuffer_nextWritePosition(bfBuffer); }
+        static uint8_t nextRead(buffer_t bfBuffer){ return __CircularBuffer_nextReadPosition(bfBuffer); }
+      };
+
+      //! Class: Typed Buffer
+      /*!
+        Buffer of N elements of T with the type known at compilation time: push and pop assign T values directly and inline, with no type switch and no memcpy. The state is a C buffer_structure_t, so Buffer::getHandler can be passed to the C functions (Buffer_getAmountOfPendingData, Buffer_pushN...). It can't be copied, because the C structure points to its own storage.
+        \param T is the element type. It must be trivially copyable, with up to 255 bytes.
+        \param N is the amount of elements (1 to 255).
+        \param Type is BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR.
+      */
+      template <typename T, uint8_t N, buffer_type_t Type = BUFFER_TYPE_QUEUE>
+      class Buffer {
+        static_assert(N > 0, "Buffer needs at least one element.");
+        static_assert(sizeof(T) <= UINT8_MAX, "Buffer elements have up to 255 bytes.");
+        static_assert(std::is_trivially_copyable<T>::value, "Buffer elements are copied by the C functions.");
+        static_assert(Type == BUFFER_TYPE_QUEUE || Type == BUFFER_TYPE_STACK || Type == BUFFER_TYPE_CIRCULAR, "Buffer type must be BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR.");
+
+        public:
+          //! Constructor: Empty Buffer
+          /*!
+            Creates an empty buffer.
+          */
+          Buffer() : tVector{}, bfsBuffer{tVector, sizeof(T), N, 0, 0, 0, Type, nullptr, nullptr, BUFFER_OVERFLOW_DEFAULT, 0, 0, 0} {
+          }
+
+          Buffer(const Buffer&) = delete;
+          Buffer& operator=(const Buffer&) = delete;
+
+          //! Function: C Handler Getter
+          /*!
+            Get the C buffer, to be used with the C functions.
+            \return Returns the buffer_t handler.
+          */
+          buffer_t getHandler(){
+            return &bfsBuffer;
+          }
+
+          //! Function: Buffer Writer
+          /*!
+            Write a data on the buffer. When it's full, the overflow policy of the C buffer decides (Buffer_setOverflowPolicy) and an overrun is counted.
+            \param tData is the data.
+            \return Returns false if the data was rejected.
+          */
+          bool push(const T& tData){
+            uint8_t ui8Position = BufferPositions<Type>::nextWrite(&bfsBuffer);
+            if (ui8Position == __BUFFER_DISCARDED_POSITION__){
+              return bfsBuffer.boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST;
+            }
+            tVector[ui8Position] = tData;
+            return true;
+          }
+
+          //! Function: Buffer Reader
+          /*!
+            Copy the next data of the buffer.
+            \param tData receives the data.
+            \return Returns false if the buffer is empty.
+          */
+          bool pop(T& tData){
+            if (bfsBuffer.ui8AmountOfData == 0){
+              __Buffer_underflow(&bfsBuffer);
+              return false;
+            }
+            tData = tVector[BufferPositions<Type>::nextRead(&bfsBuffer)];
+            return true;
+          }
+
+          //! Function: Buffer Address Reader
+          /*!
+            Get the address of the next data of the buffer.
+            \return Returns the address of the data or nullptr if the buffer is empty.
+          */
+          T* popAddress(){
+            if (bfsBuffer.ui8AmountOfData == 0){
+              __Buffer_underflow(&bfsBuffer);
+              return nullptr;
+            }
+            return &tVector[BufferPositions<Type>::nextRead(&bfsBuffer)];
+          }
+
+          //! Function: Amount of Pending Data Getter
+          /*!
+            Get the amount of pending data.
+            \return Returns the amount of pending data.
+          */
+          uint8_t getAmountOfPendingData() const {
+            return bfsBuffer.ui8AmountOfData;
+          }
+
+          //! Function: Buffer Cleaner
+          /*!
+            Clean the buffer.
+          */
+          void clear(){
+            Buffer_clear(&bfsBuffer);
+          }
+
+        private:
+          T tVector[N];                                                                                                          /*!< T array type. */
+          buffer_structure_t bfsBuffer;                                                                                          /*!< buffer_structure_t type. */
+      };
+
+    }
+
+  #endif
+#endif
@@ -0,0 +1,176 @@
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__) && defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__)) && defined(__linux__)
+
+  #include "./BufferWait.h"
+  #include "./SPSC.h"
+  #include "./MPMC.h"
+  #include <limits.h>
+  #include <time.h>
+  #include <unistd.h>
+  #include <sys/syscall.h>
+  #include <linux/futex.h>
+
+  //! Private Function: Spin Pause
+  /*!
+    Tell the processor that the thread is spinning, so the other hardware thread of the core gets its resources.
+  */
+  static inline void __BufferWait_pause(void){
+    #if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+    #elif defined(__aarch64__) || defined(__arm__)
+      __asm__ __volatile__("yield");
+    #endif
+  }
+
+  //! Private Functions: Buffer Try Operations
+  /*!
+    Push or pop once on a BUFFER_TYPE_SPSC or BUFFER_TYPE_MPMC buffer, without overflow policies or statistics.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It's the data to be pushed or receives the data popped.
+    \return Returns true if the operation succeeded.
+  */
+  static inline bool __BufferWait_tryPush(buffer_t bfBuffer, void* vpData){
+    return (bfBuffer->btBufferType == BUFFER_TYPE_SPSC) ? __SPSCBuffer_push(bfBuffer, vpData) : __MPMCBuffer_push(bfBuffer, vpData);
+  }
+
+  static inline bool __BufferWait_tryPop(buffer_t bfBuffer, void* vpData){
+    return (bfBuffer->btBufferType == BUFFER_TYPE_SPSC) ? __SPSCBuffer_tryPop(bfBuffer, vpData) : __MPMCBuffer_tryPop(bfBuffer, vpData);
+  }
+
+  //! Private Function: Remaining Time Getter
+  /*!
+    Get the time until a deadline of the monotonic clock.
+    \param tspDeadline is a const timespec structure pointer. It's the deadline.
+    \param tspRemaining is a timespec structure pointer. It receives the remaining time.
+    \return Returns false if the deadline is over.
+  */
+  static bool __BufferWait_getRemainingTime(const struct timespec* tspDeadline, struct timespec* tspRemaining){
+    struct timespec tsNow;
+    clock_gettime(CLOCK_MONOTONIC, &tsNow);
+    tspRemaining->tv_sec = tspDeadline->tv_sec - tsNow.tv_sec;
+    tspRemaining->tv_nsec = tspDeadline->tv_nsec - tsNow.tv_nsec;
+    if (tspRemaining->tv_nsec < 0){
+      tspRemaining->tv_sec--;
+      tspRemaining->tv_nsec += 1000000000L;
+    }
+    return tspRemaining->tv_sec >= 0;
+  }
+
+  //! Private Function: Event Signaler
+  /*!
+    Change an event and wake one thread parked on it (see __BufferWait_wake, which only calls it when a thread is parked).
+    \param ui32pEvent is a 32-bits integer pointer. It's the event counter (the futex word).
+  */
+  void __BufferWait_signal(uint32_t* ui32pEvent){
+    __atomic_fetch_add(ui32pEvent, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, ui32pEvent, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+  }
+
+  //! Private Function: Buffer Waiter
+  /*!
+    Retry a buffer operation until it succeeds or the timeout expires: first spinning, up to the adaptive spin limit of the buffer, and then parked on the event futex. The waiter is registered before the last retry, so a push or pop between the retry and the futex call changes the event and the futex returns at once.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param bTryPush is a boolean. It's true to push and false to pop.
+    \param vpData is a void pointer. It's the data to be pushed or receives the data popped.
+    \param ui32TimeoutMicroseconds is a 32-bits integer. It's the timeout in microseconds (or BUFFER_WAIT_FOREVER).
+    \return Returns true if the operation succeeded.
+  */
+  static bool __BufferWait_wait(buffer_t bfBuffer, bool bTryPush, void* vpData, uint32_t ui32TimeoutMicroseconds){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t* ui32pEvent = (bTryPush == true) ? &biIndexes->ui32SpaceEvent : &biIndexes->ui32DataEvent;
+    uint32_t* ui32pWaiters = (bTryPush == true) ? &biIndexes->ui32SpaceWaiters : &biIndexes->ui32DataWaiters;
+    uint32_t* ui32pSpinLimit = (bTryPush == true) ? &biIndexes->ui32SpaceSpinLimit : &biIndexes->ui32DataSpinLimit;
+    uint32_t ui32SpinLimit = __atomic_load_n(ui32pSpinLimit, __ATOMIC_RELAXED);
+    if (ui32SpinLimit == 0){
+      ui32SpinLimit = __BUFFER_WAIT_SPIN_LIMIT__;
+    }
+    for (uint32_t ui32Counter = 0; ui32Counter < ui32SpinLimit; ui32Counter++){
+      __BufferWait_pause();
+      if (((bTryPush == true) ? __BufferWait_tryPush(bfBuffer, vpData) : __BufferWait_tryPop(bfBuffer, vpData)) == true){
+        if (ui32SpinLimit < __BUFFER_WAIT_SPIN_LIMIT__){
+          __atomic_store_n(ui32pSpinLimit, 2 * ui32SpinLimit, __ATOMIC_RELAXED);
+        }
+        return true;
+      }
+    }
+    if (ui32SpinLimit > 1){
+      __atomic_store_n(ui32pSpinLimit, ui32SpinLimit / 2, __ATOMIC_RELAXED);
+    }
+    struct timespec tsDeadline, tsRemaining;
+    if (ui32TimeoutMicroseconds != BUFFER_WAIT_FOREVER){
+      clock_gettime(CLOCK_MONOTONIC, &tsDeadline);
+      tsDeadline.tv_sec += ui32TimeoutMicroseconds / 1000000U;
+      tsDeadline.tv_nsec += (long) (ui32TimeoutMicroseconds % 1000000U) * 1000L;
+      if (tsDeadline.tv_nsec >= 1000000000L){
+        tsDeadline.tv_sec++;
+        tsDeadline.tv_nsec -= 1000000000L;
+      }
+    }
+    for (;;){
+      __atomic_fetch_add(ui32pWaiters, 1, __ATOMIC_SEQ_CST);
+      uint32_t ui32Event = __atomic_load_n(ui32pEvent, __ATOMIC_ACQUIRE);
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      if (((bTryPush == true) ? __BufferWait_tryPush(bfBuffer, vpData) : __BufferWait_tryPop(bfBuffer, vpData)) == true){
+        __atomic_fetch_sub(ui32pWaiters, 1, __ATOMIC_RELAXED);
+        return true;
+      }
+      if (ui32TimeoutMicroseconds == BUFFER_WAIT_FOREVER){
+        syscall(SYS_futex, ui32pEvent, FUTEX_WAIT_PRIVATE, ui32Event, NULL, NULL, 0);
+      }
+      else if (__BufferWait_getRemainingTime(&tsDeadline, &tsRemaining) == true){
+        syscall(SYS_futex, ui32pEvent, FUTEX_WAIT_PRIVATE, ui32Event, &tsRemaining, NULL, 0);
+      }
+      else{
+        __atomic_fetch_sub(ui32pWaiters, 1, __ATOMIC_RELAXED);
+        return false;
+      }
+      __atomic_fetch_sub(ui32pWaiters, 1, __ATOMIC_RELAXED);
+    }
+  }
+
+  //! Function: Buffer Blocking Writer
+  /*!
+    Write a data on a BUFFER_TYPE_SPSC or BUFFER_TYPE_MPMC buffer, waiting for a free slot while the buffer is full: the thread spins for a while and then sleeps on a futex until a slot is freed (by Buffer_popWait or any other pop of the buffer) or the timeout expires. While the buffer is neither empty nor full, no system call is made. A push that finds the buffer full counts one overrun, whatever the overflow policy. Other buffer types never block.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \param ui32TimeoutMicroseconds is a 32-bits integer. It's the maximum waiting time in microseconds (0 to never wait or BUFFER_WAIT_FOREVER).
+    \return Returns false if the buffer was still full at the end of the timeout.
+  */
+  bool Buffer_pushWait(buffer_t bfBuffer, void* vpData, uint32_t ui32TimeoutMicroseconds){
+    if (bfBuffer->btBufferType != BUFFER_TYPE_SPSC && bfBuffer->btBufferType != BUFFER_TYPE_MPMC){
+      return Buffer_tryPush(bfBuffer, vpData);
+    }
+    if (__BufferWait_tryPush(bfBuffer, vpData) == false){
+      __Buffer_countOverruns(bfBuffer, 1);
+      if (ui32TimeoutMicroseconds == 0 || __BufferWait_wait(bfBuffer, true, vpData, ui32TimeoutMicroseconds) == false){
+        return false;
+      }
+    }
+    __BufferWait_wake(&bfBuffer->biIndexes->ui32DataEvent, &bfBuffer->biIndexes->ui32DataWaiters);
+    return true;
+  }
+
+  //! Function: Buffer Blocking Reader
+  /*!
+    Copy the next data of a BUFFER_TYPE_SPSC or BUFFER_TYPE_MPMC buffer, waiting for data while the buffer is empty: the thread spins for a while and then sleeps on a futex until a data is written (by Buffer_pushWait or any other push of the buffer) or the timeout expires. While the buffer is neither empty nor full, no system call is made. A pop that finds the buffer empty counts one underrun. Other buffer types never block.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32TimeoutMicroseconds is a 32-bits integer. It's the maximum waiting time in microseconds (0 to never wait or BUFFER_WAIT_FOREVER).
+    \return Returns false if the buffer was still empty at the end of the timeout.
+  */
+  bool Buffer_popWait(buffer_t bfBuffer, void* vpData, uint32_t ui32TimeoutMicroseconds){
+    if (bfBuffer->btBufferType != BUFFER_TYPE_SPSC && bfBuffer->btBufferType != BUFFER_TYPE_MPMC){
+      return Buffer_tryPop(bfBuffer, vpData);
+    }
+    if (__BufferWait_tryPop(bfBuffer, vpData) == false){
+      __Buffer_countUnderrun(bfBuffer);
+      if (ui32TimeoutMicroseconds == 0 || __BufferWait_wait(bfBuffer, false, vpData, ui32TimeoutMicroseconds) == false){
+        return false;
+      }
+    }
+    __BufferWait_wake(&bfBuffer->biIndexes->ui32SpaceEvent, &bfBuffer->biIndexes->ui32SpaceWaiters);
+    return true;
+  }
+
+#endif
@@ -0,0 +1,79 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __BUFFER_WAIT_HEADER__
+  #define __BUFFER_WAIT_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BUFFER_MANAGER_ENABLE__) && defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__)) && defined(__linux__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include <EmbeddedTools.h>
+    #include "./Buffer.h"
+
+    //! Macro: Infinite Buffer Wait
+    /*!
+      Timeout of Buffer_pushWait and Buffer_popWait that never expires.
+    */
+    #define BUFFER_WAIT_FOREVER UINT32_MAX
+
+    bool Buffer_pushWait(buffer_t bfBuffer, void* vpData, uint32_t ui32TimeoutMicroseconds);                                        /*!< bool type function. */
+    bool Buffer_popWait(buffer_t bfBuffer, void* vpData, uint32_t ui32TimeoutMicroseconds);                                         /*!< bool type function. */
+    void __BufferWait_signal(uint32_t* ui32pEvent);                                                                                 /*!< void type function. */
+
+    //! Private Function: Waiters Waker
+    /*!
+      Wake one thread parked on an event, after a push (data event) or a pop (space event). Threads only park after they see the buffer empty or full, so while nobody is parked the cost is a fence and a load, without system calls.
+      \param ui32pEvent is a 32-bits integer pointer. It's the event counter (the futex word).
+      \param ui32pWaiters is a 32-bits integer pointer. It's the amount of threads parked on the event.
+    */
+    static inline void __BufferWait_wake(uint32_t* ui32pEvent, uint32_t* ui32pWaiters){
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      if (__atomic_load_n(ui32pWaiters, __ATOMIC_RELAXED) != 0){
+        __BufferWait_signal(ui32pEvent);
+      }
+    }
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
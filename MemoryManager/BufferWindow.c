@@ -0,0 +1,575 @@
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__)
+
+  #include "./BufferWindow.h"
+  #include "./Circular.h"
+
+  #if defined(__BUFFER_SIMD_ENABLE__) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define __BUFFER_X86_SIMD__
+    #include <immintrin.h>
+  #endif
+
+  //! Enumeration Definition: Buffer Reduction
+  /*!
+    Reductions of the window kernels. The squared deviations are taken around a center.
+  */
+  typedef enum{
+    BUFFER_REDUCTION_SUM = 0,
+    BUFFER_REDUCTION_MINIMUM,
+    BUFFER_REDUCTION_MAXIMUM,
+    BUFFER_REDUCTION_SQUARED_DEVIATIONS
+  } buffer_reduction_t;
+
+  //! Type Definition: Reduction Kernel
+  /*!
+    A kernel reduces the first data of a contiguous segment, saves the result (if some data was processed) and returns the amount of processed data.
+  */
+  typedef uint32_t (*buffer_reduction_kernel_t)(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult);
+
+  //! Private Function: Reduction Combiner
+  /*!
+    Combines the results of a reduction over two parts of the data.
+  */
+  static inline double __Buffer_combine(buffer_reduction_t brReduction, double dResultA, double dResultB){
+    switch (brReduction){
+      case BUFFER_REDUCTION_MINIMUM:
+        return (dResultB < dResultA) ? dResultB : dResultA;
+      case BUFFER_REDUCTION_MAXIMUM:
+        return (dResultB > dResultA) ? dResultB : dResultA;
+      default:
+        return dResultA + dResultB;
+    }
+  }
+
+  //! Private Macro: Scalar Reduction Loops
+  /*!
+    Reduces a segment of xDataType data one data at a time.
+  */
+  #define __Buffer_reductionLoops(xDataType)\
+    const xDataType* xpData = (const xDataType*) vpData;\
+    uint32_t ui32Counter = 0;\
+    xDataType xExtremum = xpData[0];\
+    double dResult = (double) xpData[0];\
+    double dDeviation = 0;\
+    switch (brReduction){\
+      case BUFFER_REDUCTION_MINIMUM:\
+        for (ui32Counter = 1 ; ui32Counter < ui32AmountOfData ; ui32Counter++){\
+          xExtremum = (xpData[ui32Counter] < xExtremum) ? xpData[ui32Counter] : xExtremum;\
+        }\
+        dResult = (double) xExtremum;\
+        break;\
+      case BUFFER_REDUCTION_MAXIMUM:\
+        for (ui32Counter = 1 ; ui32Counter < ui32AmountOfData ; ui32Counter++){\
+          xExtremum = (xpData[ui32Counter] > xExtremum) ? xpData[ui32Counter] : xExtremum;\
+        }\
+        dResult = (double) xExtremum;\
+        break;\
+      case BUFFER_REDUCTION_SUM:\
+        for (ui32Counter = 1 ; ui32Counter < ui32AmountOfData ; ui32Counter++){\
+          dResult = dResult + (double) xpData[ui32Counter];\
+        }\
+        break;\
+      default:\
+        dResult = 0;\
+        for (ui32Counter = 0 ; ui32Counter < ui32AmountOfData ; ui32Counter++){\
+          dDeviation = (double) xpData[ui32Counter] - dCenter;\
+          dResult = dResult + dDeviation * dDeviation;\
+        }\
+        break;\
+    }\
+    *dpResult = dResult;\
+    return ui32AmountOfData;
+
+  //! Private Functions: Scalar Reduction Kernels
+  /*!
+    Reduce a non-empty segment of int16, int32 or float data one data at a time.
+  */
+  static uint32_t __Buffer_reduceInt16(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+    __Buffer_reductionLoops(int16_t);
+  }
+
+  static uint32_t __Buffer_reduceInt32(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+    __Buffer_reductionLoops(int32_t);
+  }
+
+  static uint32_t __Buffer_reduceFloat(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+    __Buffer_reductionLoops(float);
+  }
+
+  #if defined(__BUFFER_X86_SIMD__)
+    //! Macros: AVX2 Conversions
+    /*!
+      Load four int16, int32 or float data as four doubles. The conversions are exact.
+    */
+    #define __Buffer_loadInt16AsDoublesAVX2(xpAddress) _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*) (xpAddress))))
+    #define __Buffer_loadInt32AsDoublesAVX2(xpAddress) _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*) (xpAddress)))
+    #define __Buffer_loadFloatAsDoublesAVX2(xpAddress) _mm256_cvtps_pd(_mm_loadu_ps(xpAddress))
+
+    //! Macros: AVX2 Operations
+    /*!
+      Unaligned load of 256-bit vectors and the operations of the reductions.
+    */
+    #define __Buffer_loadIntegersAVX2(xpAddress) _mm256_loadu_si256((const __m256i*) (xpAddress))
+    #define __Buffer_storeIntegersAVX2(xpAddress, xVector) _mm256_storeu_si256((__m256i*) (xpAddress), xVector)
+    #define __Buffer_identityAVX2(dvVector) (dvVector)
+    #define __Buffer_squareAVX2(dvVector) _mm256_mul_pd(dvVector, dvVector)
+
+    //! Private Macro: AVX2 Accumulation Loop
+    /*!
+      Sums eight data at a time, as doubles on two accumulators, after subtracting a center and mapping them (identity or square).
+    */
+    #define __Buffer_accumulationLoopAVX2(xLoadAsDoubles, xMap, dCenterValue)\
+      {\
+        __m256d dvCenter = _mm256_set1_pd(dCenterValue);\
+        __m256d dvAccumulatorA = _mm256_setzero_pd();\
+        __m256d dvAccumulatorB = _mm256_setzero_pd();\
+        __m256d dvData;\
+        for (ui32Counter = 0 ; ui32Counter + 8 <= ui32AmountOfData ; ui32Counter = ui32Counter + 8){\
+          dvData = _mm256_sub_pd(xLoadAsDoubles(&xpData[ui32Counter]), dvCenter);\
+          dvAccumulatorA = _mm256_add_pd(dvAccumulatorA, xMap(dvData));\
+          dvData = _mm256_sub_pd(xLoadAsDoubles(&xpData[ui32Counter + 4]), dvCenter);\
+          dvAccumulatorB = _mm256_add_pd(dvAccumulatorB, xMap(dvData));\
+        }\
+        dvAccumulatorA = _mm256_add_pd(dvAccumulatorA, dvAccumulatorB);\
+        __m128d dvHalf = _mm_add_pd(_mm256_castpd256_pd128(dvAccumulatorA), _mm256_extractf128_pd(dvAccumulatorA, 1));\
+        *dpResult = _mm_cvtsd_f64(_mm_add_sd(dvHalf, _mm_unpackhi_pd(dvHalf, dvHalf)));\
+      }
+
+    //! Private Macros: AVX2 Integer Sums
+    /*!
+      Sum int16 data 16 at a time on eight int32 lanes (a segment has up to 255 data, so the lanes never overflow) and int32 data 8 at a time on four int64 lanes. The sums are exact.
+    */
+    #define __Buffer_sumInt16LoopAVX2()\
+      {\
+        int32_t i32Lanes[8];\
+        __m256i xvOnes = _mm256_set1_epi16(1);\
+        __m256i xvAccumulator = _mm256_setzero_si256();\
+        for (ui32Counter = 0 ; ui32Counter + 16 <= ui32AmountOfData ; ui32Counter = ui32Counter + 16){\
+          xvAccumulator = _mm256_add_epi32(xvAccumulator, _mm256_madd_epi16(__Buffer_loadIntegersAVX2(&xpData[ui32Counter]), xvOnes));\
+        }\
+        __Buffer_storeIntegersAVX2(i32Lanes, xvAccumulator);\
+        *dpResult = (double) ((int64_t) i32Lanes[0] + i32Lanes[1] + i32Lanes[2] + i32Lanes[3] + i32Lanes[4] + i32Lanes[5] + i32Lanes[6] + i32Lanes[7]);\
+      }
+
+    #define __Buffer_sumInt32LoopAVX2()\
+      {\
+        int64_t i64Lanes[4];\
+        __m256i xvData;\
+        __m256i xvAccumulator = _mm256_setzero_si256();\
+        for (ui32Counter = 0 ; ui32Counter + 8 <= ui32AmountOfData ; ui32Counter = ui32Counter + 8){\
+          xvData = __Buffer_loadIntegersAVX2(&xpData[ui32Counter]);\
+          xvAccumulator = _mm256_add_epi64(xvAccumulator, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(xvData)));\
+          xvAccumulator = _mm256_add_epi64(xvAccumulator, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(xvData, 1)));\
+        }\
+        __Buffer_storeIntegersAVX2(i64Lanes, xvAccumulator);\
+        *dpResult = (double) (i64Lanes[0] + i64Lanes[1] + i64Lanes[2] + i64Lanes[3]);\
+      }
+
+    #define __Buffer_sumFloatLoopAVX2()\
+      __Buffer_accumulationLoopAVX2(__Buffer_loadFloatAsDoublesAVX2, __Buffer_identityAVX2, 0.0)
+
+    //! Private Macro: AVX2 Reduction Loops
+    /*!
+      Reduces the first data of a segment of xDataType data with AVX2: the squared deviations run on doubles and the minimum and the maximum on the lanes of the data type, which are reduced at the end by the scalar kernel. Segments shorter than a vector are left to the scalar kernels.
+    */
+    #define __Buffer_reductionLoopsAVX2(xDataType, xVectorType, xLoadAsDoubles, xLoad, xStore, xMinimum, xMaximum, xSumLoop, xScalarKernel)\
+      const xDataType* xpData = (const xDataType*) vpData;\
+      xDataType xLanes[32 / sizeof(xDataType)];\
+      xVectorType xvExtremum;\
+      uint32_t ui32Counter = 0;\
+      if (ui32AmountOfData < 32 / sizeof(xDataType)){\
+        return 0;\
+      }\
+      switch (brReduction){\
+        case BUFFER_REDUCTION_MINIMUM:\
+          xvExtremum = xLoad(&xpData[0]);\
+          for (ui32Counter = 32 / sizeof(xDataType) ; ui32Counter + 32 / sizeof(xDataType) <= ui32AmountOfData ; ui32Counter = ui32Counter + 32 / sizeof(xDataType)){\
+            xvExtremum = xMinimum(xvExtremum, xLoad(&xpData[ui32Counter]));\
+          }\
+          xStore(xLanes, xvExtremum);\
+          xScalarKernel(xLanes, 32 / sizeof(xDataType), brReduction, dCenter, dpResult);\
+          break;\
+        case BUFFER_REDUCTION_MAXIMUM:\
+          xvExtremum = xLoad(&xpData[0]);\
+          for (ui32Counter = 32 / sizeof(xDataType) ; ui32Counter + 32 / sizeof(xDataType) <= ui32AmountOfData ; ui32Counter = ui32Counter + 32 / sizeof(xDataType)){\
+            xvExtremum = xMaximum(xvExtremum, xLoad(&xpData[ui32Counter]));\
+          }\
+          xStore(xLanes, xvExtremum);\
+          xScalarKernel(xLanes, 32 / sizeof(xDataType), brReduction, dCenter, dpResult);\
+          break;\
+        case BUFFER_REDUCTION_SUM:\
+          xSumLoop();\
+          break;\
+        default:\
+          __Buffer_accumulationLoopAVX2(xLoadAsDoubles, __Buffer_squareAVX2, dCenter);\
+          break;\
+      }\
+      return ui32Counter;
+
+    //! Private Functions: AVX2 Reduction Kernels
+    /*!
+      Reduce int16, int32 or float data a 256-bit vector at a time.
+    */
+    __attribute__((target("avx2"))) static uint32_t __Buffer_reduceInt16AVX2(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+      __Buffer_reductionLoopsAVX2(int16_t, __m256i, __Buffer_loadInt16AsDoublesAVX2, __Buffer_loadIntegersAVX2, __Buffer_storeIntegersAVX2, _mm256_min_epi16, _mm256_max_epi16, __Buffer_sumInt16LoopAVX2, __Buffer_reduceInt16);
+    }
+
+    __attribute__((target("avx2"))) static uint32_t __Buffer_reduceInt32AVX2(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+      __Buffer_reductionLoopsAVX2(int32_t, __m256i, __Buffer_loadInt32AsDoublesAVX2, __Buffer_loadIntegersAVX2, __Buffer_storeIntegersAVX2, _mm256_min_epi32, _mm256_max_epi32, __Buffer_sumInt32LoopAVX2, __Buffer_reduceInt32);
+    }
+
+    __attribute__((target("avx2"))) static uint32_t __Buffer_reduceFloatAVX2(const void* vpData, uint32_t ui32AmountOfData, buffer_reduction_t brReduction, double dCenter, double* dpResult){
+      __Buffer_reductionLoopsAVX2(float, __m256, __Buffer_loadFloatAsDoublesAVX2, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_min_ps, _mm256_max_ps, __Buffer_sumFloatLoopAVX2, __Buffer_reduceFloat);
+    }
+  #endif
+
+  //! Variable: Selected Kernels
+  /*!
+    Kernels of each buffer_element_t, selected at the first reduction according to the processor features.
+  */
+  static buffer_reduction_kernel_t __brkBufferReductionKernels[3] = {NULL, NULL, NULL};
+
+  //! Variable: Scalar Kernels
+  /*!
+    Kernels of each buffer_element_t that reduce any amount of data.
+  */
+  static const buffer_reduction_kernel_t __brkBufferScalarKernels[3] = {__Buffer_reduceInt16, __Buffer_reduceInt32, __Buffer_reduceFloat};
+
+  //! Private Function: Kernels Selector
+  /*!
+    Selects the fastest kernels available on the processor.
+  */
+  static void __Buffer_selectKernels(void){
+    buffer_reduction_kernel_t brkInt16Kernel = __Buffer_reduceInt16;
+    buffer_reduction_kernel_t brkInt32Kernel = __Buffer_reduceInt32;
+    buffer_reduction_kernel_t brkFloatKernel = __Buffer_reduceFloat;
+    #if defined(__BUFFER_X86_SIMD__)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")){
+        brkInt16Kernel = __Buffer_reduceInt16AVX2;
+        brkInt32Kernel = __Buffer_reduceInt32AVX2;
+        brkFloatKernel = __Buffer_reduceFloatAVX2;
+      }
+    #endif
+    __brkBufferReductionKernels[BUFFER_ELEMENT_INT32] = brkInt32Kernel;
+    __brkBufferReductionKernels[BUFFER_ELEMENT_FLOAT] = brkFloatKernel;
+    __brkBufferReductionKernels[BUFFER_ELEMENT_INT16] = brkInt16Kernel;
+  }
+
+  //! Private Function: Segment Reduction
+  /*!
+    Reduces a non-empty contiguous segment with the selected kernel and finishes its last data with the scalar kernel.
+  */
+  static double __Buffer_reduceSegment(const void* vpData, uint32_t ui32AmountOfData, buffer_element_t beElement, buffer_reduction_t brReduction, double dCenter){
+    static const uint8_t ui8ElementSizes[3] = {sizeof(int16_t), sizeof(int32_t), sizeof(float)};
+    double dResult = 0;
+    double dTailResult = 0;
+    if (__brkBufferReductionKernels[BUFFER_ELEMENT_INT16] == NULL){
+      __Buffer_selectKernels();
+    }
+    uint32_t ui32Counter = __brkBufferReductionKernels[beElement](vpData, ui32AmountOfData, brReduction, dCenter, &dResult);
+    if (ui32Counter < ui32AmountOfData){
+      __brkBufferScalarKernels[beElement]((const char*) vpData + ui32Counter * ui8ElementSizes[beElement], ui32AmountOfData - ui32Counter, brReduction, dCenter, &dTailResult);
+      dResult = (ui32Counter == 0) ? dTailResult : __Buffer_combine(brReduction, dResult, dTailResult);
+    }
+    return dResult;
+  }
+
+  //! Private Function: Buffer Reduction
+  /*!
+    Reduces all the pending data of a queue, stack or circular buffer, segment by segment.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \param brReduction is a buffer_reduction_t type. It's the reduction.
+    \param dCenter is a double. It's the center of the squared deviations.
+    \return Returns the result or 0 if the buffer is empty (or the buffer type doesn't support it).
+  */
+  static double __Buffer_reduce(buffer_t bfBuffer, buffer_element_t beElement, buffer_reduction_t brReduction, double dCenter){
+    bufferspan_structure_t bssSpan;
+    if (Buffer_getSpan(bfBuffer, &bssSpan) == false || bssSpan.ui8FirstAmount == 0){
+      return 0;
+    }
+    double dResult = __Buffer_reduceSegment(bssSpan.vpFirst, bssSpan.ui8FirstAmount, beElement, brReduction, dCenter);
+    if (bssSpan.ui8SecondAmount != 0){
+      dResult = __Buffer_combine(brReduction, dResult, __Buffer_reduceSegment(bssSpan.vpSecond, bssSpan.ui8SecondAmount, beElement, brReduction, dCenter));
+    }
+    return dResult;
+  }
+
+  //! Function: Buffer Sum
+  /*!
+    Sum the pending data of a BUFFER_TYPE_QUEUE, BUFFER_TYPE_STACK or BUFFER_TYPE_CIRCULAR buffer without removing it. The data is read straight on the buffer, with AVX2 when the processor has it (see __BUFFER_SIMD_ENABLE__). The sums of int16 and int32 data are exact.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \return Returns the sum or 0 if the buffer is empty.
+  */
+  double Buffer_getSum(buffer_t bfBuffer, buffer_element_t beElement){
+    return __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_SUM, 0);
+  }
+
+  //! Function: Buffer Mean
+  /*!
+    Get the mean of the pending data of a buffer (see Buffer_getSum).
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \return Returns the mean or 0 if the buffer is empty.
+  */
+  double Buffer_getMean(buffer_t bfBuffer, buffer_element_t beElement){
+    uint8_t ui8AmountOfData = bfBuffer->ui8AmountOfData;
+    if (ui8AmountOfData == 0){
+      return 0;
+    }
+    return __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_SUM, 0) / ui8AmountOfData;
+  }
+
+  //! Function: Buffer Minimum
+  /*!
+    Get the smallest pending data of a buffer (see Buffer_getSum).
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \return Returns the minimum or 0 if the buffer is empty.
+  */
+  double Buffer_getMinimum(buffer_t bfBuffer, buffer_element_t beElement){
+    return __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_MINIMUM, 0);
+  }
+
+  //! Function: Buffer Maximum
+  /*!
+    Get the biggest pending data of a buffer (see Buffer_getSum).
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \return Returns the maximum or 0 if the buffer is empty.
+  */
+  double Buffer_getMaximum(buffer_t bfBuffer, buffer_element_t beElement){
+    return __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_MAXIMUM, 0);
+  }
+
+  //! Function: Buffer Variance
+  /*!
+    Get the population variance of the pending data of a buffer (see Buffer_getSum). It takes two passes: the mean, then the squared deviations around it.
+    \param bfBuffer is a buffer_structure_t pointer. This parameter is the address of buffer.
+    \param beElement is a buffer_element_t type. It's the type of buffer data.
+    \return Returns the variance or 0 if the buffer is empty.
+  */
+  double Buffer_getVariance(buffer_t bfBuffer, buffer_element_t beElement){
+    uint8_t ui8AmountOfData = bfBuffer->ui8AmountOfData;
+    if (ui8AmountOfData == 0){
+      return 0;
+    }
+    double dMean = __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_SUM, 0) / ui8AmountOfData;
+    return __Buffer_reduce(bfBuffer, beElement, BUFFER_REDUCTION_SQUARED_DEVIATIONS, dMean) / ui8AmountOfData;
+  }
+
+  //! Private Function: Window Data Getter
+  /*!
+    Get the data of a slot of the buffer of a window as a double.
+  */
+  static inline double __BufferWindow_getData(bufferwindow_t bwWindow, uint8_t ui8Slot){
+    switch (bwWindow->beElement){
+      case BUFFER_ELEMENT_INT16:
+        return ((const int16_t*) bwWindow->bfBuffer->vpVector)[ui8Slot];
+      case BUFFER_ELEMENT_INT32:
+        return ((const int32_t*) bwWindow->bfBuffer->vpVector)[ui8Slot];
+      default:
+        return ((const float*) bwWindow->bfBuffer->vpVector)[ui8Slot];
+    }
+  }
+
+  //! Private Function: Monotonic Slots Pusher
+  /*!
+    Insert the newest slot on a monotonic queue of slots, after removing the slots that can't be the extremum anymore (their data isn't smaller, for the minimum, or bigger, for the maximum, than the new data). The slots of the queue stay sorted by age and their data sorted, so the oldest slot is the extremum.
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \param ui8pSlots is a 8-bits integer pointer. It's the queue of slots.
+    \param ui8Head is a 8-bits integer. It's the position of the oldest slot of the queue.
+    \param ui8pAmount is a 8-bits integer pointer. It's the amount of slots of the queue.
+    \param ui8Slot is a 8-bits integer. It's the slot of the new data.
+    \param bMinimum is a boolean. It tells if the queue keeps the minimum.
+  */
+  static void __BufferWindow_pushSlot(bufferwindow_t bwWindow, uint8_t* ui8pSlots, uint8_t ui8Head, uint8_t* ui8pAmount, uint8_t ui8Slot, bool bMinimum){
+    uint32_t ui32BufferSize = bwWindow->bfBuffer->ui8BufferSize;
+    double dData = __BufferWindow_getData(bwWindow, ui8Slot);
+    uint32_t ui32Position = (uint32_t) ui8Head + *ui8pAmount;
+    ui32Position = (ui32Position >= ui32BufferSize) ? ui32Position - ui32BufferSize : ui32Position;
+    while (*ui8pAmount != 0){
+      ui32Position = (ui32Position == 0) ? ui32BufferSize - 1 : ui32Position - 1;
+      if ((bMinimum == true) ? (__BufferWindow_getData(bwWindow, ui8pSlots[ui32Position]) < dData) : (__BufferWindow_getData(bwWindow, ui8pSlots[ui32Position]) > dData)){
+        ui32Position = (ui32Position == ui32BufferSize - 1) ? 0 : ui32Position + 1;
+        break;
+      }
+      (*ui8pAmount)--;
+    }
+    ui8pSlots[ui32Position] = ui8Slot;
+    (*ui8pAmount)++;
+  }
+
+  //! Private Function: Window Sums Synchronizer
+  /*!
+    Recompute the sums of a window from the data of its buffer, with the window reductions, and take its oldest data as the new shift. An empty window gets its shift from the next data pushed (see BufferWindow_push). The monotonic queues are exact, so they're kept.
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \param ui32Slot is a 32-bits integer. It's the slot of the oldest data.
+  */
+  static void __BufferWindow_synchronizeSums(bufferwindow_t bwWindow, uint32_t ui32Slot){
+    buffer_t bfBuffer = bwWindow->bfBuffer;
+    uint8_t ui8AmountOfData = bfBuffer->ui8AmountOfData;
+    bwWindow->dShift = 0;
+    bwWindow->dSum = 0;
+    bwWindow->dSumOfSquares = 0;
+    bwWindow->ui8PushesToSynchronize = bfBuffer->ui8BufferSize;
+    if (ui8AmountOfData != 0){
+      bwWindow->dShift = __BufferWindow_getData(bwWindow, (uint8_t) ui32Slot);
+      bwWindow->dSum = __Buffer_reduce(bfBuffer, bwWindow->beElement, BUFFER_REDUCTION_SUM, 0) - bwWindow->dShift * ui8AmountOfData;
+      bwWindow->dSumOfSquares = __Buffer_reduce(bfBuffer, bwWindow->beElement, BUFFER_REDUCTION_SQUARED_DEVIATIONS, bwWindow->dShift);
+    }
+  }
+
+  //! Function: Window Synchronizer
+  /*!
+    Recompute the running aggregates of a window from the data of its buffer (O(n), with the window reductions). Call it after changing the buffer out of BufferWindow_push.
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+  */
+  void BufferWindow_synchronize(bufferwindow_t bwWindow){
+    buffer_t bfBuffer = bwWindow->bfBuffer;
+    uint8_t ui8AmountOfData = bfBuffer->ui8AmountOfData;
+    uint8_t ui8Counter = 0;
+    uint32_t ui32Slot = ((uint32_t) bfBuffer->ui8WritePosition + bfBuffer->ui8BufferSize - ui8AmountOfData) % bfBuffer->ui8BufferSize;
+    bwWindow->ui8MinimumHead = 0;
+    bwWindow->ui8MinimumAmount = 0;
+    bwWindow->ui8MaximumHead = 0;
+    bwWindow->ui8MaximumAmount = 0;
+    bwWindow->bSynchronized = true;
+    __BufferWindow_synchronizeSums(bwWindow, ui32Slot);
+    for (ui8Counter = 0 ; ui8Counter < ui8AmountOfData ; ui8Counter++){
+      __BufferWindow_pushSlot(bwWindow, bwWindow->ui8pMinimumSlots, bwWindow->ui8MinimumHead, &bwWindow->ui8MinimumAmount, (uint8_t) ui32Slot, true);
+      __BufferWindow_pushSlot(bwWindow, bwWindow->ui8pMaximumSlots, bwWindow->ui8MaximumHead, &bwWindow->ui8MaximumAmount, (uint8_t) ui32Slot, false);
+      ui32Slot = (ui32Slot == bfBuffer->ui8BufferSize - 1u) ? 0 : ui32Slot + 1;
+    }
+  }
+
+  //! Private Function: Window Checker
+  /*!
+    Synchronize a window that was never used.
+  */
+  static inline void __BufferWindow_check(bufferwindow_t bwWindow){
+    if (bwWindow->bSynchronized == false){
+      BufferWindow_synchronize(bwWindow);
+    }
+  }
+
+  //! Function: Window Pusher
+  /*!
+    Push a data on the circular buffer of a window and update its running aggregates in O(1): the data that leaves the window is subtracted from the sums and leaves the monotonic queues. The first data pushed on an empty window becomes the shift of the sums, so data far from zero keep their precision. Once per turn of the window, the sums are recomputed from the buffer (amortized O(1)).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer (or NULL to insert a zero).
+    \return Returns false if the buffer is full and its overflow policy rejects the new data (see Buffer_tryPush).
+  */
+  bool BufferWindow_push(bufferwindow_t bwWindow, void* vpData){
+    __BufferWindow_check(bwWindow);
+    buffer_t bfBuffer = bwWindow->bfBuffer;
+    uint8_t ui8Slot = bfBuffer->ui8WritePosition;
+    bool bEmpty = (bfBuffer->ui8AmountOfData == 0);
+    bool bFull = (bfBuffer->ui8AmountOfData == bfBuffer->ui8BufferSize);
+    double dDeviation = (bFull == true) ? __BufferWindow_getData(bwWindow, ui8Slot) - bwWindow->dShift : 0;
+    if (__CircularBuffer_push(bfBuffer, vpData) == false){
+      return bfBuffer->boOverflowPolicy == BUFFER_OVERFLOW_DROP_NEWEST;
+    }
+    if (bFull == true){
+      bwWindow->dSum = bwWindow->dSum - dDeviation;
+      bwWindow->dSumOfSquares = bwWindow->dSumOfSquares - dDeviation * dDeviation;
+      if (bwWindow->ui8MinimumAmount != 0 && bwWindow->ui8pMinimumSlots[bwWindow->ui8MinimumHead] == ui8Slot){
+        bwWindow->ui8MinimumHead = (bwWindow->ui8MinimumHead == bfBuffer->ui8BufferSize - 1) ? 0 : bwWindow->ui8MinimumHead + 1;
+        bwWindow->ui8MinimumAmount--;
+      }
+      if (bwWindow->ui8MaximumAmount != 0 && bwWindow->ui8pMaximumSlots[bwWindow->ui8MaximumHead] == ui8Slot){
+        bwWindow->ui8MaximumHead = (bwWindow->ui8MaximumHead == bfBuffer->ui8BufferSize - 1) ? 0 : bwWindow->ui8MaximumHead + 1;
+        bwWindow->ui8MaximumAmount--;
+      }
+    }
+    if (bEmpty == true){
+      bwWindow->dShift = __BufferWindow_getData(bwWindow, ui8Slot);
+      bwWindow->dSum = 0;
+      bwWindow->dSumOfSquares = 0;
+    }
+    dDeviation = __BufferWindow_getData(bwWindow, ui8Slot) - bwWindow->dShift;
+    bwWindow->dSum = bwWindow->dSum + dDeviation;
+    bwWindow->dSumOfSquares = bwWindow->dSumOfSquares + dDeviation * dDeviation;
+    __BufferWindow_pushSlot(bwWindow, bwWindow->ui8pMinimumSlots, bwWindow->ui8MinimumHead, &bwWindow->ui8MinimumAmount, ui8Slot, true);
+    __BufferWindow_pushSlot(bwWindow, bwWindow->ui8pMaximumSlots, bwWindow->ui8MaximumHead, &bwWindow->ui8MaximumAmount, ui8Slot, false);
+    bwWindow->ui8PushesToSynchronize--;
+    if (bwWindow->ui8PushesToSynchronize == 0){
+      __BufferWindow_synchronizeSums(bwWindow, ((uint32_t) bfBuffer->ui8WritePosition + bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData) % bfBuffer->ui8BufferSize);
+    }
+    return true;
+  }
+
+  //! Function: Window Sum Getter
+  /*!
+    Get the sum of the data of a window in O(1).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \return Returns the sum or 0 if the buffer is empty.
+  */
+  double BufferWindow_getSum(bufferwindow_t bwWindow){
+    __BufferWindow_check(bwWindow);
+    return bwWindow->dShift * bwWindow->bfBuffer->ui8AmountOfData + bwWindow->dSum;
+  }
+
+  //! Function: Window Mean Getter
+  /*!
+    Get the mean of the data of a window in O(1).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \return Returns the mean or 0 if the buffer is empty.
+  */
+  double BufferWindow_getMean(bufferwindow_t bwWindow){
+    __BufferWindow_check(bwWindow);
+    uint8_t ui8AmountOfData = bwWindow->bfBuffer->ui8AmountOfData;
+    if (ui8AmountOfData == 0){
+      return 0;
+    }
+    return bwWindow->dShift + bwWindow->dSum / ui8AmountOfData;
+  }
+
+  //! Function: Window Minimum Getter
+  /*!
+    Get the smallest data of a window in O(1).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \return Returns the minimum or 0 if the buffer is empty.
+  */
+  double BufferWindow_getMinimum(bufferwindow_t bwWindow){
+    __BufferWindow_check(bwWindow);
+    if (bwWindow->ui8MinimumAmount == 0){
+      return 0;
+    }
+    return __BufferWindow_getData(bwWindow, bwWindow->ui8pMinimumSlots[bwWindow->ui8MinimumHead]);
+  }
+
+  //! Function: Window Maximum Getter
+  /*!
+    Get the biggest data of a window in O(1).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \return Returns the maximum or 0 if the buffer is empty.
+  */
+  double BufferWindow_getMaximum(bufferwindow_t bwWindow){
+    __BufferWindow_check(bwWindow);
+    if (bwWindow->ui8MaximumAmount == 0){
+      return 0;
+    }
+    return __BufferWindow_getData(bwWindow, bwWindow->ui8pMaximumSlots[bwWindow->ui8MaximumHead]);
+  }
+
+  //! Function: Window Variance Getter
+  /*!
+    Get the population variance of the data of a window in O(1).
+    \param bwWindow is a bufferwindow_t type. This parameter is the address of window.
+    \return Returns the variance or 0 if the buffer is empty.
+  */
+  double BufferWindow_getVariance(bufferwindow_t bwWindow){
+    __BufferWindow_check(bwWindow);
+    uint8_t ui8AmountOfData = bwWindow->bfBuffer->ui8AmountOfData;
+    if (ui8AmountOfData == 0){
+      return 0;
+    }
+    double dVariance = (bwWindow->dSumOfSquares - bwWindow->dSum * bwWindow->dSum / ui8AmountOfData) / ui8AmountOfData;
+    return (dVariance < 0) ? 0 : dVariance;
+  }
+
+#endif
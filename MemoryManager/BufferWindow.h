@@ -0,0 +1,124 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __BUFFER_WINDOW_HEADER__
+  #define __BUFFER_WINDOW_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BUFFER_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include <EmbeddedTools.h>
+    #include "./Buffer.h"
+
+    //! Enumeration Definition: Buffer Element Type
+    /*!
+      Type of the data of a buffer used by the window reductions. The element size of the buffer must be the size of this type.
+    */
+    typedef enum {
+      BUFFER_ELEMENT_INT16 = 0,
+      BUFFER_ELEMENT_INT32,
+      BUFFER_ELEMENT_FLOAT
+    } buffer_element_t;
+
+    //! Type Definition: Buffer Window Structure
+    /*!
+      Running aggregates of the data of a BUFFER_TYPE_CIRCULAR buffer, updated in O(1) by BufferWindow_push. The sums are kept relative to a shift (a data of the window), which avoids the cancellation of the variance of data far from zero; the value that leaves the window is subtracted on each push and the sums are recomputed from the buffer once per turn of the window, so the rounding error doesn't build up. The minimum and the maximum are the oldest slots of two monotonic queues of slots (amortized O(1)).
+    */
+    typedef struct {
+      buffer_t bfBuffer;                                                                                                            /*!< buffer_t type. */
+      buffer_element_t beElement;                                                                                                   /*!< buffer_element_t type. */
+      uint8_t* const ui8pMinimumSlots;                                                                                              /*!< const 8-bits integer pointer type. */
+      uint8_t* const ui8pMaximumSlots;                                                                                              /*!< const 8-bits integer pointer type. */
+      uint8_t ui8MinimumHead;                                                                                                       /*!< 8-bits integer type. */
+      uint8_t ui8MinimumAmount;                                                                                                     /*!< 8-bits integer type. */
+      uint8_t ui8MaximumHead;                                                                                                       /*!< 8-bits integer type. */
+      uint8_t ui8MaximumAmount;                                                                                                     /*!< 8-bits integer type. */
+      uint8_t ui8PushesToSynchronize;                                                                                               /*!< 8-bits integer type. */
+      bool bSynchronized;                                                                                                           /*!< bool type. */
+      double dShift;                                                                                                                /*!< double type. */
+      double dSum;                                                                                                                  /*!< double type. */
+      double dSumOfSquares;                                                                                                         /*!< double type. */
+    } bufferwindow_structure_t;
+
+    //! Type Definition: Buffer Window Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef bufferwindow_structure_t* bufferwindow_t;
+
+    //! Macro: Buffer Window Creator
+    /*!
+      Create the running aggregates of a BUFFER_TYPE_CIRCULAR buffer. The data already on the buffer is aggregated at the first use. Push the data with BufferWindow_push; after any other change of the buffer (Buffer_push, Buffer_clear...), call BufferWindow_synchronize.
+      \param bwWindowName is a window name.
+      \param bfCircularBuffer is a buffer_t type. It's the circular buffer.
+      \param beElementType is a buffer_element_t type. It's the type of buffer data.
+      \param ui8SizeOfBuffer is a 8-Bit integer. It's the buffer size.
+    */
+    #define newBufferWindow(bwWindowName, bfCircularBuffer, beElementType, ui8SizeOfBuffer)\
+      uint8_t __ui8BufferWindowMinimumSlots##bwWindowName[ui8SizeOfBuffer] = {0};\
+      uint8_t __ui8BufferWindowMaximumSlots##bwWindowName[ui8SizeOfBuffer] = {0};\
+      bufferwindow_structure_t __bwsBufferWindow##bwWindowName = {\
+        .bfBuffer = bfCircularBuffer,\
+        .beElement = beElementType,\
+        .ui8pMinimumSlots = __ui8BufferWindowMinimumSlots##bwWindowName,\
+        .ui8pMaximumSlots = __ui8BufferWindowMaximumSlots##bwWindowName\
+      };\
+      bufferwindow_t bwWindowName = &(__bwsBufferWindow##bwWindowName);\
+
+    double Buffer_getSum(buffer_t bfBuffer, buffer_element_t beElement);                                                            /*!< double type function. */
+    double Buffer_getMean(buffer_t bfBuffer, buffer_element_t beElement);                                                           /*!< double type function. */
+    double Buffer_getMinimum(buffer_t bfBuffer, buffer_element_t beElement);                                                        /*!< double type function. */
+    double Buffer_getMaximum(buffer_t bfBuffer, buffer_element_t beElement);                                                        /*!< double type function. */
+    double Buffer_getVariance(buffer_t bfBuffer, buffer_element_t beElement);                                                       /*!< double type function. */
+    bool BufferWindow_push(bufferwindow_t bwWindow, void* vpData);                                                                  /*!< bool type function. */
+    void BufferWindow_synchronize(bufferwindow_t bwWindow);                                                                         /*!< void type function. */
+    double BufferWindow_getSum(bufferwindow_t bwWindow);                                                                            /*!< double type function. */
+    double BufferWindow_getMean(bufferwindow_t bwWindow);                                                                           /*!< double type function. */
+    double BufferWindow_getMinimum(bufferwindow_t bwWindow);                                                                        /*!< double type function. */
+    double BufferWindow_getMaximum(bufferwindow_t bwWindow);                                                                        /*!< double type function. */
+    double BufferWindow_getVariance(bufferwindow_t bwWindow);                                                                       /*!< double type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
@@ -10,24 +10,21 @@
     Write a data on a circular buffer.
     \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of circular buffer.
     \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the buffer is full and its overflow policy discards the new data.
   */
-  void __CircularBuffer_push(buffer_t bfBuffer, void* vpData){
-    if (bfBuffer->ui8AmountOfData < bfBuffer->ui8BufferSize){
-      bfBuffer->ui8AmountOfData++;
+  bool __CircularBuffer_push(buffer_t bfBuffer, void* vpData){
+    uint8_t ui8Position = __CircularBuffer_nextWritePosition(bfBuffer);
+    if (ui8Position == __BUFFER_DISCARDED_POSITION__){
+      return false;
     }
-    void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8WritePosition * bfBuffer->ui8ElementSize;
+    void* vpAdressBuffer = (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
     if (vpData != NULL){
       memcpy(vpAdressBuffer, vpData, bfBuffer->ui8ElementSize);
     }
     else{
       memset(vpAdressBuffer, 0, bfBuffer->ui8ElementSize);
     }
-    if (bfBuffer->ui8WritePosition == bfBuffer->ui8BufferSize){
-      bfBuffer->ui8WritePosition = 0;
-    }
-    else{
-      bfBuffer->ui8WritePosition++;
-    }
+    return true;
   }
 
   //! Private Function: Circular Buffer Reader
@@ -40,14 +37,56 @@
     if (bfBuffer->ui8AmountOfData == 0){
       return NULL;
     }
-    void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8ReadPosition * bfBuffer->ui8ElementSize;
-    if (bfBuffer->ui8ReadPosition == bfBuffer->ui8AmountOfData - 1){
-      bfBuffer->ui8ReadPosition = 0;
+    return (char*) bfBuffer->vpVector + __CircularBuffer_nextReadPosition(bfBuffer) * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Circular Buffer Bulk Writer
+  /*!
+    Write some data on a circular buffer. If the buffer overflows, the oldest data is overwritten.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of circular buffer.
+    \param vpData is a const void pointer. It's the vector of data (or NULL to insert zeros).
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data.
+  */
+  uint32_t __CircularBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData){
+    uint8_t ui8Amount = (ui32AmountOfData > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : (uint8_t) ui32AmountOfData;
+    uint32_t ui32Position = bfBuffer->ui8WritePosition;
+    if (ui32AmountOfData > ui8Amount){
+      ui32Position = (ui32Position + ui32AmountOfData - ui8Amount) % bfBuffer->ui8BufferSize;                                     /*!< The overwritten data is skipped. */
+      if (vpData != NULL){
+        vpData = (const char*) vpData + (ui32AmountOfData - ui8Amount) * bfBuffer->ui8ElementSize;
+      }
+    }
+    __Buffer_writeSlots(bfBuffer, (uint8_t) ui32Position, bfBuffer->ui8BufferSize, vpData, ui8Amount);
+    ui32Position = ui32Position + ui8Amount;
+    bfBuffer->ui8WritePosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    ui32Position = bfBuffer->ui8AmountOfData + ui8Amount;
+    bfBuffer->ui8AmountOfData = (uint8_t) ((ui32Position > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : ui32Position);
+    return ui32AmountOfData;
+  }
+
+  //! Private Function: Circular Buffer Bulk Reader
+  /*!
+    Read some data on a circular buffer. As __CircularBuffer_pop, the data is not removed and the reading restarts after the last data, so it keeps cycling over the data on the buffer until the amount is read.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of circular buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data read (0 if the buffer is empty).
+  */
+  uint32_t __CircularBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData){
+    if (bfBuffer->ui8AmountOfData == 0){
+      return 0;
     }
-    else{
-      bfBuffer->ui8ReadPosition++;
+    uint32_t ui32Remaining = ui32AmountOfData;
+    while (ui32Remaining > 0){
+      uint8_t ui8Amount = (ui32Remaining > bfBuffer->ui8AmountOfData) ? bfBuffer->ui8AmountOfData : (uint8_t) ui32Remaining;
+      __Buffer_readSlots(bfBuffer, bfBuffer->ui8ReadPosition, bfBuffer->ui8AmountOfData, vpData, ui8Amount);
+      uint32_t ui32Position = bfBuffer->ui8ReadPosition + ui8Amount;
+      bfBuffer->ui8ReadPosition = (uint8_t) ((ui32Position >= bfBuffer->ui8AmountOfData) ? ui32Position - bfBuffer->ui8AmountOfData : ui32Position);
+      vpData = (char*) vpData + ui8Amount * bfBuffer->ui8ElementSize;
+      ui32Remaining = ui32Remaining - ui8Amount;
     }
-    return vpAdressBuffer;
+    return ui32AmountOfData;
   }
 
 #endif
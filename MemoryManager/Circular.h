@@ -44,8 +44,10 @@
       extern "C" {
     #endif
 
-    void __CircularBuffer_push(buffer_t bfBuffer, void* vpData);                /*!< void type function. */
+    bool __CircularBuffer_push(buffer_t bfBuffer, void* vpData);                /*!< bool type function. */
     void* __CircularBuffer_pop(buffer_t bfBuffer);                              /*!< void pointer type function. */
+    uint32_t __CircularBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
+    uint32_t __CircularBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
 
     #ifdef __cplusplus
       }
@@ -48,6 +48,23 @@
   */
   #define __BIT_VECTOR_MANAGER_ENABLE__
 
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+    //! Configuration: Bit Vector Word Size
+    /*!
+      Configure the word size (in bits) used by the bit vector scan functions here. The storage is always a bitvector_t (8-bit) array; words are only used to read and write many bits at once. The available values for this macro are 8, 16, 32 or 64.
+    */
+    #define __BIT_VECTOR_WORD_SIZE__ 32
+
+    //! Configuration: Bit Vector SIMD Operations
+    /*!
+      Enable or disable the SSE2/AVX2 bulk operations of bit vectors here. They are selected at runtime on x86 processors with GCC or Clang; other targets always use the word operations. The available values for this macro are:
+        - __BIT_VECTOR_SIMD_ENABLE__
+        - __BIT_VECTOR_SIMD_DISABLE__
+    */
+    #define __BIT_VECTOR_SIMD_ENABLE__
+
+  #endif
+
   //! Configuration: Memory Pool Manager
   /*!
     Configure the system memory pool manager here. The available values for this macro are:
@@ -76,6 +93,37 @@
       X(mp32BitPool, sizeof(uint32_t), 10)\
       X(mp64BitPool, sizeof(uint64_t), 5)
 
+    //! Configuration: DataBank Spare Pools
+    /*!
+      Configure here the amount of memory pools that can be added to the default data bank at runtime with DataBank_registerPool, besides the __DATA_BANK_POOL_LIST__ pools.
+    */
+    #define __DATA_BANK_SPARE_POOLS__ 4
+
+    //! Configuration: DataBank Profiler
+    /*!
+      Enable or disable the DataBank allocation trace (see DataBank_setProfilerCallback and Tools/DataBankProfiler). The available values for this macro are:
+        - __DATA_BANK_PROFILER_ENABLE__
+        - __DATA_BANK_PROFILER_DISABLE__
+    */
+    #define __DATA_BANK_PROFILER_DISABLE__
+
+  #endif
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+    //! Configuration: Memory Pool Telemetry
+    /*!
+      Enable or disable the memory pool telemetry export (see Telemetry.h). The available values for this macro are:
+        - __MEMORY_POOL_TELEMETRY_ENABLE__
+        - __MEMORY_POOL_TELEMETRY_DISABLE__
+    */
+    #define __MEMORY_POOL_TELEMETRY_DISABLE__
+
+    //! Configuration: Memory Pool Telemetry Size
+    /*!
+      Configure the maximum amount of user memory pools registered in telemetry here. The library memory pools are always exported.
+    */
+    #define __MEMORY_POOL_TELEMETRY_SIZE__ 8
+
   #endif
 
   //! Configuration: Buffer Manager
@@ -86,6 +134,31 @@
   */
   #define __BUFFER_MANAGER_ENABLE__
 
+  #if defined(__BUFFER_MANAGER_ENABLE__)
+    //! Configuration: Concurrent Buffers
+    /*!
+      Enable or disable the lock-free BUFFER_TYPE_SPSC and BUFFER_TYPE_MPMC buffers (newSPSCBuffer, newMPMCBuffer, Buffer_pushWait and Buffer_popWait) here. They need the atomic builtins of GCC or Clang, so other compilers always disable them. The available values for this macro are:
+        - __BUFFER_CONCURRENT_ENABLE__
+        - __BUFFER_CONCURRENT_DISABLE__
+    */
+    #define __BUFFER_CONCURRENT_ENABLE__
+
+    //! Configuration: Buffer Wait Spin Limit
+    /*!
+      Configure the maximum amount of retries of Buffer_pushWait and Buffer_popWait before a thread is parked on a futex. Each buffer adapts its amount of retries between 1 and this value: it doubles when spinning gets the data and halves when a thread has to park.
+    */
+    #define __BUFFER_WAIT_SPIN_LIMIT__ 256
+
+    //! Configuration: Buffer SIMD Reductions
+    /*!
+      Enable or disable the AVX2 kernels of the buffer window reductions (Buffer_getSum, Buffer_getMinimum...) here. They are selected at runtime on x86 processors with GCC or Clang; other targets always use the scalar loops. The available values for this macro are:
+        - __BUFFER_SIMD_ENABLE__
+        - __BUFFER_SIMD_DISABLE__
+    */
+    #define __BUFFER_SIMD_ENABLE__
+
+  #endif
+
   //! Configuration: TypedList Manager
   /*!
     Enable or disable system typed list manager here. The available values for this macro are:
@@ -15,22 +15,353 @@
     __DATA_BANK_POOL_LIST__
   #undef X
 
+  //! Enumeration: Amount of Listed Pools
+  /*!
+    Counts the __DATA_BANK_POOL_LIST__ memory pools.
+  */
+  #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
+    __DATA_BANK_LISTED_POOL_##mpMemoryPoolName,
+
+    enum {
+      __DATA_BANK_POOL_LIST__
+      __DATA_BANK_AMOUNT_OF_LISTED_POOLS__
+    };
+  #undef X
+
+  //! Data Bank: Default Data Bank
+  /*!
+    Declaration of the default data bank with the __DATA_BANK_POOL_LIST__ memory pools already registered and room for __DATA_BANK_SPARE_POOLS__ more memory pools.
+  */
+  #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
+    &__mpsMemoryPoolStructure##mpMemoryPoolName,
+
+    static mpool_t __mppPoolsdbDefaultDataBank[__DATA_BANK_AMOUNT_OF_LISTED_POOLS__ + __DATA_BANK_SPARE_POOLS__] = {
+      __DATA_BANK_POOL_LIST__
+    };
+  #undef X
+
+  static mpool_t __mppAddressIndexdbDefaultDataBank[__DATA_BANK_AMOUNT_OF_LISTED_POOLS__ + __DATA_BANK_SPARE_POOLS__] = {NULL};
+
+  static databank_structure_t __dbsDataBankStructuredbDefaultDataBank = {
+    .mppPools = __mppPoolsdbDefaultDataBank,
+    .mppAddressIndex = __mppAddressIndexdbDefaultDataBank,
+    .ui8MaxAmountOfPools = __DATA_BANK_AMOUNT_OF_LISTED_POOLS__ + __DATA_BANK_SPARE_POOLS__,
+    .ui8AmountOfPools = __DATA_BANK_AMOUNT_OF_LISTED_POOLS__,
+    .ui8AmountOfIndexedPools = 0
+  };
+
+  databank_t dbDefaultDataBank = &__dbsDataBankStructuredbDefaultDataBank;
+
+  #if defined(__DATA_BANK_PROFILER_ENABLE__)
+    //! Private Function: Data Bank Trace Recorder
+    /*!
+      Sends a trace record to the profiler callback of a data bank.
+      \param dbDataBank is a databank_t type. It's the data bank.
+      \param ui8Operation is a data_bank_trace_operation_t value.
+      \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+      \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
+    */
+    static void __DataBank_record(databank_t dbDataBank, uint8_t ui8Operation, uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
+      if (dbDataBank->vfpProfilerCallback != NULL && ui16AllocationSize > 0){
+        data_bank_trace_t dbtRecord = {
+          .ui8Operation = ui8Operation,
+          .ui8ElementSize = ui8ElementSize,
+          .ui16AllocationSize = ui16AllocationSize
+        };
+        dbDataBank->vfpProfilerCallback(&dbtRecord);
+      }
+    }
+
+    //! Function: Data Bank Profiler Callback Setter
+    /*!
+      Sets the function that receives the allocation trace of a data bank. The trace starts with a DATA_BANK_TRACE_POOL record for each registered memory pool, so it's the whole picture of one bank: record each bank on its own (a file, a serial port...) and replay it with Tools/DataBankProfiler to size its pool list (__DATA_BANK_POOL_LIST__ for dbDefaultDataBank).
+      \param dbDataBank is a databank_t type. It's the data bank.
+      \param vfpProfilerCallback is a function pointer. It's the trace receiver or NULL to stop the recording.
+    */
+    void DataBank_setProfilerCallback(databank_t dbDataBank, void (*vfpProfilerCallback)(const data_bank_trace_t* dbtRecord)){
+      uint8_t ui8Counter = 0;
+      dbDataBank->vfpProfilerCallback = vfpProfilerCallback;
+      for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools ; ui8Counter++){
+        __DataBank_record(dbDataBank, DATA_BANK_TRACE_POOL, MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]), MemoryPool_getSize(dbDataBank->mppPools[ui8Counter]));
+      }
+    }
+  #else
+    #define __DataBank_record(dbDataBank, ui8Operation, ui8ElementSize, ui16AllocationSize)
+  #endif
+
+  //! Private Function: Data Bank Address Index Updater
+  /*!
+    Inserts the registered memory pools that are not indexed yet in the address index. The index is kept sorted by the data memory address of the memory pools.
+    \param dbDataBank is a databank_t type. It's the data bank.
+  */
+  static void __DataBank_updateAddressIndex(databank_t dbDataBank){
+    while (dbDataBank->ui8AmountOfIndexedPools < dbDataBank->ui8AmountOfPools){
+      mpool_t mpMemoryPool = dbDataBank->mppPools[dbDataBank->ui8AmountOfIndexedPools];
+      uint8_t ui8Position = dbDataBank->ui8AmountOfIndexedPools;
+      while (ui8Position > 0 && dbDataBank->mppAddressIndex[ui8Position - 1]->ui8pDataMemory > mpMemoryPool->ui8pDataMemory){
+        dbDataBank->mppAddressIndex[ui8Position] = dbDataBank->mppAddressIndex[ui8Position - 1];
+        ui8Position--;
+      }
+      dbDataBank->mppAddressIndex[ui8Position] = mpMemoryPool;
+      dbDataBank->ui8AmountOfIndexedPools++;
+    }
+  }
+
+  //! Function: Data Bank Pool Register
+  /*!
+    Registers a memory pool in a data bank. More than one memory pool with the same element size can be registered: They are used in registration order.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param mpMemoryPool is a mpool_t type. It's the memory pool (see newMemoryPool and MemoryPool_create).
+    \return Returns DATA_BANK_STATUS_POOL_REGISTERED or DATA_BANK_STATUS_POOL_NOT_REGISTERED.
+  */
+  data_bank_status_t DataBank_registerPool(databank_t dbDataBank, mpool_t mpMemoryPool){
+    if (mpMemoryPool == NULL || dbDataBank->ui8AmountOfPools >= dbDataBank->ui8MaxAmountOfPools){
+      return DATA_BANK_STATUS_POOL_NOT_REGISTERED;
+    }
+    dbDataBank->mppPools[dbDataBank->ui8AmountOfPools] = mpMemoryPool;
+    dbDataBank->ui8AmountOfPools++;
+    __DataBank_updateAddressIndex(dbDataBank);
+    __DataBank_record(dbDataBank, DATA_BANK_TRACE_POOL, MemoryPool_getElementSize(mpMemoryPool), MemoryPool_getSize(mpMemoryPool));
+    return DATA_BANK_STATUS_POOL_REGISTERED;
+  }
+
+  //! Function: Data Bank Pool Getter
+  /*!
+    Gets the first memory pool of a data bank with a given element size.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \return Returns the memory pool or NULL if there is no memory pool with this element size.
+  */
+  mpool_t DataBank_getPool(databank_t dbDataBank, uint8_t ui8ElementSize){
+    uint8_t ui8Counter = 0;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        return dbDataBank->mppPools[ui8Counter];
+      }
+    }
+    return NULL;
+  }
+
+  //! Function: Data Bank Pool Getter
+  /*!
+    Gets the memory pool of a data bank that owns an address. It's a binary search on the address index, so it takes O(log(n)) for n memory pools.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param vpAddress is a void pointer. It's the address of an allocation.
+    \return Returns the memory pool or NULL if the address doesn't belong to the data bank.
+  */
+  mpool_t DataBank_getPoolByAddress(databank_t dbDataBank, void* vpAddress){
+    uint8_t ui8Start = 0;
+    uint8_t ui8End = 0;
+    if (vpAddress == NULL){
+      return NULL;
+    }
+    __DataBank_updateAddressIndex(dbDataBank);
+    ui8End = dbDataBank->ui8AmountOfIndexedPools;
+    while (ui8Start < ui8End){
+      uint8_t ui8Middle = ui8Start + ((ui8End - ui8Start) >> 1);
+      if (dbDataBank->mppAddressIndex[ui8Middle]->ui8pDataMemory <= (uint8_t*) vpAddress){
+        ui8Start = ui8Middle + 1;
+      }
+      else{
+        ui8End = ui8Middle;
+      }
+    }
+    if (ui8Start == 0 || !MemoryPool_checkOwnership(dbDataBank->mppAddressIndex[ui8Start - 1], vpAddress)){
+      return NULL;
+    }
+    return dbDataBank->mppAddressIndex[ui8Start - 1];
+  }
+
+  //! Function: Data Bank Amount of Pools Getter
+  /*!
+    Gets the amount of memory pools registered in a data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \return Returns the amount of memory pools.
+  */
+  uint8_t DataBank_getAmountOfPools(databank_t dbDataBank){
+    return dbDataBank->ui8AmountOfPools;
+  }
+
+  //! Function: Data Bank Pool Getter
+  /*!
+    Gets a memory pool of a data bank by its registration position. The pools of __DATA_BANK_POOL_LIST__ come first on the default data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8Position is a unsigned 8-bit integer. It's the position of the memory pool.
+    \return Returns the memory pool or NULL if the position is invalid.
+  */
+  mpool_t DataBank_getPoolAt(databank_t dbDataBank, uint8_t ui8Position){
+    if (ui8Position >= dbDataBank->ui8AmountOfPools){
+      return NULL;
+    }
+    return dbDataBank->mppPools[ui8Position];
+  }
+
+  //! Function: Data Bank Deallocation
+  /*!
+    Deallocates a whole allocation in a given data bank. The owner memory pool is found by the address index, so the element size and the allocation size are not needed.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param vppAllocatedPointer is a void pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL
+  */
+  void (DataBank_freePtrFrom)(databank_t dbDataBank, void** vppAllocatedPointer){
+    mpool_t mpMemoryPool = DataBank_getPoolByAddress(dbDataBank, *vppAllocatedPointer);
+    if (mpMemoryPool != NULL){
+      #if defined(__DATA_BANK_PROFILER_ENABLE__)
+        uint16_t ui16FreeSpace = MemoryPool_getFreeSpace(mpMemoryPool);
+      #endif
+      MemoryPool_freePtr(mpMemoryPool, vppAllocatedPointer);
+      __DataBank_record(dbDataBank, DATA_BANK_TRACE_DEALLOCATION, MemoryPool_getElementSize(mpMemoryPool), MemoryPool_getFreeSpace(mpMemoryPool) - ui16FreeSpace);
+    }
+  }
+
   //! Function: Data Bank Allocation
   /*!
-    Allocate space memory in Data Bank.
+    Allocate space memory in a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
     \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
     \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
     \return Returns the memory allocation address or NULL if the allocation is unsuccessful.
   */
-  void* DataBank_malloc(uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return MemoryPool_malloc(mpMemoryPoolName, ui16AllocationSize);\
+  void* DataBank_mallocFrom(databank_t dbDataBank, uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
+    uint8_t ui8Counter = 0;
+    void* vpAllocation = NULL;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools && vpAllocation == NULL ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        vpAllocation = MemoryPool_malloc(dbDataBank->mppPools[ui8Counter], ui16AllocationSize);
       }
+    }
+    __DataBank_record(dbDataBank, ((vpAllocation != NULL) ? DATA_BANK_TRACE_ALLOCATION : DATA_BANK_TRACE_ALLOCATION_ERROR), ui8ElementSize, ui16AllocationSize);
+    return vpAllocation;
+  }
 
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return NULL;
+  //! Function: Data Bank Allocation
+  /*!
+    Allocates and clears space memory in a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
+    \return Returns the memory allocation address or NULL if the allocation is unsuccessful.
+  */
+  void* DataBank_callocFrom(databank_t dbDataBank, uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
+    uint8_t ui8Counter = 0;
+    void* vpAllocation = NULL;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools && vpAllocation == NULL ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        vpAllocation = MemoryPool_calloc(dbDataBank->mppPools[ui8Counter], ui16AllocationSize);
+      }
+    }
+    __DataBank_record(dbDataBank, ((vpAllocation != NULL) ? DATA_BANK_TRACE_ALLOCATION : DATA_BANK_TRACE_ALLOCATION_ERROR), ui8ElementSize, ui16AllocationSize);
+    return vpAllocation;
+  }
+
+  //! Function: Data Bank Deallocation
+  /*!
+    Deallocate space memory in a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param vppAllocatedPointer is a void pointer parameter. It's the address of the allocation. On case deallocation successfully, this function going to set this pointer to NULL
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
+  */
+  void (DataBank_freeFrom)(databank_t dbDataBank, void** vpAllocatedPointer, uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
+    uint8_t ui8Counter = 0;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools && *vpAllocatedPointer != NULL ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        MemoryPool_free(dbDataBank->mppPools[ui8Counter], vpAllocatedPointer, ui16AllocationSize);
+        if (*vpAllocatedPointer == NULL){
+          __DataBank_record(dbDataBank, DATA_BANK_TRACE_DEALLOCATION, ui8ElementSize, ui16AllocationSize);
+        }
+      }
+    }
+  }
+
+  //! Function: Data Bank Fragmentation Checker
+  /*!
+    Check if a given data bank is fragmented.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \return Return FRAGMENTED_MEMORY, UNFRAGMENTED_MEMORY or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
+  */
+  data_bank_status_t DataBank_checkFragmentationFrom(databank_t dbDataBank, uint8_t ui8ElementSize){
+    mpool_t mpMemoryPool = DataBank_getPool(dbDataBank, ui8ElementSize);
+    if (mpMemoryPool == NULL){
+      return DATA_BANK_STATUS_UNRECOGNIZED_SIZE;
+    }
+    return ((MemoryPool_checkFragmentation(mpMemoryPool) == MEMORY_POOL_STATUS_FRAGMENTED_MEMORY) ? DATA_BANK_STATUS_FRAGMENTED_MEMORY : DATA_BANK_STATUS_UNFRAGMENTED_MEMORY);
+  }
+
+  //! Function: Data Bank Fragmented Free Space Checker
+  /*!
+    Check the maximum allocation of a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \return Return the maximum memory pool allocation or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
+  */
+  uint16_t DataBank_getMaxFreeSpaceFrom(databank_t dbDataBank, uint8_t ui8ElementSize){
+    uint8_t ui8Counter = 0;
+    uint16_t ui16MaxFreeSpace = 0;
+    bool bFlagRecognizedSize = false;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        ui16MaxFreeSpace = SoftMath_bigger(MemoryPool_getMaxFreeSpace(dbDataBank->mppPools[ui8Counter]), ui16MaxFreeSpace);
+        bFlagRecognizedSize = true;
+      }
+    }
+    return ((bFlagRecognizedSize == true) ? ui16MaxFreeSpace : DATA_BANK_STATUS_UNRECOGNIZED_SIZE);
+  }
+
+  //! Function: Data Bank Reallocation
+  /*!
+    Reallocate space memory in a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \param vppAllocatedPointer is a void pointer to pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL.
+    \param ui16OldAllocationSize is a unsigned 16-bit integer. This is the old size of space allocation.
+    \param ui16NewAllocationSize is a unsigned 16-bit integer. This is the new size of space allocation.
+    \return Returns DATA_BANK_STATUS_REALLOCATED_MEMORY or DATA_BANK_STATUS_REALLOCATION_ERROR.
+  */
+  data_bank_status_t (DataBank_reallocFrom)(databank_t dbDataBank, uint8_t ui8ElementSize, void** vppAllocatedPointer, uint16_t ui16OldAllocationSize, uint16_t ui16NewAllocationSize){
+    void* vpNewAllocation = DataBank_callocFrom(dbDataBank, ui8ElementSize, ui16NewAllocationSize);
+    if (vpNewAllocation == NULL){
+      return DATA_BANK_STATUS_REALLOCATION_ERROR;
+    }
+    memcpy(vpNewAllocation, *vppAllocatedPointer, ((ui16OldAllocationSize < ui16NewAllocationSize) ? ui16OldAllocationSize : ui16NewAllocationSize) * ui8ElementSize);
+    DataBank_freeFrom(dbDataBank, vppAllocatedPointer, ui8ElementSize, ui16OldAllocationSize);
+    if (*vppAllocatedPointer != NULL){
+      DataBank_freeFrom(dbDataBank, &vpNewAllocation, ui8ElementSize, ui16NewAllocationSize);
+      return DATA_BANK_STATUS_REALLOCATION_ERROR;
+    }
+    *vppAllocatedPointer = vpNewAllocation;
+    return DATA_BANK_STATUS_REALLOCATED_MEMORY;
+  }
+
+  //! Function: Data Bank Free Space Checker
+  /*!
+    Check free space of a given data bank.
+    \param dbDataBank is a databank_t type. It's the data bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \return Return the memory pool free space or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
+  */
+  uint16_t DataBank_getFreeSpaceFrom(databank_t dbDataBank, uint8_t ui8ElementSize){
+    uint8_t ui8Counter = 0;
+    uint16_t ui16FreeSpace = 0;
+    bool bFlagRecognizedSize = false;
+    for (ui8Counter = 0 ; ui8Counter < dbDataBank->ui8AmountOfPools ; ui8Counter++){
+      if (MemoryPool_getElementSize(dbDataBank->mppPools[ui8Counter]) == ui8ElementSize){
+        ui16FreeSpace = ui16FreeSpace + MemoryPool_getFreeSpace(dbDataBank->mppPools[ui8Counter]);
+        bFlagRecognizedSize = true;
+      }
+    }
+    return ((bFlagRecognizedSize == true) ? ui16FreeSpace : DATA_BANK_STATUS_UNRECOGNIZED_SIZE);
+  }
+
+  //! Function: Data Bank Allocation
+  /*!
+    Allocate space memory in Data Bank.
+    \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+    \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
+    \return Returns the memory allocation address or NULL if the allocation is unsuccessful.
+  */
+  void* DataBank_malloc(uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
+    return DataBank_mallocFrom(dbDefaultDataBank, ui8ElementSize, ui16AllocationSize);
   }
 
   //! Function: Data Bank Allocation
@@ -41,14 +372,7 @@
     \return Returns the memory allocation address or NULL if the allocation is unsuccessful.
   */
   void* DataBank_calloc(uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return MemoryPool_calloc(mpMemoryPoolName, ui16AllocationSize);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return NULL;
+    return DataBank_callocFrom(dbDefaultDataBank, ui8ElementSize, ui16AllocationSize);
   }
 
   //! Function: Data Bank Deallocation
@@ -59,13 +383,7 @@
     \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
   */
   void (DataBank_free)(void** vpAllocatedPointer, uint8_t ui8ElementSize, uint16_t ui16AllocationSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return MemoryPool_free(mpMemoryPoolName, vpAllocatedPointer, ui16AllocationSize);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
+    DataBank_freeFrom(dbDefaultDataBank, vpAllocatedPointer, ui8ElementSize, ui16AllocationSize);
   }
 
   //! Function: Data Bank Fragmentation Checker
@@ -75,14 +393,7 @@
     \return Return FRAGMENTED_MEMORY, UNFRAGMENTED_MEMORY or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
   */
   data_bank_status_t DataBank_checkFragmentation(uint8_t ui8ElementSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return ((MemoryPool_checkFragmentation(mpMemoryPoolName) == MEMORY_POOL_STATUS_FRAGMENTED_MEMORY) ? DATA_BANK_STATUS_FRAGMENTED_MEMORY : DATA_BANK_STATUS_UNFRAGMENTED_MEMORY);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return DATA_BANK_STATUS_UNRECOGNIZED_SIZE;
+    return DataBank_checkFragmentationFrom(dbDefaultDataBank, ui8ElementSize);
   }
 
   //! Function: Data Bank Fragmented Free Space Checker
@@ -92,14 +403,7 @@
     \return Return the maximum memory pool allocation or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
   */
   uint16_t DataBank_getMaxFreeSpace(uint8_t ui8ElementSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return MemoryPool_getMaxFreeSpace(mpMemoryPoolName);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return DATA_BANK_STATUS_UNRECOGNIZED_SIZE;
+    return DataBank_getMaxFreeSpaceFrom(dbDefaultDataBank, ui8ElementSize);
   }
 
   //! Function: Data Bank Reallocation
@@ -112,14 +416,7 @@
     \return Returns the new memory allocation address or NULL if the allocation is unsuccessful.
   */
   data_bank_status_t (DataBank_realloc)(uint8_t ui8ElementSize, void** vppAllocatedPointer, uint16_t ui16OldAllocationSize, uint16_t ui16NewAllocationSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return ((MemoryPool_realloc(mpMemoryPoolName, vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize) == MEMORY_POOL_STATUS_REALLOCATED_MEMORY) ? DATA_BANK_STATUS_REALLOCATED_MEMORY : DATA_BANK_STATUS_REALLOCATION_ERROR);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return DATA_BANK_STATUS_REALLOCATION_ERROR;
+    return DataBank_reallocFrom(dbDefaultDataBank, ui8ElementSize, vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize);
   }
 
   //! Function: Data Bank Free Space Checker
@@ -129,14 +426,7 @@
     \return Return the memory pool free space or DATA_BANK_STATUS_UNRECOGNIZED_SIZE.
   */
   uint16_t DataBank_getFreeSpace(uint8_t ui8ElementSize){
-    #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
-      if (ui8DataPoolSize == ui8ElementSize){\
-        return MemoryPool_getFreeSpace(mpMemoryPoolName);\
-      }
-
-      __DATA_BANK_POOL_LIST__
-    #undef X
-    return DATA_BANK_STATUS_UNRECOGNIZED_SIZE;
+    return DataBank_getFreeSpaceFrom(dbDefaultDataBank, ui8ElementSize);
   }
 
 #endif
@@ -45,15 +45,102 @@
     #endif
 
     #include <stdint.h>
+    #include "./MemoryPool.h"
 
     typedef enum{
       DATA_BANK_STATUS_UNFRAGMENTED_MEMORY = 0,
       DATA_BANK_STATUS_FRAGMENTED_MEMORY,
       DATA_BANK_STATUS_REALLOCATED_MEMORY,
       DATA_BANK_STATUS_REALLOCATION_ERROR,
+      DATA_BANK_STATUS_POOL_REGISTERED,
+      DATA_BANK_STATUS_POOL_NOT_REGISTERED,
       DATA_BANK_STATUS_UNRECOGNIZED_SIZE = 65535
     } data_bank_status_t;
 
+    //! Enumeration Definition: Data Bank Trace Operation
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef enum{
+      DATA_BANK_TRACE_ALLOCATION = 0,
+      DATA_BANK_TRACE_DEALLOCATION,
+      DATA_BANK_TRACE_ALLOCATION_ERROR,
+      DATA_BANK_TRACE_POOL
+    } data_bank_trace_operation_t;
+
+    //! Type Definition: Data Bank Trace Record
+    /*!
+      Record of the DataBank profiler. It has 4 bytes and it's the record format expected by Tools/DataBankProfiler (little-endian). A DATA_BANK_TRACE_POOL record describes a registered memory pool: ui16AllocationSize is its amount of elements.
+    */
+    typedef struct{
+      uint8_t ui8Operation;                       /*!< uint8_t integer type variable (data_bank_trace_operation_t). */
+      uint8_t ui8ElementSize;                     /*!< uint8_t integer type variable. */
+      uint16_t ui16AllocationSize;                /*!< uint16_t integer type variable. */
+    } data_bank_trace_t;
+
+    //! Type Definition: Data Bank Structure
+    /*!
+      This struct creates a data bank: a set of memory pools registered at runtime and selected by element size.
+    */
+    typedef struct{
+      mpool_t* const mppPools;                    /*!< mpool_t pointer const type variable. */
+      mpool_t* const mppAddressIndex;             /*!< mpool_t pointer const type variable. */
+      const uint8_t ui8MaxAmountOfPools;          /*!< const uint8_t integer type variable. */
+      uint8_t ui8AmountOfPools;                   /*!< uint8_t integer type variable. */
+      uint8_t ui8AmountOfIndexedPools;            /*!< uint8_t integer type variable. */
+      #if defined(__DATA_BANK_PROFILER_ENABLE__)
+        void (*vfpProfilerCallback)(const data_bank_trace_t* dbtRecord);  /*!< void type function pointer. */
+      #endif
+    } databank_structure_t;
+
+    //! Type Definition: databank_t
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef databank_structure_t* databank_t;
+
+    //! Macro: Data Bank Creator
+    /*!
+      Constructs a empty data bank. Memory pools must be added with DataBank_registerPool.
+      \param dbName is a data bank name.
+      \param ui8BankSize is a 8-bit integer. It's the maximum amount of memory pools of your data bank.
+    */
+    #define newDataBank(dbName, ui8BankSize)\
+      mpool_t __mppPools##dbName[ui8BankSize] = {NULL};\
+      mpool_t __mppAddressIndex##dbName[ui8BankSize] = {NULL};\
+      databank_structure_t __dbsDataBankStructure##dbName = {\
+        .mppPools = __mppPools##dbName,\
+        .mppAddressIndex = __mppAddressIndex##dbName,\
+        .ui8MaxAmountOfPools = ui8BankSize,\
+        .ui8AmountOfPools = 0,\
+        .ui8AmountOfIndexedPools = 0\
+      };\
+      databank_t dbName = &__dbsDataBankStructure##dbName
+
+    //! Macro: Static Data Bank Creator
+    /*!
+      Constructs a static empty data bank. Memory pools must be added with DataBank_registerPool.
+      \param dbName is a data bank name.
+      \param ui8BankSize is a 8-bit integer. It's the maximum amount of memory pools of your data bank.
+    */
+    #define newStaticDataBank(dbName, ui8BankSize)\
+      static mpool_t __mppPools##dbName[ui8BankSize] = {NULL};\
+      static mpool_t __mppAddressIndex##dbName[ui8BankSize] = {NULL};\
+      static databank_structure_t __dbsDataBankStructure##dbName = {\
+        .mppPools = __mppPools##dbName,\
+        .mppAddressIndex = __mppAddressIndex##dbName,\
+        .ui8MaxAmountOfPools = ui8BankSize,\
+        .ui8AmountOfPools = 0,\
+        .ui8AmountOfIndexedPools = 0\
+      };\
+      static databank_t dbName = &__dbsDataBankStructure##dbName
+
+    //! Default Data Bank
+    /*!
+      Data bank built from __DATA_BANK_POOL_LIST__. All DataBank functions without a databank_t parameter use it.
+    */
+    extern databank_t dbDefaultDataBank;
+
     //! Macro: Data Bank Deallocation
     /*!
       Deallocate space memory in Data Bank.
@@ -76,6 +163,63 @@
     #define DataBank_realloc(ui8ElementSize, vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize)\
       DataBank_realloc(ui8ElementSize, (void**) vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize)
 
+    //! Macro: Data Bank Deallocation
+    /*!
+      Deallocate space memory in a given data bank.
+      \param dbDataBank is a databank_t type. It's the data bank.
+      \param vppAllocatedPointer is a void pointer parameter. It's the address of the allocation. On case deallocation successfully, this function going to set this pointer to NULL
+      \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+      \param ui16AllocationSize is a unsigned 16-bit integer. This is the size of space allocation.
+    */
+    #define DataBank_freeFrom(dbDataBank, vpAllocatedPointer, ui8ElementSize, ui16AllocationSize)\
+      DataBank_freeFrom(dbDataBank, (void**)vpAllocatedPointer, ui8ElementSize, ui16AllocationSize)
+
+    //! Macro: Data Bank Reallocation
+    /*!
+      Reallocate space memory in a given data bank.
+      \param dbDataBank is a databank_t type. It's the data bank.
+      \param ui8ElementSize is a unsigned 8-bit integer. This is the size of the elements.
+      \param vppAllocatedPointer is a void pointer to pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL.
+      \param ui16OldAllocationSize is a unsigned 16-bit integer. This is the old size of space allocation.
+      \param ui16NewAllocationSize is a unsigned 16-bit integer. This is the new size of space allocation.
+      \return Returns DATA_BANK_STATUS_REALLOCATED_MEMORY or DATA_BANK_STATUS_REALLOCATION_ERROR.
+    */
+    #define DataBank_reallocFrom(dbDataBank, ui8ElementSize, vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize)\
+      DataBank_reallocFrom(dbDataBank, ui8ElementSize, (void**) vppAllocatedPointer, ui16OldAllocationSize, ui16NewAllocationSize)
+
+    //! Macro: Data Bank Deallocation
+    /*!
+      Deallocates a whole allocation in a given data bank. The element size and the allocation size are not needed.
+      \param dbDataBank is a databank_t type. It's the data bank.
+      \param vpAllocatedPointer is a void pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL
+    */
+    #define DataBank_freePtrFrom(dbDataBank, vpAllocatedPointer)\
+      DataBank_freePtrFrom(dbDataBank, (void**) vpAllocatedPointer)
+
+    //! Macro: Data Bank Deallocation
+    /*!
+      Deallocates a whole allocation in Data Bank. The element size and the allocation size are not needed.
+      \param vpAllocatedPointer is a void pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL
+    */
+    #define DataBank_freePtr(vpAllocatedPointer)\
+      DataBank_freePtrFrom(dbDefaultDataBank, vpAllocatedPointer)
+
+    #if defined(__DATA_BANK_PROFILER_ENABLE__)
+      void DataBank_setProfilerCallback(databank_t dbDataBank, void (*vfpProfilerCallback)(const data_bank_trace_t* dbtRecord));                                      /*!< void type function. */
+    #endif
+    data_bank_status_t DataBank_registerPool(databank_t dbDataBank, mpool_t mpMemoryPool);                                                                           /*!< data_bank_status_t type function. */
+    mpool_t DataBank_getPool(databank_t dbDataBank, uint8_t ui8ElementSize);                                                                                          /*!< mpool_t type function. */
+    mpool_t DataBank_getPoolByAddress(databank_t dbDataBank, void* vpAddress);                                                                                        /*!< mpool_t type function. */
+    uint8_t DataBank_getAmountOfPools(databank_t dbDataBank);                                                                                                         /*!< 8-bits integer type function. */
+    mpool_t DataBank_getPoolAt(databank_t dbDataBank, uint8_t ui8Position);                                                                                           /*!< mpool_t type function. */
+    void (DataBank_freePtrFrom)(databank_t dbDataBank, void** vpAllocatedPointer);                                                                                    /*!< void type function. */
+    uint16_t DataBank_getMaxFreeSpaceFrom(databank_t dbDataBank, uint8_t ui8ElementSize);                                                                            /*!< 16-bits integer type function. */
+    uint16_t DataBank_getFreeSpaceFrom(databank_t dbDataBank, uint8_t ui8ElementSize);                                                                               /*!< 16-bits integer type function. */
+    void* DataBank_mallocFrom(databank_t dbDataBank, uint8_t ui8ElementSize, uint16_t ui16AllocationSize);                                                           /*!< void pointer type function. */
+    void* DataBank_callocFrom(databank_t dbDataBank, uint8_t ui8ElementSize, uint16_t ui16AllocationSize);                                                           /*!< void pointer type function. */
+    void (DataBank_freeFrom)(databank_t dbDataBank, void** vpAllocatedPointer, uint8_t ui8ElementSize, uint16_t ui16AllocationSize);                                 /*!< void type function. */
+    data_bank_status_t DataBank_checkFragmentationFrom(databank_t dbDataBank, uint8_t ui8ElementSize);                                                               /*!< data_bank_status_t integer type function. */
+    data_bank_status_t (DataBank_reallocFrom)(databank_t dbDataBank, uint8_t ui8ElementSize, void** vppAllocatedPointer, uint16_t ui16OldAllocationSize, uint16_t ui16NewAllocationSize);   /*!< data_bank_status_t type function. */
     uint16_t DataBank_getMaxFreeSpace(uint8_t ui8ElementSize);                                                                                                        /*!< 16-bits integer type function. */
     uint16_t DataBank_getFreeSpace(uint8_t ui8ElementSize);                                                                                                           /*!< 16-bits integer type function. */
     void* DataBank_malloc(uint8_t ui8ElementSize, uint16_t ui16AllocationSize);							                                                                          /*!< void pointer type function. */
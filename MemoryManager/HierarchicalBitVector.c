@@ -0,0 +1,266 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./HierarchicalBitVector.h"
+  #include <string.h>
+
+  //! Macro: All Bits Word
+  /*!
+    A 64-bit word with all bits set.
+  */
+  #define __HIERARCHICAL_BIT_VECTOR_ONES__ (~((uint64_t) 0))
+
+  //! Macro: Count Trailing Zeros
+  /*!
+    Position of the first set bit of a non-zero 64-bit word.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __HierarchicalBitVector_countTrailingZeros(ui64Word) ((uint32_t) __builtin_ctzll(ui64Word))
+  #else
+    static uint32_t __HierarchicalBitVector_countTrailingZeros(uint64_t ui64Word){
+      uint32_t ui32Counter = 0;
+      while ((ui64Word & 1) == 0){
+        ui64Word = ui64Word >> 1;
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+  #endif
+
+  //! Type Definition: Hierarchical Bit Vector Levels
+  /*!
+    Amount of bits and words and the summary words of each level. Level 0 is the bit vector itself.
+  */
+  typedef struct {
+    uint64_t* ui64pFull[HIERARCHICAL_BIT_VECTOR_LEVELS + 1];
+    uint64_t* ui64pNotEmpty[HIERARCHICAL_BIT_VECTOR_LEVELS + 1];
+    uint32_t ui32AmountOfBits[HIERARCHICAL_BIT_VECTOR_LEVELS + 1];
+    uint32_t ui32AmountOfWords[HIERARCHICAL_BIT_VECTOR_LEVELS + 1];
+  } hbitvector_levels_t;
+
+  //! Private Function: Levels Calculator
+  /*!
+    Calculates the layout of the levels of a hierarchical bit vector.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param hblLevels is a hbitvector_levels_t pointer. It's where the layout will be written.
+  */
+  static void __HierarchicalBitVector_getLevels(hbitvector_t hbvBitVector, hbitvector_levels_t* hblLevels){
+    uint8_t ui8Level = 0;
+    uint64_t* ui64pSummary = NULL;
+    hblLevels->ui32AmountOfBits[0] = hbvBitVector->ui32AmountOfBits;
+    hblLevels->ui32AmountOfWords[0] = HierarchicalBitVector_getAmountOfWords(hbvBitVector->ui32AmountOfBits);
+    for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+      hblLevels->ui32AmountOfBits[ui8Level] = hblLevels->ui32AmountOfWords[ui8Level - 1];
+      hblLevels->ui32AmountOfWords[ui8Level] = HierarchicalBitVector_getAmountOfWords(hblLevels->ui32AmountOfBits[ui8Level]);
+    }
+    hblLevels->ui64pFull[0] = hbvBitVector->ui64pWords;
+    hblLevels->ui64pNotEmpty[0] = hbvBitVector->ui64pWords;
+    ui64pSummary = hbvBitVector->ui64pWords + hblLevels->ui32AmountOfWords[0];
+    for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+      hblLevels->ui64pFull[ui8Level] = ui64pSummary;
+      ui64pSummary = ui64pSummary + hblLevels->ui32AmountOfWords[ui8Level];
+      hblLevels->ui64pNotEmpty[ui8Level] = ui64pSummary;
+      ui64pSummary = ui64pSummary + hblLevels->ui32AmountOfWords[ui8Level];
+    }
+  }
+
+  //! Private Function: Bits Word Loader
+  /*!
+    Loads a 64-bit word of the bits (level 0). The bit n of the word is the bit (ui32WordPosition * 64 + n) of the bit vector, whatever the processor byte order.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  static inline uint64_t __HierarchicalBitVector_loadWord(hbitvector_t hbvBitVector, uint32_t ui32WordPosition){
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      return hbvBitVector->ui64pWords[ui32WordPosition];
+    #else
+      const bitvector_t* bvBytes = (const bitvector_t*) &hbvBitVector->ui64pWords[ui32WordPosition];
+      uint64_t ui64Word = 0;
+      uint8_t ui8Counter = 0;
+      for (ui8Counter = 0 ; ui8Counter < 8 ; ui8Counter++){
+        ui64Word = ui64Word | ((uint64_t) bvBytes[ui8Counter] << (ui8Counter << 3));
+      }
+      return ui64Word;
+    #endif
+  }
+
+  //! Private Function: Level Word Loader
+  /*!
+    Loads a word of a level, inverted or not.
+  */
+  static inline uint64_t __HierarchicalBitVector_loadLevelWord(hbitvector_t hbvBitVector, uint64_t* const* ui64ppSummaries, uint8_t ui8Level, uint32_t ui32WordPosition, uint64_t ui64InvertMask){
+    if (ui8Level == 0){
+      return __HierarchicalBitVector_loadWord(hbvBitVector, ui32WordPosition) ^ ui64InvertMask;
+    }
+    return ui64ppSummaries[ui8Level][ui32WordPosition] ^ ui64InvertMask;
+  }
+
+  //! Private Function: Hierarchical Bit Vector Scanner
+  /*!
+    Finds the next bit with a given value. The search goes up the summaries until a level has a candidate after the start position (the top summary is scanned linearly) and then goes down to the bit, reading a word per level.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \param bFindSet is a bool type. It's true to find a set bit (through the "not empty" summaries) or false to find a clear bit (through the "full" summaries).
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  static uint32_t __HierarchicalBitVector_findNext(hbitvector_t hbvBitVector, uint32_t ui32StartPosition, bool bFindSet){
+    hbitvector_levels_t hblLevels;
+    uint64_t* const* ui64ppSummaries = NULL;
+    uint64_t ui64InvertMask = (bFindSet == true) ? 0 : __HIERARCHICAL_BIT_VECTOR_ONES__;
+    uint64_t ui64Word = 0;
+    uint32_t ui32Position = ui32StartPosition;
+    uint8_t ui8Level = 0;
+    if (ui32StartPosition >= hbvBitVector->ui32AmountOfBits){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    __HierarchicalBitVector_getLevels(hbvBitVector, &hblLevels);
+    ui64ppSummaries = (bFindSet == true) ? hblLevels.ui64pNotEmpty : hblLevels.ui64pFull;
+    for (;;){
+      ui64Word = __HierarchicalBitVector_loadLevelWord(hbvBitVector, ui64ppSummaries, ui8Level, ui32Position >> 6, ui64InvertMask);
+      ui64Word = ui64Word & (__HIERARCHICAL_BIT_VECTOR_ONES__ << (ui32Position & 63));
+      if (ui64Word != 0){
+        ui32Position = (ui32Position & ~((uint32_t) 63)) + __HierarchicalBitVector_countTrailingZeros(ui64Word);
+        break;
+      }
+      if (ui8Level == HIERARCHICAL_BIT_VECTOR_LEVELS){
+        uint32_t ui32WordPosition = 0;
+        for (ui32WordPosition = (ui32Position >> 6) + 1 ; ui32WordPosition < hblLevels.ui32AmountOfWords[ui8Level] ; ui32WordPosition++){
+          ui64Word = ui64ppSummaries[ui8Level][ui32WordPosition] ^ ui64InvertMask;
+          if (ui64Word != 0){
+            break;
+          }
+        }
+        if (ui64Word == 0){
+          return BIT_VECTOR_NOT_FOUND;
+        }
+        ui32Position = (ui32WordPosition << 6) + __HierarchicalBitVector_countTrailingZeros(ui64Word);
+        break;
+      }
+      ui8Level++;
+      ui32Position = (ui32Position >> 6) + 1;
+      if (ui32Position >= hblLevels.ui32AmountOfBits[ui8Level]){
+        return BIT_VECTOR_NOT_FOUND;
+      }
+    }
+    while (ui8Level > 0){
+      if (ui32Position >= hblLevels.ui32AmountOfBits[ui8Level]){
+        return BIT_VECTOR_NOT_FOUND;
+      }
+      ui8Level--;
+      ui64Word = __HierarchicalBitVector_loadLevelWord(hbvBitVector, ui64ppSummaries, ui8Level, ui32Position, ui64InvertMask);
+      if (ui64Word == 0){
+        return BIT_VECTOR_NOT_FOUND;
+      }
+      ui32Position = (ui32Position << 6) + __HierarchicalBitVector_countTrailingZeros(ui64Word);
+    }
+    return ((ui32Position < hbvBitVector->ui32AmountOfBits) ? ui32Position : BIT_VECTOR_NOT_FOUND);
+  }
+
+  //! Function: Hierarchical Bit Vector Eraser
+  /*!
+    Clears all bits and summaries of a hierarchical bit vector.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+  */
+  void HierarchicalBitVector_clear(hbitvector_t hbvBitVector){
+    memset(hbvBitVector->ui64pWords, 0, HierarchicalBitVector_getSize(hbvBitVector->ui32AmountOfBits) * sizeof(uint64_t));
+  }
+
+  //! Function: Hierarchical Bit Vector Setter
+  /*!
+    Sets a bit of a hierarchical bit vector and updates the summaries. Only the levels whose summary changes are written.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32Position is a unsigned 32-bit integer. It's the desirable position.
+  */
+  void HierarchicalBitVector_setBit(hbitvector_t hbvBitVector, uint32_t ui32Position){
+    hbitvector_levels_t hblLevels;
+    uint8_t ui8Level = 0;
+    uint32_t ui32WordPosition = ui32Position >> 6;
+    if (ui32Position >= hbvBitVector->ui32AmountOfBits){
+      return;
+    }
+    __HierarchicalBitVector_getLevels(hbvBitVector, &hblLevels);
+    BitVector_setBit(((bitvector_t*) hbvBitVector->ui64pWords), ui32Position);
+    for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+      uint64_t* ui64pSummary = &hblLevels.ui64pNotEmpty[ui8Level][ui32WordPosition >> 6];
+      uint64_t ui64Bit = (uint64_t) 1 << (ui32WordPosition & 63);
+      if ((*ui64pSummary & ui64Bit) != 0){
+        break;
+      }
+      *ui64pSummary = *ui64pSummary | ui64Bit;
+      ui32WordPosition = ui32WordPosition >> 6;
+    }
+    ui32WordPosition = ui32Position >> 6;
+    if (__HierarchicalBitVector_loadWord(hbvBitVector, ui32WordPosition) == __HIERARCHICAL_BIT_VECTOR_ONES__){
+      for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+        uint64_t* ui64pSummary = &hblLevels.ui64pFull[ui8Level][ui32WordPosition >> 6];
+        *ui64pSummary = *ui64pSummary | ((uint64_t) 1 << (ui32WordPosition & 63));
+        if (*ui64pSummary != __HIERARCHICAL_BIT_VECTOR_ONES__){
+          break;
+        }
+        ui32WordPosition = ui32WordPosition >> 6;
+      }
+    }
+  }
+
+  //! Function: Hierarchical Bit Vector Bit Eraser
+  /*!
+    Clears a bit of a hierarchical bit vector and updates the summaries. Only the levels whose summary changes are written.
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32Position is a unsigned 32-bit integer. It's the desirable position.
+  */
+  void HierarchicalBitVector_clearBit(hbitvector_t hbvBitVector, uint32_t ui32Position){
+    hbitvector_levels_t hblLevels;
+    uint8_t ui8Level = 0;
+    uint32_t ui32WordPosition = ui32Position >> 6;
+    if (ui32Position >= hbvBitVector->ui32AmountOfBits){
+      return;
+    }
+    __HierarchicalBitVector_getLevels(hbvBitVector, &hblLevels);
+    BitVector_clearBit(((bitvector_t*) hbvBitVector->ui64pWords), ui32Position);
+    for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+      uint64_t* ui64pSummary = &hblLevels.ui64pFull[ui8Level][ui32WordPosition >> 6];
+      uint64_t ui64Bit = (uint64_t) 1 << (ui32WordPosition & 63);
+      if ((*ui64pSummary & ui64Bit) == 0){
+        break;
+      }
+      *ui64pSummary = *ui64pSummary & ~ui64Bit;
+      ui32WordPosition = ui32WordPosition >> 6;
+    }
+    ui32WordPosition = ui32Position >> 6;
+    if (__HierarchicalBitVector_loadWord(hbvBitVector, ui32WordPosition) == 0){
+      for (ui8Level = 1 ; ui8Level <= HIERARCHICAL_BIT_VECTOR_LEVELS ; ui8Level++){
+        uint64_t* ui64pSummary = &hblLevels.ui64pNotEmpty[ui8Level][ui32WordPosition >> 6];
+        *ui64pSummary = *ui64pSummary & ~((uint64_t) 1 << (ui32WordPosition & 63));
+        if (*ui64pSummary != 0){
+          break;
+        }
+        ui32WordPosition = ui32WordPosition >> 6;
+      }
+    }
+  }
+
+  //! Function: Next Set Bit Finder
+  /*!
+    Finds the next set bit of a hierarchical bit vector, reading at most two words on each level below the top summary. The top summary is scanned word by word: it has one word for each 2^24 bits (256 words for 2^32 bits).
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t HierarchicalBitVector_findNextSet(hbitvector_t hbvBitVector, uint32_t ui32StartPosition){
+    return __HierarchicalBitVector_findNext(hbvBitVector, ui32StartPosition, true);
+  }
+
+  //! Function: Next Clear Bit Finder
+  /*!
+    Finds the next clear bit of a hierarchical bit vector, reading at most two words on each level below the top summary. The top summary is scanned word by word: it has one word for each 2^24 bits (256 words for 2^32 bits).
+    \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+    \param ui32StartPosition is a unsigned 32-bit integer. It's the first position to be checked.
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t HierarchicalBitVector_findNextClear(hbitvector_t hbvBitVector, uint32_t ui32StartPosition){
+    return __HierarchicalBitVector_findNext(hbvBitVector, ui32StartPosition, false);
+  }
+
+#endif
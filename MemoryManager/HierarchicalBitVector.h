@@ -0,0 +1,168 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __HIERARCHICAL_BIT_VECTOR_HEADER__
+  #define __HIERARCHICAL_BIT_VECTOR_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+
+    //! Macro: Hierarchical Bit Vector Summary Levels
+    /*!
+      Amount of summary levels over the bits. Each summary bit represents a 64-bit word of the level below, so three levels cover 2^24 words (2^30 bits) with a single top word.
+    */
+    #define HIERARCHICAL_BIT_VECTOR_LEVELS 3
+
+    //! Type Definition: Hierarchical Bit Vector Structure
+    /*!
+      Bit vector with two summaries per level: a "full" summary (bit set when the 64-bit word below has all bits set) and a "not empty" summary (bit set when the word below has any bit set). Both are 0 for an empty bit vector, so a zeroed memory is a valid empty hierarchical bit vector.
+    */
+    typedef struct {
+      uint64_t* const ui64pWords;                                                                                                   /*!< const 64-bits integer pointer type. */
+      const uint32_t ui32AmountOfBits;                                                                                              /*!< const 32-bits integer type. */
+    } hbitvector_structure_t;
+
+    //! Type Definition: Hierarchical Bit Vector Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef hbitvector_structure_t* hbitvector_t;
+
+    //! Macro: Amount of 64-bit Words
+    /*!
+      Calculates the amount of 64-bit words needed by an amount of bits.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \return Returns the amount of words.
+    */
+    #define HierarchicalBitVector_getAmountOfWords(uiAmountOfBits)\
+      ((((uint32_t) (uiAmountOfBits)) + 63) >> 6)
+
+    //! Macro: Hierarchical Bit Vector Size
+    /*!
+      Calculates the amount of 64-bit words used by a hierarchical bit vector: the bits and the two summaries of each level.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits.
+      \return Returns the amount of words.
+    */
+    #define HierarchicalBitVector_getSize(uiAmountOfBits)\
+      (HierarchicalBitVector_getAmountOfWords(uiAmountOfBits) + 2 * (\
+        HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(uiAmountOfBits)) +\
+        HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(uiAmountOfBits))) +\
+        HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(HierarchicalBitVector_getAmountOfWords(uiAmountOfBits))))))
+
+    //! Macro: Hierarchical Bit Vector Creator
+    /*!
+      This macro creates a hierarchical bit vector with all bits cleared.
+      \param hbvName is the hierarchical bit vector name.
+      \param uiAmountOfBit is a unsigned integer. It's the desirable amount of bits.
+    */
+    #define newHierarchicalBitVector(hbvName, uiAmountOfBit)\
+      uint64_t __ui64HierarchicalBitVectorWords##hbvName[HierarchicalBitVector_getSize(uiAmountOfBit)] = {0};\
+      hbitvector_structure_t __hbvsHierarchicalBitVector##hbvName = {\
+        .ui64pWords = __ui64HierarchicalBitVectorWords##hbvName,\
+        .ui32AmountOfBits = uiAmountOfBit\
+      };\
+      hbitvector_t hbvName = &__hbvsHierarchicalBitVector##hbvName
+
+    //! Macro: Static Hierarchical Bit Vector Creator
+    /*!
+      This macro creates a static hierarchical bit vector with all bits cleared.
+      \param hbvName is the hierarchical bit vector name.
+      \param uiAmountOfBit is a unsigned integer. It's the desirable amount of bits.
+    */
+    #define newStaticHierarchicalBitVector(hbvName, uiAmountOfBit)\
+      static uint64_t __ui64HierarchicalBitVectorWords##hbvName[HierarchicalBitVector_getSize(uiAmountOfBit)] = {0};\
+      static hbitvector_structure_t __hbvsHierarchicalBitVector##hbvName = {\
+        .ui64pWords = __ui64HierarchicalBitVectorWords##hbvName,\
+        .ui32AmountOfBits = uiAmountOfBit\
+      };\
+      static hbitvector_t hbvName = &__hbvsHierarchicalBitVector##hbvName
+
+    //! Macro: Hierarchical Bit Vector Bits
+    /*!
+      Gets the bits of a hierarchical bit vector as a bit vector, to be read by the BitVector functions. Don't write it directly: the summaries would not be updated.
+      \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+      \return Returns a const bitvector_t pointer.
+    */
+    #define HierarchicalBitVector_getBitVector(hbvBitVector)\
+      ((const bitvector_t*) (hbvBitVector)->ui64pWords)
+
+    //! Macro: Hierarchical Bit Vector Reader
+    /*!
+      Reads a bit of a hierarchical bit vector.
+      \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+      \param uiPosition is a unsigned integer. It's the desirable position.
+    */
+    #define HierarchicalBitVector_readBit(hbvBitVector, uiPosition)\
+      BitVector_readBit(HierarchicalBitVector_getBitVector(hbvBitVector), uiPosition)
+
+    //! Macro: First Set Bit Finder
+    /*!
+      Finds the first set bit of a hierarchical bit vector.
+      \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+      \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+    */
+    #define HierarchicalBitVector_findFirstSet(hbvBitVector)\
+      HierarchicalBitVector_findNextSet(hbvBitVector, 0)
+
+    //! Macro: First Clear Bit Finder
+    /*!
+      Finds the first clear bit of a hierarchical bit vector.
+      \param hbvBitVector is a hbitvector_t type. It's the hierarchical bit vector.
+      \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+    */
+    #define HierarchicalBitVector_findFirstClear(hbvBitVector)\
+      HierarchicalBitVector_findNextClear(hbvBitVector, 0)
+
+    void HierarchicalBitVector_clear(hbitvector_t hbvBitVector);                                                                    /*!< void type function. */
+    void HierarchicalBitVector_setBit(hbitvector_t hbvBitVector, uint32_t ui32Position);                                             /*!< void type function. */
+    void HierarchicalBitVector_clearBit(hbitvector_t hbvBitVector, uint32_t ui32Position);                                           /*!< void type function. */
+    uint32_t HierarchicalBitVector_findNextSet(hbitvector_t hbvBitVector, uint32_t ui32StartPosition);                              /*!< 32-bits integer type function. */
+    uint32_t HierarchicalBitVector_findNextClear(hbitvector_t hbvBitVector, uint32_t ui32StartPosition);                            /*!< 32-bits integer type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
@@ -0,0 +1,127 @@
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__) && defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+
+  #include "./MPMC.h"
+  #include <string.h>
+
+  //! Private Function: MPMC Buffer Writer
+  /*!
+    Write a data on a multi-producer/multi-consumer buffer. A slot is free for the position p when its sequence is p; the producer claims the position with a compare-and-swap, copies the data and publishes the slot setting its sequence to p + 1. The high-water mark is kept off the path of each push: it's sampled with the distance to the read counter once per turn of the buffer (on the slot 0), and set to the buffer size when a push finds the buffer full.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the buffer is full.
+  */
+  bool __MPMCBuffer_push(buffer_t bfBuffer, void* vpData){
+    uint32_t* ui32pWriteCounter = &bfBuffer->biIndexes->ui32WriteCounter;
+    uint32_t ui32Mask = bfBuffer->ui8BufferSize - 1;
+    uint32_t ui32Position = __atomic_load_n(ui32pWriteCounter, __ATOMIC_RELAXED);
+    for (;;){
+      uint32_t ui32Slot = ui32Position & ui32Mask;
+      int32_t i32Difference = (int32_t) (__atomic_load_n(&bfBuffer->ui32pSequences[ui32Slot], __ATOMIC_ACQUIRE) + ui32Slot - ui32Position);
+      if (i32Difference == 0){
+        if (__atomic_compare_exchange_n(ui32pWriteCounter, &ui32Position, ui32Position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+          void* vpAdressBuffer = (char*) bfBuffer->vpVector + ui32Slot * bfBuffer->ui8ElementSize;
+          if (vpData != NULL){
+            memcpy(vpAdressBuffer, vpData, bfBuffer->ui8ElementSize);
+          }
+          else{
+            memset(vpAdressBuffer, 0, bfBuffer->ui8ElementSize);
+          }
+          __atomic_store_n(&bfBuffer->ui32pSequences[ui32Slot], ui32Position + 1 - ui32Slot, __ATOMIC_RELEASE);
+          if (ui32Slot == 0){
+            int32_t i32Pending = (int32_t) (ui32Position + 1 - __atomic_load_n(&bfBuffer->biIndexes->ui32ReadCounter, __ATOMIC_RELAXED));
+            if (i32Pending > 0){
+              __Buffer_updateHighWaterMark(bfBuffer, (i32Pending > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : (uint32_t) i32Pending);
+            }
+          }
+          return true;
+        }
+      }
+      else if (i32Difference < 0){
+        __Buffer_updateHighWaterMark(bfBuffer, bfBuffer->ui8BufferSize);
+        return false;
+      }
+      else{
+        ui32Position = __atomic_load_n(ui32pWriteCounter, __ATOMIC_RELAXED);
+      }
+    }
+  }
+
+  //! Private Function: MPMC Buffer Copy Reader
+  /*!
+    Copy a data of a multi-producer/multi-consumer buffer. A slot has data for the position p when its sequence is p + 1; the consumer claims the position, copies the data and gives the slot to the position p + size.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \return Returns false if the buffer is empty.
+  */
+  bool __MPMCBuffer_tryPop(buffer_t bfBuffer, void* vpData){
+    uint32_t* ui32pReadCounter = &bfBuffer->biIndexes->ui32ReadCounter;
+    uint32_t ui32Mask = bfBuffer->ui8BufferSize - 1;
+    uint32_t ui32Position = __atomic_load_n(ui32pReadCounter, __ATOMIC_RELAXED);
+    for (;;){
+      uint32_t ui32Slot = ui32Position & ui32Mask;
+      int32_t i32Difference = (int32_t) (__atomic_load_n(&bfBuffer->ui32pSequences[ui32Slot], __ATOMIC_ACQUIRE) + ui32Slot - (ui32Position + 1));
+      if (i32Difference == 0){
+        if (__atomic_compare_exchange_n(ui32pReadCounter, &ui32Position, ui32Position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+          memcpy(vpData, (char*) bfBuffer->vpVector + ui32Slot * bfBuffer->ui8ElementSize, bfBuffer->ui8ElementSize);
+          __atomic_store_n(&bfBuffer->ui32pSequences[ui32Slot], ui32Position + bfBuffer->ui8BufferSize - ui32Slot, __ATOMIC_RELEASE);
+          return true;
+        }
+      }
+      else if (i32Difference < 0){
+        return false;
+      }
+      else{
+        ui32Position = __atomic_load_n(ui32pReadCounter, __ATOMIC_RELAXED);
+      }
+    }
+  }
+
+  //! Private Function: MPMC Amount of Pending Data Getter
+  /*!
+    Get the amount of claimed positions to be read. While other threads are working, it's only an estimate.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns the amount of pending data.
+  */
+  uint8_t __MPMCBuffer_getAmountOfPendingData(buffer_t bfBuffer){
+    uint32_t ui32ReadCounter = __atomic_load_n(&bfBuffer->biIndexes->ui32ReadCounter, __ATOMIC_ACQUIRE);
+    int32_t i32Amount = (int32_t) (__atomic_load_n(&bfBuffer->biIndexes->ui32WriteCounter, __ATOMIC_ACQUIRE) - ui32ReadCounter);
+    if (i32Amount < 0){
+      return 0;
+    }
+    return (uint8_t) ((i32Amount > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : i32Amount);
+  }
+
+  //! Private Function: MPMC Write Position Getter
+  /*!
+    Get the write position of a multi-producer/multi-consumer buffer.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns write position.
+  */
+  uint8_t __MPMCBuffer_getWritePosition(buffer_t bfBuffer){
+    return (uint8_t) (__atomic_load_n(&bfBuffer->biIndexes->ui32WriteCounter, __ATOMIC_RELAXED) & (bfBuffer->ui8BufferSize - 1));
+  }
+
+  //! Private Function: MPMC Read Position Getter
+  /*!
+    Get the read position of a multi-producer/multi-consumer buffer.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns read position.
+  */
+  uint8_t __MPMCBuffer_getReadPosition(buffer_t bfBuffer){
+    return (uint8_t) (__atomic_load_n(&bfBuffer->biIndexes->ui32ReadCounter, __ATOMIC_RELAXED) & (bfBuffer->ui8BufferSize - 1));
+  }
+
+  //! Private Function: MPMC Buffer Cleaner
+  /*!
+    Clean a multi-producer/multi-consumer buffer. All producers and consumers must be stopped.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+  */
+  void __MPMCBuffer_clear(buffer_t bfBuffer){
+    memset(bfBuffer->ui32pSequences, 0, bfBuffer->ui8BufferSize * sizeof(uint32_t));
+    __atomic_store_n(&bfBuffer->biIndexes->ui32ReadCounter, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&bfBuffer->biIndexes->ui32WriteCounter, 0, __ATOMIC_RELEASE);
+  }
+
+#endif
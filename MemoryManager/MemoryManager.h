@@ -43,9 +43,21 @@
     MemoryManager system libraries.
   */
   #include "./BitVector.h"
+  #include "./AtomicBitVector.h"
+  #include "./HierarchicalBitVector.h"
+  #include "./RankSelect.h"
+  #include "./PackedVector.h"
+  #include "./BitMatrix.h"
+  #include "./BloomFilter.h"
   #include "./MemoryPool.h"
   #include "./DataBank.h"
+  #include "./RoaringBitmap.h"
+  #include "./Telemetry.h"
   #include "./Buffer.h"
+  #include "./BufferWait.h"
+  #include "./BufferWindow.h"
+  #include "./WideBuffer.h"
+  #include "./MirrorBuffer.h"
   #include "./TypedList.h"
   #include "./UntypedList.h"
 
@@ -12,36 +12,27 @@
     \return Returns memory allocation address or NULL if the allocation is unsuccessful.
   */
   void* MemoryPool_malloc(mpool_t mpMemoryPool, uint16_t ui16AllocationSize){
-    bool bFlagFragmentedSpace = false;
-    uint16_t ui16MemoryCounter = 0;
-    uint16_t ui16FreeDataBlockCounter = 0;
-    uint16_t ui16BitVectorWritePosition = 0;
-    if (mpMemoryPool->ui16PoolSize == 0 || mpMemoryPool->ui16FreeSpace < ui16AllocationSize){
+    uint32_t ui32AllocationPosition = 0;
+    uint32_t ui32Position = 0;
+    if (mpMemoryPool->ui16PoolSize == 0 || ui16AllocationSize == 0 || mpMemoryPool->ui16FreeSpace < ui16AllocationSize){
       return NULL;
     }
-    for (ui16MemoryCounter = mpMemoryPool->ui16WritePosition ; ui16FreeDataBlockCounter != ui16AllocationSize ; ui16MemoryCounter++){
-      if (ui16MemoryCounter == mpMemoryPool->ui16PoolSize){
-        return NULL;
-      }
-      if (BitVector_readBit(mpMemoryPool->bvInUse, ui16MemoryCounter) == 0){
-        ui16FreeDataBlockCounter++;
-      }
-      else{
-        bFlagFragmentedSpace = true;
-        ui16FreeDataBlockCounter = 0;
-      }
+    ui32AllocationPosition = BitVector_findClearRun(mpMemoryPool->bvInUse, mpMemoryPool->ui16PoolSize, mpMemoryPool->ui16WritePosition, ui16AllocationSize);
+    if (ui32AllocationPosition == BIT_VECTOR_NOT_FOUND){
+      return NULL;
     }
-    for (ui16BitVectorWritePosition = ui16MemoryCounter - ui16AllocationSize ; ui16BitVectorWritePosition < ui16MemoryCounter ; ui16BitVectorWritePosition++){
-      BitVector_setBit(mpMemoryPool->bvInUse, ui16BitVectorWritePosition);
+    ui32Position = ui32AllocationPosition + ui16AllocationSize;
+    BitVector_setRange(mpMemoryPool->bvInUse, ui32AllocationPosition, ui16AllocationSize);
+    BitVector_setBit(mpMemoryPool->bvAllocationEnd, ui32Position - 1);
+    if (ui32AllocationPosition == mpMemoryPool->ui16WritePosition){
+      ui32Position = BitVector_findNextClear(mpMemoryPool->bvInUse, mpMemoryPool->ui16PoolSize, ui32Position);
+      mpMemoryPool->ui16WritePosition = (ui32Position == BIT_VECTOR_NOT_FOUND) ? mpMemoryPool->ui16PoolSize : (uint16_t) ui32Position;
     }
-    if (bFlagFragmentedSpace == false){
-      while(BitVector_readBit(mpMemoryPool->bvInUse, ui16MemoryCounter) == 1){
-        ui16MemoryCounter++;
-      }
-      mpMemoryPool->ui16WritePosition = ui16MemoryCounter;
+    mpMemoryPool->ui16FreeSpace = mpMemoryPool->ui16FreeSpace - ui16AllocationSize;
+    if (mpMemoryPool->ui16HighWaterMark < (mpMemoryPool->ui16PoolSize - mpMemoryPool->ui16FreeSpace)){
+      mpMemoryPool->ui16HighWaterMark = mpMemoryPool->ui16PoolSize - mpMemoryPool->ui16FreeSpace;
     }
-    mpMemoryPool->ui16FreeSpace = mpMemoryPool->ui16FreeSpace - ui16FreeDataBlockCounter;
-    return (void*) &mpMemoryPool->ui8pDataMemory[(ui16BitVectorWritePosition - ui16AllocationSize) * mpMemoryPool->ui8ElementSize];
+    return (void*) &mpMemoryPool->ui8pDataMemory[ui32AllocationPosition * mpMemoryPool->ui8ElementSize];
   }
 
   //! Function: Memory Pool Allocation
@@ -108,9 +99,10 @@
     uint16_t ui16StartAllocationPosition = SoftMath_module(((uint8_t*) *vppAllocatedPointer - mpMemoryPool->ui8pDataMemory)/mpMemoryPool->ui8ElementSize);
     uint16_t ui16EndAllocationPosition = ui16StartAllocationPosition + ui16AllocationSize - 1;
     if (*vppAllocatedPointer != NULL && (uint8_t*) *vppAllocatedPointer >= ui8pStartAllocationPointer && (uint8_t*) *vppAllocatedPointer <= ui8pEndAllocationPointer && ui16StartAllocationPosition <= mpMemoryPool->ui16PoolSize && ui16EndAllocationPosition <= mpMemoryPool->ui16PoolSize){
-      uint16_t ui16Position = 0;
-      for (ui16Position = ui16StartAllocationPosition ; ui16Position <= ui16EndAllocationPosition ; ui16Position++){
-        BitVector_clearBit(mpMemoryPool->bvInUse, ui16Position);
+      BitVector_clearRange(mpMemoryPool->bvInUse, ui16StartAllocationPosition, ui16AllocationSize);
+      BitVector_clearRange(mpMemoryPool->bvAllocationEnd, ui16StartAllocationPosition, ui16AllocationSize);
+      if (ui16StartAllocationPosition > 0 && BitVector_readBit(mpMemoryPool->bvInUse, ui16StartAllocationPosition - 1) == 1){
+        BitVector_setBit(mpMemoryPool->bvAllocationEnd, ui16StartAllocationPosition - 1);
       }
       if (mpMemoryPool->ui16WritePosition > ui16StartAllocationPosition){
         mpMemoryPool->ui16WritePosition = ui16StartAllocationPosition;
@@ -120,6 +112,28 @@
     }
   }
 
+  //! Function: Memory Pool Deallocation
+  /*!
+    Deallocates a whole allocation in Memory Pool. The allocation size is found by the allocation end marks, so it's not needed.
+    \param mpMemoryPool is a mpool_t type. It's the memory space where the control memory pool variables will be.
+    \param vppAllocatedPointer is a void pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL.
+  */
+  void (MemoryPool_freePtr)(mpool_t mpMemoryPool, void** vppAllocatedPointer){
+    if (*vppAllocatedPointer == NULL || !MemoryPool_checkOwnership(mpMemoryPool, *vppAllocatedPointer)){
+      return;
+    }
+    uint16_t ui16StartAllocationPosition = ((uint8_t*) *vppAllocatedPointer - mpMemoryPool->ui8pDataMemory)/mpMemoryPool->ui8ElementSize;
+    uint32_t ui32EndAllocationPosition = 0;
+    if (BitVector_readBit(mpMemoryPool->bvInUse, ui16StartAllocationPosition) == 0){
+      return;
+    }
+    ui32EndAllocationPosition = BitVector_findNextSet(mpMemoryPool->bvAllocationEnd, mpMemoryPool->ui16PoolSize, ui16StartAllocationPosition);
+    if (ui32EndAllocationPosition == BIT_VECTOR_NOT_FOUND){
+      ui32EndAllocationPosition = mpMemoryPool->ui16PoolSize - 1;
+    }
+    MemoryPool_free(mpMemoryPool, vppAllocatedPointer, ui32EndAllocationPosition - ui16StartAllocationPosition + 1);
+  }
+
   //! Function: Memory Pool Fragmented Free Space Checker
   /*!
     Checks memory pool maximum free space for allocation.
@@ -127,26 +141,46 @@
     \return Returns memory pool maximum free space for allocation.
   */
   uint16_t MemoryPool_getMaxFreeSpace(mpool_t mpMemoryPool){
-    uint8_t ui8PreviousMemoryState = 0;
-    uint8_t ui8CurrentMemoryState = 0;
-    uint16_t ui16FragmentedFreeSpace = 0;
+    uint32_t ui32RunLength = 0;
     uint16_t ui16MaxFragmentedFreeSpace = 0;
-    uint16_t ui16Counter = 0;
     if (MemoryPool_checkFragmentation(mpMemoryPool) == MEMORY_POOL_STATUS_UNFRAGMENTED_MEMORY){
       return mpMemoryPool->ui16FreeSpace;
     }
-    for(ui16Counter = 0 ; ui16Counter < mpMemoryPool->ui16PoolSize ; ui16Counter++){
-      ui8PreviousMemoryState = ui8CurrentMemoryState;
-      ui8CurrentMemoryState = BitVector_readBit(mpMemoryPool->bvInUse, ui16Counter);
-      if (ui8CurrentMemoryState == 0){
-        ui16FragmentedFreeSpace++;
-      }
-      if ((ui8PreviousMemoryState == 0 && ui8CurrentMemoryState == 1) || (ui16Counter == (mpMemoryPool->ui16PoolSize - 1))){
-        ui16MaxFragmentedFreeSpace = SoftMath_bigger(ui16FragmentedFreeSpace, ui16MaxFragmentedFreeSpace);
-        ui16FragmentedFreeSpace = 0;
-      }
+    newBitVectorClearIterator(bviFreeBlocks, mpMemoryPool->bvInUse, mpMemoryPool->ui16PoolSize);
+    while (BitVector_nextRun(bviFreeBlocks, &ui32RunLength) != BIT_VECTOR_NOT_FOUND){
+      ui16MaxFragmentedFreeSpace = SoftMath_bigger((uint16_t) ui32RunLength, ui16MaxFragmentedFreeSpace);
     }
     return ui16MaxFragmentedFreeSpace;
   }
 
+  //! Function: Memory Pool Constructor
+  /*!
+    Constructs a memory pool on a external memory block (a static array or a mmap'd region, for example). The block must be aligned to 8 bytes and must have at least MemoryPool_getRequiredMemory(ui8ElementSize, ui16PoolSize) bytes.
+    \param vpMemory is a void pointer. It's the memory block where the control variables, the data and the bit vectors of the memory pool will be.
+    \param ui8ElementSize is a unsigned 8-bit integer. It's type data size of your memory pool.
+    \param ui16PoolSize is a unsigned 16-bit integer. It's the amount of blocks that will be in your memory pool.
+    \return Returns the memory pool or NULL if the parameters are invalid.
+  */
+  mpool_t MemoryPool_create(void* vpMemory, uint8_t ui8ElementSize, uint16_t ui16PoolSize){
+    if (vpMemory == NULL || ui8ElementSize == 0 || ui16PoolSize == 0){
+      return NULL;
+    }
+    uint8_t* ui8pDataMemory = (uint8_t*) vpMemory + MemoryPool_alignSize(sizeof(mpool_structure_t));
+    bitvector_t* bvInUse = (bitvector_t*) (ui8pDataMemory + MemoryPool_alignSize((size_t) ui16PoolSize * ui8ElementSize));
+    bitvector_t* bvAllocationEnd = bvInUse + BitVector_getSize(ui16PoolSize);
+    mpool_structure_t mpsMemoryPoolStructure = {
+      .ui8pDataMemory = ui8pDataMemory,
+      .bvInUse = bvInUse,
+      .bvAllocationEnd = bvAllocationEnd,
+      .ui16PoolSize = ui16PoolSize,
+      .ui16WritePosition = 0,
+      .ui16FreeSpace = ui16PoolSize,
+      .ui16HighWaterMark = 0,
+      .ui8ElementSize = ui8ElementSize
+    };
+    memset(bvInUse, 0, 2 * BitVector_getSize(ui16PoolSize));
+    memcpy(vpMemory, &mpsMemoryPoolStructure, sizeof(mpool_structure_t));
+    return (mpool_t) vpMemory;
+  }
+
 #endif
\ No newline at end of file
@@ -55,9 +55,11 @@
     typedef struct{
       uint8_t* const ui8pDataMemory;              /*!< uint8_t* const type variable. */
       bitvector_t* bvInUse;                       /*!< bitvector_t type variable. */
+      bitvector_t* bvAllocationEnd;               /*!< bitvector_t type variable. */
       const uint16_t ui16PoolSize;                /*!< const uint16_t integer type variable. */
       uint16_t ui16WritePosition;                 /*!< uint16_t type variable. */
       uint16_t ui16FreeSpace;                     /*!< uint16_t type variable. */
+      uint16_t ui16HighWaterMark;                 /*!< uint16_t type variable. */
       const uint8_t ui8ElementSize;               /*!< const uint8_t integer type variable. */
     } mpool_structure_t;
 
@@ -89,12 +91,15 @@
     #define newMemoryPool(mpName, ui16DataSize, ui16MemoryPoolSize)\
       uint8_t __ui8p##mpName[((ui16MemoryPoolSize) * (ui16DataSize))];\
       newBitVector(__bv##mpName, (ui16MemoryPoolSize));\
+      newBitVector(__bve##mpName, (ui16MemoryPoolSize));\
       mpool_structure_t __mpsMemoryPoolStructure##mpName = {\
         .ui8pDataMemory = __ui8p##mpName,\
         .bvInUse = __bv##mpName,\
+        .bvAllocationEnd = __bve##mpName,\
         .ui16PoolSize = ui16MemoryPoolSize,\
         .ui16WritePosition = 0,\
         .ui16FreeSpace = ui16MemoryPoolSize,\
+        .ui16HighWaterMark = 0,\
         .ui8ElementSize = ui16DataSize\
       };\
       mpool_t mpName = &__mpsMemoryPoolStructure##mpName
@@ -110,16 +115,38 @@
     #define newStaticMemoryPool(mpName, ui16DataSize, ui16MemoryPoolSize)\
       static uint8_t __ui8p##mpName[((ui16MemoryPoolSize) * (ui16DataSize))];\
       newStaticBitVector(__bv##mpName, (ui16MemoryPoolSize));\
+      newStaticBitVector(__bve##mpName, (ui16MemoryPoolSize));\
       static mpool_structure_t __mpsMemoryPoolStructure##mpName = {\
         .ui8pDataMemory = __ui8p##mpName,\
         .bvInUse = __bv##mpName,\
+        .bvAllocationEnd = __bve##mpName,\
         .ui16PoolSize = ui16MemoryPoolSize,\
         .ui16WritePosition = 0,\
         .ui16FreeSpace = ui16MemoryPoolSize,\
+        .ui16HighWaterMark = 0,\
         .ui8ElementSize = ui16DataSize\
       };\
       static mpool_t mpName = &__mpsMemoryPoolStructure##mpName
 
+    //! Macro: Memory Pool Required Memory
+    /*!
+      Calculates the amount of bytes that MemoryPool_create needs to build a memory pool on a external memory block.
+      \param ui8DataSize is a 8-bit integer. It's type data size of your memory pool.
+      \param ui16MemoryPoolSize is a 16-bit integer. It's the amount of blocks that will be in your memory pool.
+      \return Returns the amount of bytes of memory block.
+    */
+    #define MemoryPool_getRequiredMemory(ui8DataSize, ui16MemoryPoolSize)\
+      (MemoryPool_alignSize(sizeof(mpool_structure_t)) + MemoryPool_alignSize((size_t) (ui16MemoryPoolSize) * (ui8DataSize)) + 2 * BitVector_getSize(ui16MemoryPoolSize))
+
+    //! Macro: Memory Pool Alignment
+    /*!
+      Rounds a size up to the alignment used by MemoryPool_create.
+      \param xSize is a unsigned integer. It's the size to be aligned.
+      \return Returns the aligned size.
+    */
+    #define MemoryPool_alignSize(xSize)\
+      (((xSize) + (sizeof(uint64_t) - 1)) & ~((size_t) (sizeof(uint64_t) - 1)))
+
     //! Macro: Memory Pool Reallocation
     /*!
       Deallocates memory space in Memory Pool.
@@ -142,6 +169,25 @@
     #define MemoryPool_free(mpMemoryPool, vpAllocatedPointer, ui16AllocationSize)\
       MemoryPool_free(mpMemoryPool, (void**) vpAllocatedPointer, ui16AllocationSize)
 
+    //! Macro: Memory Pool Deallocation
+    /*!
+      Deallocates a whole allocation in Memory Pool. The allocation size is not needed.
+      \param mpMemoryPool is a mpool_t type. It's the memory space where the control memory pool variables will be.
+      \param vpAllocatedPointer is a void pointer parameter. It's the address of the pointer of the allocation. On case deallocation successfully, this function going to set this pointer to NULL.
+    */
+    #define MemoryPool_freePtr(mpMemoryPool, vpAllocatedPointer)\
+      MemoryPool_freePtr(mpMemoryPool, (void**) vpAllocatedPointer)
+
+    //! Macro: Memory Pool Ownership Checker
+    /*!
+      Checks if an address is inside the data memory of a memory pool.
+      \param mpMemoryPool is a mpool_t type. It's the memory space where the control memory pool variables will be.
+      \param vpAddress is a void pointer. It's the address to be checked.
+      \return Returns true if the address belongs to the memory pool.
+    */
+    #define MemoryPool_checkOwnership(mpMemoryPool, vpAddress)\
+      (((uint8_t*) (vpAddress) >= (mpMemoryPool)->ui8pDataMemory) && ((uint8_t*) (vpAddress) < ((mpMemoryPool)->ui8pDataMemory + ((size_t) (mpMemoryPool)->ui16PoolSize * (mpMemoryPool)->ui8ElementSize))))
+
     //! Getter Macro: Memory Pool Size
     /*!
       Gets memory pool size.
@@ -160,6 +206,15 @@
     #define MemoryPool_getFreeSpace(mpMemoryPool)\
       mpMemoryPool->ui16FreeSpace
 
+    //! Getter Macro: High Water Mark
+    /*!
+      Gets the maximum amount of blocks that were allocated at the same time in the memory pool.
+      \param mpMemoryPool is a mpool_t type. It's the memory space where the control memory pool variables will be.
+      \return Returns high water mark of memory pool.
+    */
+    #define MemoryPool_getHighWaterMark(mpMemoryPool)\
+      mpMemoryPool->ui16HighWaterMark
+
     //! Getter Macro: Element Size
     /*!
       Gets memory pool element size.
@@ -172,9 +227,11 @@
     void* MemoryPool_malloc(mpool_t mpMemoryPool, uint16_t ui16AllocationSize);                                                                               /*!< void pointer type function. */
     void* MemoryPool_calloc(mpool_t mpMemoryPool, uint16_t ui16AllocationSize);                                                                               /*!< void pointer type function. */
     void (MemoryPool_free)(mpool_t mpMemoryPool, void** vpAllocatedPointer, uint16_t ui16AllocationSize);                                                     /*!< void type function. */
+    void (MemoryPool_freePtr)(mpool_t mpMemoryPool, void** vpAllocatedPointer);                                                                               /*!< void type function. */
     uint16_t MemoryPool_getMaxFreeSpace(mpool_t mpMemoryPool);                                                                                                /*!< uint16_t type function. */
     mpool_status_t (MemoryPool_realloc)(mpool_t mpMemoryPool, void** vpAllocatedPointer, uint16_t ui16OldAllocationSize, uint16_t ui16NewAllocationSize);     /*!< mpool_status_t type function. */
     mpool_status_t MemoryPool_checkFragmentation(mpool_t mpMemoryPool);                                                                                       /*!< mpool_status_t type function. */
+    mpool_t MemoryPool_create(void* vpMemory, uint8_t ui8ElementSize, uint16_t ui16PoolSize);                                                                 /*!< mpool_t type function. */
 
     #ifdef __cplusplus
       }
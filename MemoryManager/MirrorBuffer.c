@@ -0,0 +1,212 @@
+#ifndef _GNU_SOURCE
+  #define _GNU_SOURCE                                                                                                               /*!< memfd_create. */
+#endif
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__) && defined(__linux__)
+
+  #include "./MirrorBuffer.h"
+  #include <string.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+
+  //! Private Function: Memory File Creator
+  /*!
+    Create an anonymous memory file. Old C libraries don't have memfd_create, so the system call is used directly.
+    \return Returns the file descriptor or -1.
+  */
+  static int __MirrorBuffer_createFile(void){
+    #if defined(SYS_memfd_create)
+      return (int) syscall(SYS_memfd_create, "MemoryManager", 1U);                                                                  /*!< MFD_CLOEXEC. */
+    #else
+      return -1;
+    #endif
+  }
+
+  //! Function: Mirror Buffer Mapper
+  /*!
+    Map the memory of a mirror buffer: a memory file is mapped on two consecutive halves of a reserved address range. The buffer starts empty.
+    \param mbBuffer is a mirrorbuffer_t type. It's an unmapped mirror buffer.
+    \param ui32Size is a 32-bits integer. It's the minimum size in bytes; it's rounded up to the page size.
+    \return Returns true if the memory was mapped or false if it can't be mapped or the mirror buffer is already mapped (call MirrorBuffer_destroy first).
+  */
+  bool MirrorBuffer_create(mirrorbuffer_t mbBuffer, uint32_t ui32Size){
+    long lPageSize = sysconf(_SC_PAGESIZE);
+    if (mbBuffer->ui8pData != NULL || lPageSize <= 0 || ui32Size == 0){
+      return false;
+    }
+    size_t szSize = (((size_t) ui32Size + (size_t) lPageSize - 1) / (size_t) lPageSize) * (size_t) lPageSize;
+    if (szSize > UINT32_MAX){
+      return false;
+    }
+    int iFile = __MirrorBuffer_createFile();
+    if (iFile < 0){
+      return false;
+    }
+    if (ftruncate(iFile, (off_t) szSize) != 0){
+      close(iFile);
+      return false;
+    }
+    uint8_t* ui8pData = (uint8_t*) mmap(NULL, 2 * szSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ui8pData == MAP_FAILED){
+      close(iFile);
+      return false;
+    }
+    if (mmap(ui8pData, szSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFile, 0) == MAP_FAILED || mmap(ui8pData + szSize, szSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFile, 0) == MAP_FAILED){
+      munmap(ui8pData, 2 * szSize);
+      close(iFile);
+      return false;
+    }
+    close(iFile);                                                                                                                   /*!< The mappings keep the memory file. */
+    mbBuffer->ui8pData = ui8pData;
+    mbBuffer->ui32Size = (uint32_t) szSize;
+    MirrorBuffer_clear(mbBuffer);
+    return true;
+  }
+
+  //! Function: Mirror Buffer Unmapper
+  /*!
+    Unmap the memory of a mirror buffer.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+  */
+  void MirrorBuffer_destroy(mirrorbuffer_t mbBuffer){
+    if (mbBuffer->ui8pData != NULL){
+      munmap(mbBuffer->ui8pData, 2 * (size_t) mbBuffer->ui32Size);
+    }
+    mbBuffer->ui8pData = NULL;
+    mbBuffer->ui32Size = 0;
+  }
+
+  //! Function: Mirror Buffer Cleaner
+  /*!
+    Clean a mirror buffer. The producer and the consumer must be stopped.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+  */
+  void MirrorBuffer_clear(mirrorbuffer_t mbBuffer){
+    __atomic_store_n(&mbBuffer->ui64ReadCounter, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&mbBuffer->ui64WriteCounter, 0, __ATOMIC_RELEASE);
+  }
+
+  //! Function: Amount of Pending Data Getter
+  /*!
+    Get the amount of bytes to be read.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \return Returns the amount of bytes.
+  */
+  uint32_t MirrorBuffer_getAmountOfPendingData(mirrorbuffer_t mbBuffer){
+    uint64_t ui64ReadCounter = __atomic_load_n(&mbBuffer->ui64ReadCounter, __ATOMIC_ACQUIRE);
+    return (uint32_t) (__atomic_load_n(&mbBuffer->ui64WriteCounter, __ATOMIC_ACQUIRE) - ui64ReadCounter);
+  }
+
+  //! Function: Free Space Getter
+  /*!
+    Get the amount of bytes that can be written.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \return Returns the amount of bytes.
+  */
+  uint32_t MirrorBuffer_getFreeSpace(mirrorbuffer_t mbBuffer){
+    uint64_t ui64WriteCounter = __atomic_load_n(&mbBuffer->ui64WriteCounter, __ATOMIC_RELAXED);
+    return mbBuffer->ui32Size - (uint32_t) (ui64WriteCounter - __atomic_load_n(&mbBuffer->ui64ReadCounter, __ATOMIC_ACQUIRE));
+  }
+
+  //! Function: Mirror Buffer Space Reserver
+  /*!
+    Get the free space after the written data as one contiguous block. Only the producer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param ui32pAmountOfBytes is a 32-bits integer pointer. It's the desirable amount of bytes and receives the amount of bytes reserved.
+    \return Returns the address of the block or NULL if the buffer is full.
+  */
+  void* MirrorBuffer_reserve(mirrorbuffer_t mbBuffer, uint32_t* ui32pAmountOfBytes){
+    uint32_t ui32FreeSpace = MirrorBuffer_getFreeSpace(mbBuffer);
+    if (*ui32pAmountOfBytes > ui32FreeSpace){
+      *ui32pAmountOfBytes = ui32FreeSpace;
+    }
+    if (*ui32pAmountOfBytes == 0){
+      return NULL;
+    }
+    return mbBuffer->ui8pData + (mbBuffer->ui64WriteCounter % mbBuffer->ui32Size);
+  }
+
+  //! Function: Mirror Buffer Space Committer
+  /*!
+    Publish the first bytes reserved by MirrorBuffer_reserve to the consumer. Only the producer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param ui32AmountOfBytes is a 32-bits integer. It's the amount of bytes written, up to the amount reserved.
+  */
+  void MirrorBuffer_commit(mirrorbuffer_t mbBuffer, uint32_t ui32AmountOfBytes){
+    uint32_t ui32FreeSpace = MirrorBuffer_getFreeSpace(mbBuffer);
+    if (ui32AmountOfBytes > ui32FreeSpace){
+      ui32AmountOfBytes = ui32FreeSpace;
+    }
+    __atomic_store_n(&mbBuffer->ui64WriteCounter, mbBuffer->ui64WriteCounter + ui32AmountOfBytes, __ATOMIC_RELEASE);
+  }
+
+  //! Function: Mirror Buffer Data Peeker
+  /*!
+    Get all the pending data as one contiguous block, without removing it. Only the consumer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param ui32pAmountOfBytes is a 32-bits integer pointer. It receives the amount of pending bytes.
+    \return Returns the address of the oldest byte or NULL if the buffer is empty.
+  */
+  void* MirrorBuffer_peek(mirrorbuffer_t mbBuffer, uint32_t* ui32pAmountOfBytes){
+    *ui32pAmountOfBytes = MirrorBuffer_getAmountOfPendingData(mbBuffer);
+    if (*ui32pAmountOfBytes == 0){
+      return NULL;
+    }
+    return mbBuffer->ui8pData + (mbBuffer->ui64ReadCounter % mbBuffer->ui32Size);
+  }
+
+  //! Function: Mirror Buffer Data Consumer
+  /*!
+    Remove the oldest bytes and give their space to the producer. Only the consumer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param ui32AmountOfBytes is a 32-bits integer. It's the amount of bytes, up to the amount of pending bytes.
+  */
+  void MirrorBuffer_consume(mirrorbuffer_t mbBuffer, uint32_t ui32AmountOfBytes){
+    uint32_t ui32Pending = MirrorBuffer_getAmountOfPendingData(mbBuffer);
+    if (ui32AmountOfBytes > ui32Pending){
+      ui32AmountOfBytes = ui32Pending;
+    }
+    __atomic_store_n(&mbBuffer->ui64ReadCounter, mbBuffer->ui64ReadCounter + ui32AmountOfBytes, __ATOMIC_RELEASE);
+  }
+
+  //! Function: Mirror Buffer Writer
+  /*!
+    Copy bytes to a mirror buffer with one memcpy. Only the producer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param vpData is a const void pointer. It's the data.
+    \param ui32AmountOfBytes is a 32-bits integer. It's the amount of bytes.
+    \return Returns the amount of bytes written (less than requested if the buffer gets full).
+  */
+  uint32_t MirrorBuffer_write(mirrorbuffer_t mbBuffer, const void* vpData, uint32_t ui32AmountOfBytes){
+    void* vpBlock = MirrorBuffer_reserve(mbBuffer, &ui32AmountOfBytes);
+    if (vpBlock != NULL){
+      memcpy(vpBlock, vpData, ui32AmountOfBytes);
+      MirrorBuffer_commit(mbBuffer, ui32AmountOfBytes);
+    }
+    return ui32AmountOfBytes;
+  }
+
+  //! Function: Mirror Buffer Reader
+  /*!
+    Copy and remove bytes of a mirror buffer with one memcpy. Only the consumer can call it.
+    \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfBytes is a 32-bits integer. It's the maximum amount of bytes.
+    \return Returns the amount of bytes read.
+  */
+  uint32_t MirrorBuffer_read(mirrorbuffer_t mbBuffer, void* vpData, uint32_t ui32AmountOfBytes){
+    uint32_t ui32Pending = 0;
+    void* vpBlock = MirrorBuffer_peek(mbBuffer, &ui32Pending);
+    if (ui32AmountOfBytes > ui32Pending){
+      ui32AmountOfBytes = ui32Pending;
+    }
+    if (vpBlock != NULL){
+      memcpy(vpData, vpBlock, ui32AmountOfBytes);
+      MirrorBuffer_consume(mbBuffer, ui32AmountOfBytes);
+    }
+    return ui32AmountOfBytes;
+  }
+
+#endif
@@ -0,0 +1,112 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __MIRROR_BUFFER_HEADER__
+  #define __MIRROR_BUFFER_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BUFFER_MANAGER_ENABLE__) && defined(__linux__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include <EmbeddedTools.h>
+    #include "./Buffer.h"
+
+    //! Type Definition: Mirror Buffer Structure
+    /*!
+      Byte ring buffer whose memory is mapped twice, back-to-back (Linux memfd_create and mmap): the byte after the end of the ring is its first byte again. So any free space or pending data, up to the size of the ring, is a contiguous block of memory, and can be used straight by parsers, memcpy, read() or write(). The counters run freely on 64 bits; the producer only writes the write counter and the consumer only the read counter, so one producer thread and one consumer thread can share it without locks.
+    */
+    typedef struct {
+      uint8_t* ui8pData;                                                                                                            /*!< 8-bits integer pointer type. */
+      uint32_t ui32Size;                                                                                                            /*!< 32-bits integer type. */
+      __BUFFER_ALIGNED__ uint64_t ui64WriteCounter;                                                                                 /*!< 64-bits integer type. */
+      __BUFFER_ALIGNED__ uint64_t ui64ReadCounter;                                                                                  /*!< 64-bits integer type. */
+    } mirrorbuffer_structure_t;
+
+    //! Type Definition: Mirror Buffer Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef mirrorbuffer_structure_t* mirrorbuffer_t;
+
+    //! Macro: Mirror Buffer Creator
+    /*!
+      Create an unmapped mirror buffer. Map it with MirrorBuffer_create.
+      \param mbBufferName is a buffer name.
+    */
+    #define newMirrorBuffer(mbBufferName)\
+      mirrorbuffer_structure_t __mbsMirrorBuffer##mbBufferName = {0};\
+      mirrorbuffer_t mbBufferName = &(__mbsMirrorBuffer##mbBufferName);\
+
+    //! Macro: Static Mirror Buffer Creator
+    /*!
+      Create a static unmapped mirror buffer. Map it with MirrorBuffer_create.
+      \param mbBufferName is a buffer name.
+    */
+    #define newStaticMirrorBuffer(mbBufferName)\
+      static mirrorbuffer_structure_t __mbsMirrorBuffer##mbBufferName = {0};\
+      static mirrorbuffer_t mbBufferName = &__mbsMirrorBuffer##mbBufferName;
+
+    //! Macro: Mirror Buffer Size Getter
+    /*!
+      Get the size of a mapped mirror buffer (the requested size rounded up to the page size).
+      \param mbBuffer is a mirrorbuffer_t type. It's the mirror buffer.
+      \return Returns the size in bytes.
+    */
+    #define MirrorBuffer_getSize(mbBuffer)\
+      ((mbBuffer)->ui32Size)
+
+    bool MirrorBuffer_create(mirrorbuffer_t mbBuffer, uint32_t ui32Size);                                                           /*!< bool type function. */
+    void MirrorBuffer_destroy(mirrorbuffer_t mbBuffer);                                                                             /*!< void type function. */
+    void MirrorBuffer_clear(mirrorbuffer_t mbBuffer);                                                                               /*!< void type function. */
+    void* MirrorBuffer_reserve(mirrorbuffer_t mbBuffer, uint32_t* ui32pAmountOfBytes);                                              /*!< void pointer type function. */
+    void MirrorBuffer_commit(mirrorbuffer_t mbBuffer, uint32_t ui32AmountOfBytes);                                                  /*!< void type function. */
+    void* MirrorBuffer_peek(mirrorbuffer_t mbBuffer, uint32_t* ui32pAmountOfBytes);                                                 /*!< void pointer type function. */
+    void MirrorBuffer_consume(mirrorbuffer_t mbBuffer, uint32_t ui32AmountOfBytes);                                                 /*!< void type function. */
+    uint32_t MirrorBuffer_write(mirrorbuffer_t mbBuffer, const void* vpData, uint32_t ui32AmountOfBytes);                           /*!< 32-bits integer type. */
+    uint32_t MirrorBuffer_read(mirrorbuffer_t mbBuffer, void* vpData, uint32_t ui32AmountOfBytes);                                  /*!< 32-bits integer type. */
+    uint32_t MirrorBuffer_getAmountOfPendingData(mirrorbuffer_t mbBuffer);                                                          /*!< 32-bits integer type. */
+    uint32_t MirrorBuffer_getFreeSpace(mirrorbuffer_t mbBuffer);                                                                    /*!< 32-bits integer type. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
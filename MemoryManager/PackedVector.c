@@ -0,0 +1,243 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./PackedVector.h"
+  #include <string.h>
+
+  #if defined(__BIT_VECTOR_SIMD_ENABLE__) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define __PACKED_VECTOR_X86_SIMD__
+    #include <immintrin.h>
+  #endif
+
+  //! Type Definition: Unpack Kernel
+  /*!
+    A kernel unpacks the first values of a range and returns the amount of unpacked values.
+  */
+  typedef uint32_t (*packedvector_unpack_kernel_t)(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, uint32_t* ui32pValues);
+
+  //! Private Function: Packed Vector 64-bit Loader
+  /*!
+    Loads 64 bits of the packed vector data, starting at a byte. The padding of the data makes the load always valid.
+    \param bvData is a bitvector_t pointer. It's the data.
+    \param ui64BytePosition is a unsigned 64-bit integer. It's the first byte.
+    \return Returns the bits (the first byte is the least significant one).
+  */
+  static inline uint64_t __PackedVector_load(const bitvector_t* bvData, uint64_t ui64BytePosition){
+    uint64_t ui64Bits = 0;
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      memcpy(&ui64Bits, &bvData[ui64BytePosition], sizeof(uint64_t));
+    #else
+      uint8_t ui8Counter = 0;
+      for (ui8Counter = 0 ; ui8Counter < sizeof(uint64_t) ; ui8Counter++){
+        ui64Bits = ui64Bits | ((uint64_t) bvData[ui64BytePosition + ui8Counter] << (ui8Counter << 3));
+      }
+    #endif
+    return ui64Bits;
+  }
+
+  //! Private Function: Packed Vector 64-bit Storer
+  /*!
+    Stores 64 bits on the packed vector data, starting at a byte.
+    \param bvData is a bitvector_t pointer. It's the data.
+    \param ui64BytePosition is a unsigned 64-bit integer. It's the first byte.
+    \param ui64Bits is a unsigned 64-bit integer. It's the bits (the first byte is the least significant one).
+  */
+  static inline void __PackedVector_store(bitvector_t* bvData, uint64_t ui64BytePosition, uint64_t ui64Bits){
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      memcpy(&bvData[ui64BytePosition], &ui64Bits, sizeof(uint64_t));
+    #else
+      uint8_t ui8Counter = 0;
+      for (ui8Counter = 0 ; ui8Counter < sizeof(uint64_t) ; ui8Counter++){
+        bvData[ui64BytePosition + ui8Counter] = (bitvector_t) (ui64Bits >> (ui8Counter << 3));
+      }
+    #endif
+  }
+
+  //! Private Function: Scalar Unpack Kernel
+  /*!
+    Unpacks the values one at a time, with one 64-bit load each.
+  */
+  static uint32_t __PackedVector_unpackScalar(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, uint32_t* ui32pValues){
+    uint64_t ui64BitPosition = (uint64_t) ui32StartIndex * pvVector->ui8BitWidth;
+    uint64_t ui64Mask = (uint64_t) PackedVector_getMaxValue(pvVector);
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < ui32AmountOfValues ; ui32Counter++){
+      ui32pValues[ui32Counter] = (uint32_t) ((__PackedVector_load(pvVector->bvData, ui64BitPosition >> 3) >> (ui64BitPosition & 7)) & ui64Mask);
+      ui64BitPosition = ui64BitPosition + pvVector->ui8BitWidth;
+    }
+    return ui32AmountOfValues;
+  }
+
+  #if defined(__PACKED_VECTOR_X86_SIMD__)
+
+    //! Private Function: AVX2 Unpack Kernel
+    /*!
+      Unpacks 8 values at a time with gathers. 8 values take ui8BitWidth bytes, so the offsets of the values inside each group are always the same. Widths up to 25 bits fit in a 32-bit gather; wider values use two 64-bit gathers.
+    */
+    __attribute__((target("avx2"))) static uint32_t __PackedVector_unpackAVX2(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, uint32_t* ui32pValues){
+      uint64_t ui64BitPosition = (uint64_t) ui32StartIndex * pvVector->ui8BitWidth;
+      const bitvector_t* bvGroup = &pvVector->bvData[ui64BitPosition >> 3];
+      uint32_t ui32FirstBit = (uint32_t) (ui64BitPosition & 7);
+      uint32_t ui32Width = pvVector->ui8BitWidth;
+      uint32_t ui32Counter = 0;
+      __m256i m256Bits = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      m256Bits = _mm256_add_epi32(_mm256_mullo_epi32(m256Bits, _mm256_set1_epi32((int) ui32Width)), _mm256_set1_epi32((int) ui32FirstBit));
+      __m256i m256Offsets = _mm256_srli_epi32(m256Bits, 3);
+      __m256i m256Shifts = _mm256_and_si256(m256Bits, _mm256_set1_epi32(7));
+      if (ui32Width <= 25){
+        __m256i m256Mask = _mm256_set1_epi32((int) PackedVector_getMaxValue(pvVector));
+        for (ui32Counter = 0 ; ui32Counter + 8 <= ui32AmountOfValues ; ui32Counter = ui32Counter + 8){
+          __m256i m256Values = _mm256_i32gather_epi32((const int*) bvGroup, m256Offsets, 1);
+          m256Values = _mm256_and_si256(_mm256_srlv_epi32(m256Values, m256Shifts), m256Mask);
+          _mm256_storeu_si256((__m256i*) &ui32pValues[ui32Counter], m256Values);
+          bvGroup = bvGroup + ui32Width;
+        }
+      }
+      else{
+        __m256i m256Mask = _mm256_set1_epi64x((long long) PackedVector_getMaxValue(pvVector));
+        __m256i m256Even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        __m128i m128OffsetsLow = _mm256_castsi256_si128(m256Offsets);
+        __m128i m128OffsetsHigh = _mm256_extracti128_si256(m256Offsets, 1);
+        __m256i m256ShiftsLow = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(m256Shifts));
+        __m256i m256ShiftsHigh = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(m256Shifts, 1));
+        for (ui32Counter = 0 ; ui32Counter + 8 <= ui32AmountOfValues ; ui32Counter = ui32Counter + 8){
+          __m256i m256Low = _mm256_i32gather_epi64((const long long*) bvGroup, m128OffsetsLow, 1);
+          __m256i m256High = _mm256_i32gather_epi64((const long long*) bvGroup, m128OffsetsHigh, 1);
+          m256Low = _mm256_permutevar8x32_epi32(_mm256_and_si256(_mm256_srlv_epi64(m256Low, m256ShiftsLow), m256Mask), m256Even);
+          m256High = _mm256_permutevar8x32_epi32(_mm256_and_si256(_mm256_srlv_epi64(m256High, m256ShiftsHigh), m256Mask), m256Even);
+          _mm256_storeu_si256((__m256i*) &ui32pValues[ui32Counter], _mm256_permute2x128_si256(m256Low, m256High, 0x20));
+          bvGroup = bvGroup + ui32Width;
+        }
+      }
+      return ui32Counter;
+    }
+
+  #endif
+
+  //! Private Variable: Selected Unpack Kernel
+  /*!
+    Kernel selected at the first bulk unpack, according to the processor features.
+  */
+  static packedvector_unpack_kernel_t __pukPackedVectorUnpackKernel = NULL;
+
+  //! Private Function: Kernel Getter
+  /*!
+    Gets the unpack kernel, selecting the fastest one available on the processor on the first call. Several threads can select it at the same time, since all of them select the same kernel; only the kernel pointer access must be atomic.
+  */
+  static packedvector_unpack_kernel_t __PackedVector_getKernel(void){
+    #if defined(__GNUC__) || defined(__clang__)
+      packedvector_unpack_kernel_t pukUnpackKernel = __atomic_load_n(&__pukPackedVectorUnpackKernel, __ATOMIC_ACQUIRE);
+    #else
+      packedvector_unpack_kernel_t pukUnpackKernel = __pukPackedVectorUnpackKernel;
+    #endif
+    if (pukUnpackKernel != NULL){
+      return pukUnpackKernel;
+    }
+    pukUnpackKernel = __PackedVector_unpackScalar;
+    #if defined(__PACKED_VECTOR_X86_SIMD__)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")){
+        pukUnpackKernel = __PackedVector_unpackAVX2;
+      }
+    #endif
+    #if defined(__GNUC__) || defined(__clang__)
+      __atomic_store_n(&__pukPackedVectorUnpackKernel, pukUnpackKernel, __ATOMIC_RELEASE);
+    #else
+      __pukPackedVectorUnpackKernel = pukUnpackKernel;
+    #endif
+    return pukUnpackKernel;
+  }
+
+  //! Function: Packed Vector Getter
+  /*!
+    Gets a value of a packed vector in O(1), with one 64-bit load.
+    \param pvVector is a packedvector_t type. It's the packed vector.
+    \param ui32Index is a unsigned 32-bit integer. It's the value index (it must be smaller than the amount of values).
+    \return Returns the value.
+  */
+  uint32_t PackedVector_get(packedvector_t pvVector, uint32_t ui32Index){
+    uint64_t ui64BitPosition = (uint64_t) ui32Index * pvVector->ui8BitWidth;
+    return (uint32_t) ((__PackedVector_load(pvVector->bvData, ui64BitPosition >> 3) >> (ui64BitPosition & 7)) & (uint64_t) PackedVector_getMaxValue(pvVector));
+  }
+
+  //! Function: Packed Vector Setter
+  /*!
+    Sets a value of a packed vector in O(1), with one 64-bit load and store. The bits of the value after the bit width are ignored.
+    \param pvVector is a packedvector_t type. It's the packed vector.
+    \param ui32Index is a unsigned 32-bit integer. It's the value index (it must be smaller than the amount of values).
+    \param ui32Value is a unsigned 32-bit integer. It's the new value.
+  */
+  void PackedVector_set(packedvector_t pvVector, uint32_t ui32Index, uint32_t ui32Value){
+    uint64_t ui64BitPosition = (uint64_t) ui32Index * pvVector->ui8BitWidth;
+    uint64_t ui64Mask = (uint64_t) PackedVector_getMaxValue(pvVector) << (ui64BitPosition & 7);
+    uint64_t ui64Bits = __PackedVector_load(pvVector->bvData, ui64BitPosition >> 3);
+    ui64Bits = (ui64Bits & ~ui64Mask) | (((uint64_t) ui32Value << (ui64BitPosition & 7)) & ui64Mask);
+    __PackedVector_store(pvVector->bvData, ui64BitPosition >> 3, ui64Bits);
+  }
+
+  //! Function: Packed Vector Bulk Unpack
+  /*!
+    Copies a range of values of a packed vector to a 32-bit integer array. It uses AVX2 gathers when the processor has them.
+    \param pvVector is a packedvector_t type. It's the packed vector.
+    \param ui32StartIndex is a unsigned 32-bit integer. It's the first value index.
+    \param ui32AmountOfValues is a unsigned 32-bit integer. It's the amount of values.
+    \param ui32pValues is a unsigned 32-bit integer pointer. It's the array where the values will be saved.
+    \return Returns false if the range is out of the packed vector.
+  */
+  bool PackedVector_unpack(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, uint32_t* ui32pValues){
+    uint32_t ui32Counter = 0;
+    if (ui32StartIndex > pvVector->ui32AmountOfValues || ui32AmountOfValues > pvVector->ui32AmountOfValues - ui32StartIndex){
+      return false;
+    }
+    ui32Counter = __PackedVector_getKernel()(pvVector, ui32StartIndex, ui32AmountOfValues, ui32pValues);
+    __PackedVector_unpackScalar(pvVector, ui32StartIndex + ui32Counter, ui32AmountOfValues - ui32Counter, &ui32pValues[ui32Counter]);
+    return true;
+  }
+
+  //! Function: Packed Vector Bulk Pack
+  /*!
+    Copies a 32-bit integer array to a range of values of a packed vector. The values are accumulated in a 64-bit word and written 32 bits at a time. The bits of each value after the bit width are ignored.
+    \param pvVector is a packedvector_t type. It's the packed vector.
+    \param ui32StartIndex is a unsigned 32-bit integer. It's the first value index.
+    \param ui32AmountOfValues is a unsigned 32-bit integer. It's the amount of values.
+    \param ui32pValues is a unsigned 32-bit integer pointer. It's the array with the values.
+    \return Returns false if the range is out of the packed vector.
+  */
+  bool PackedVector_pack(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, const uint32_t* ui32pValues){
+    uint64_t ui64BitPosition = (uint64_t) ui32StartIndex * pvVector->ui8BitWidth;
+    uint64_t ui64BytePosition = ui64BitPosition >> 3;
+    uint64_t ui64Mask = (uint64_t) PackedVector_getMaxValue(pvVector);
+    uint32_t ui32AmountOfBits = (uint32_t) (ui64BitPosition & 7);
+    uint64_t ui64Bits = 0;
+    uint32_t ui32Counter = 0;
+    if (ui32StartIndex > pvVector->ui32AmountOfValues || ui32AmountOfValues > pvVector->ui32AmountOfValues - ui32StartIndex){
+      return false;
+    }
+    ui64Bits = pvVector->bvData[ui64BytePosition] & (uint64_t) ((1U << ui32AmountOfBits) - 1);
+    for (ui32Counter = 0 ; ui32Counter < ui32AmountOfValues ; ui32Counter++){
+      ui64Bits = ui64Bits | ((ui32pValues[ui32Counter] & ui64Mask) << ui32AmountOfBits);
+      ui32AmountOfBits = ui32AmountOfBits + pvVector->ui8BitWidth;
+      if (ui32AmountOfBits >= 32){
+        pvVector->bvData[ui64BytePosition] = (bitvector_t) ui64Bits;
+        pvVector->bvData[ui64BytePosition + 1] = (bitvector_t) (ui64Bits >> 8);
+        pvVector->bvData[ui64BytePosition + 2] = (bitvector_t) (ui64Bits >> 16);
+        pvVector->bvData[ui64BytePosition + 3] = (bitvector_t) (ui64Bits >> 24);
+        ui64BytePosition = ui64BytePosition + 4;
+        ui64Bits = ui64Bits >> 32;
+        ui32AmountOfBits = ui32AmountOfBits - 32;
+      }
+    }
+    while (ui32AmountOfBits >= 8){
+      pvVector->bvData[ui64BytePosition] = (bitvector_t) ui64Bits;
+      ui64BytePosition++;
+      ui64Bits = ui64Bits >> 8;
+      ui32AmountOfBits = ui32AmountOfBits - 8;
+    }
+    if (ui32AmountOfBits > 0){
+      pvVector->bvData[ui64BytePosition] = (bitvector_t) ((pvVector->bvData[ui64BytePosition] & (uint8_t) ~((1U << ui32AmountOfBits) - 1)) | (uint8_t) ui64Bits);
+    }
+    return true;
+  }
+
+#endif
@@ -0,0 +1,139 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __PACKED_VECTOR_HEADER__
+  #define __PACKED_VECTOR_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+
+    //! Macro: Packed Vector Maximum Bit Width
+    /*!
+      Maximum amount of bits of each value of a packed vector.
+    */
+    #define PACKED_VECTOR_MAX_BIT_WIDTH 32
+
+    //! Type Definition: Packed Vector Structure
+    /*!
+      Vector of unsigned integers with any width from 1 to 32 bits, saved back-to-back in a bit vector. The value i is in the bits [i * ui8BitWidth, (i + 1) * ui8BitWidth) of the bit vector, with the least significant bit first.
+    */
+    typedef struct {
+      bitvector_t* const bvData;                                                                                                    /*!< const bitvector_t pointer type. */
+      const uint32_t ui32AmountOfValues;                                                                                            /*!< const 32-bits integer type. */
+      const uint8_t ui8BitWidth;                                                                                                    /*!< const 8-bits integer type. */
+    } packedvector_structure_t;
+
+    //! Type Definition: Packed Vector Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef packedvector_structure_t* packedvector_t;
+
+    //! Macro: Packed Vector Size
+    /*!
+      Calculates the amount of bytes of a packed vector data. It has 7 bytes more than the values, so each value can be read with one 64-bit load.
+      \param uiBitWidth is a unsigned integer. It's the amount of bits of each value.
+      \param uiAmountOfValues is a unsigned integer. It's the amount of values.
+      \return Returns the amount of bytes.
+    */
+    #define PackedVector_getSize(uiBitWidth, uiAmountOfValues)\
+      ((((uint64_t) (uiBitWidth) * (uint64_t) (uiAmountOfValues) + 7) >> 3) + 7)
+
+    //! Macro: Packed Vector Creator
+    /*!
+      This macro creates a packed vector with all values 0.
+      \param pvName is the packed vector name.
+      \param uiBitWidth is a unsigned integer. It's the amount of bits of each value (1 to PACKED_VECTOR_MAX_BIT_WIDTH).
+      \param uiAmountOfValues is a unsigned integer. It's the amount of values.
+    */
+    #define newPackedVector(pvName, uiBitWidth, uiAmountOfValues)\
+      bitvector_t __bvPackedVectorData##pvName[PackedVector_getSize(uiBitWidth, uiAmountOfValues)] = {0};\
+      packedvector_structure_t __pvsPackedVector##pvName = {\
+        .bvData = __bvPackedVectorData##pvName,\
+        .ui32AmountOfValues = uiAmountOfValues,\
+        .ui8BitWidth = uiBitWidth\
+      };\
+      packedvector_t pvName = &__pvsPackedVector##pvName
+
+    //! Macro: Static Packed Vector Creator
+    /*!
+      This macro creates a static packed vector with all values 0.
+      \param pvName is the packed vector name.
+      \param uiBitWidth is a unsigned integer. It's the amount of bits of each value (1 to PACKED_VECTOR_MAX_BIT_WIDTH).
+      \param uiAmountOfValues is a unsigned integer. It's the amount of values.
+    */
+    #define newStaticPackedVector(pvName, uiBitWidth, uiAmountOfValues)\
+      static bitvector_t __bvPackedVectorData##pvName[PackedVector_getSize(uiBitWidth, uiAmountOfValues)] = {0};\
+      static packedvector_structure_t __pvsPackedVector##pvName = {\
+        .bvData = __bvPackedVectorData##pvName,\
+        .ui32AmountOfValues = uiAmountOfValues,\
+        .ui8BitWidth = uiBitWidth\
+      };\
+      static packedvector_t pvName = &__pvsPackedVector##pvName
+
+    //! Macros: Packed Vector Getters
+    /*!
+      Get the amount of values, the bit width and the maximum value of a packed vector.
+      \param pvVector is a packedvector_t type. It's the packed vector.
+    */
+    #define PackedVector_getAmountOfValues(pvVector)\
+      ((pvVector)->ui32AmountOfValues)
+
+    #define PackedVector_getBitWidth(pvVector)\
+      ((pvVector)->ui8BitWidth)
+
+    #define PackedVector_getMaxValue(pvVector)\
+      ((uint32_t) (UINT32_MAX >> (PACKED_VECTOR_MAX_BIT_WIDTH - (pvVector)->ui8BitWidth)))
+
+    uint32_t PackedVector_get(packedvector_t pvVector, uint32_t ui32Index);                                                                            /*!< 32-bits integer type function. */
+    void PackedVector_set(packedvector_t pvVector, uint32_t ui32Index, uint32_t ui32Value);                                                            /*!< void type function. */
+    bool PackedVector_unpack(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, uint32_t* ui32pValues);                    /*!< bool type function. */
+    bool PackedVector_pack(packedvector_t pvVector, uint32_t ui32StartIndex, uint32_t ui32AmountOfValues, const uint32_t* ui32pValues);                /*!< bool type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
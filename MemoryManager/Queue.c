@@ -10,30 +10,21 @@
     Write a data on a queue buffer.
     \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of circular buffer.
     \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the buffer is full and its overflow policy discards the new data.
   */
-  void __QueueBuffer_push(buffer_t bfBuffer, void* vpData){
-    if (bfBuffer->ui8AmountOfData == bfBuffer->ui8BufferSize){
-      bfBuffer->ui8ReadPosition++;
-      if (bfBuffer->ui8ReadPosition == bfBuffer->ui8BufferSize){
-        bfBuffer->ui8ReadPosition = 0;
-      }
-    }
-    else{
-      bfBuffer->ui8AmountOfData++;
+  bool __QueueBuffer_push(buffer_t bfBuffer, void* vpData){
+    uint8_t ui8Position = __QueueBuffer_nextWritePosition(bfBuffer);
+    if (ui8Position == __BUFFER_DISCARDED_POSITION__){
+      return false;
     }
-    void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8WritePosition * bfBuffer->ui8ElementSize;
+    void* vpAdressBuffer = (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
     if (vpData != NULL){
       memcpy(vpAdressBuffer, vpData, bfBuffer->ui8ElementSize);
     }
     else{
       memset(vpAdressBuffer, 0, bfBuffer->ui8ElementSize);
     }
-    if (bfBuffer->ui8WritePosition == bfBuffer->ui8BufferSize - 1){
-      bfBuffer->ui8WritePosition = 0;
-    }
-    else{
-      bfBuffer->ui8WritePosition++;
-    }
+    return true;
   }
 
   //! Private Function: Queue Buffer Reader
@@ -43,20 +34,128 @@
     \return Returns the adress of data on the buffer.
   */
   void* __QueueBuffer_pop(buffer_t bfBuffer){
-    if (bfBuffer->ui8AmountOfData > 0){
-      void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8ReadPosition * bfBuffer->ui8ElementSize;
-      if (bfBuffer->ui8ReadPosition == bfBuffer->ui8BufferSize - 1){
-        bfBuffer->ui8ReadPosition = 0;
-      }
-      else{
-        bfBuffer->ui8ReadPosition++;
+    if (bfBuffer->ui8AmountOfData == 0){
+      return NULL;
+    }
+    return (char*) bfBuffer->vpVector + __QueueBuffer_nextReadPosition(bfBuffer) * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Queue Buffer Bulk Writer
+  /*!
+    Write some data on a queue buffer. If the buffer overflows, the oldest data is discarded.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param vpData is a const void pointer. It's the vector of data (or NULL to insert zeros).
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data.
+  */
+  uint32_t __QueueBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData){
+    uint8_t ui8Amount = (ui32AmountOfData > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : (uint8_t) ui32AmountOfData;
+    uint32_t ui32Position = bfBuffer->ui8WritePosition;
+    if (ui32AmountOfData > ui8Amount){
+      ui32Position = (ui32Position + ui32AmountOfData - ui8Amount) % bfBuffer->ui8BufferSize;                                     /*!< The overwritten data is skipped. */
+      if (vpData != NULL){
+        vpData = (const char*) vpData + (ui32AmountOfData - ui8Amount) * bfBuffer->ui8ElementSize;
       }
-      bfBuffer->ui8AmountOfData--;
-      return vpAdressBuffer;
+    }
+    __Buffer_writeSlots(bfBuffer, (uint8_t) ui32Position, bfBuffer->ui8BufferSize, vpData, ui8Amount);
+    ui32Position = ui32Position + ui8Amount;
+    bfBuffer->ui8WritePosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    if (ui32AmountOfData > (uint32_t) (bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData)){
+      bfBuffer->ui8AmountOfData = bfBuffer->ui8BufferSize;
+      bfBuffer->ui8ReadPosition = bfBuffer->ui8WritePosition;
     }
     else{
+      bfBuffer->ui8AmountOfData = bfBuffer->ui8AmountOfData + ui8Amount;
+    }
+    return ui32AmountOfData;
+  }
+
+  //! Private Function: Queue Buffer Bulk Reader
+  /*!
+    Read some data of a queue buffer, from the oldest.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfData is a 32-bits integer. It's the maximum amount of data.
+    \return Returns the amount of data read.
+  */
+  uint32_t __QueueBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData){
+    uint8_t ui8Amount = (ui32AmountOfData > bfBuffer->ui8AmountOfData) ? bfBuffer->ui8AmountOfData : (uint8_t) ui32AmountOfData;
+    __Buffer_readSlots(bfBuffer, bfBuffer->ui8ReadPosition, bfBuffer->ui8BufferSize, vpData, ui8Amount);
+    uint32_t ui32Position = bfBuffer->ui8ReadPosition + ui8Amount;
+    bfBuffer->ui8ReadPosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    bfBuffer->ui8AmountOfData = bfBuffer->ui8AmountOfData - ui8Amount;
+    return ui8Amount;
+  }
+
+  //! Private Function: Queue Buffer Slots Reserver
+  /*!
+    Get the contiguous free slots after the write position of a queue buffer. Reserved slots never overwrite pending data.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It's the desirable amount of slots and receives the amount of slots reserved.
+    \return Returns the address of the first slot or NULL if the buffer is full.
+  */
+  void* __QueueBuffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    uint8_t ui8Amount = bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData;
+    if (ui8Amount > bfBuffer->ui8BufferSize - bfBuffer->ui8WritePosition){
+      ui8Amount = bfBuffer->ui8BufferSize - bfBuffer->ui8WritePosition;
+    }
+    if (ui8Amount > *ui8pAmountOfData){
+      ui8Amount = *ui8pAmountOfData;
+    }
+    *ui8pAmountOfData = ui8Amount;
+    if (ui8Amount == 0){
       return NULL;
     }
+    return (char*) bfBuffer->vpVector + bfBuffer->ui8WritePosition * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Queue Buffer Slots Committer
+  /*!
+    Publish reserved slots of a queue buffer.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of slots written, up to the amount reserved.
+  */
+  void __QueueBuffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    if (ui8AmountOfData > bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData){
+      ui8AmountOfData = bfBuffer->ui8BufferSize - bfBuffer->ui8AmountOfData;
+    }
+    uint32_t ui32Position = bfBuffer->ui8WritePosition + ui8AmountOfData;
+    bfBuffer->ui8WritePosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    bfBuffer->ui8AmountOfData = bfBuffer->ui8AmountOfData + ui8AmountOfData;
+  }
+
+  //! Private Function: Queue Buffer Data Peeker
+  /*!
+    Get the contiguous pending data after the read position of a queue buffer, without removing it.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It receives the amount of contiguous pending data.
+    \return Returns the address of the oldest data or NULL if the buffer is empty.
+  */
+  void* __QueueBuffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    uint8_t ui8Amount = bfBuffer->ui8AmountOfData;
+    if (ui8Amount > bfBuffer->ui8BufferSize - bfBuffer->ui8ReadPosition){
+      ui8Amount = bfBuffer->ui8BufferSize - bfBuffer->ui8ReadPosition;
+    }
+    *ui8pAmountOfData = ui8Amount;
+    if (ui8Amount == 0){
+      return NULL;
+    }
+    return (char*) bfBuffer->vpVector + bfBuffer->ui8ReadPosition * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Queue Buffer Data Consumer
+  /*!
+    Remove the oldest data of a queue buffer.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of queue buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of data, up to the amount of pending data.
+  */
+  void __QueueBuffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    if (ui8AmountOfData > bfBuffer->ui8AmountOfData){
+      ui8AmountOfData = bfBuffer->ui8AmountOfData;
+    }
+    uint32_t ui32Position = bfBuffer->ui8ReadPosition + ui8AmountOfData;
+    bfBuffer->ui8ReadPosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    bfBuffer->ui8AmountOfData = bfBuffer->ui8AmountOfData - ui8AmountOfData;
   }
 
 #endif
\ No newline at end of file
@@ -44,8 +44,14 @@
       extern "C" {
     #endif
 
-    void __QueueBuffer_push(buffer_t bfBuffer, void* vpData);                   /*!< void type function. */
+    bool __QueueBuffer_push(buffer_t bfBuffer, void* vpData);                   /*!< bool type function. */
     void* __QueueBuffer_pop(buffer_t bfBuffer);                                 /*!< void pointer type function. */
+    uint32_t __QueueBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
+    uint32_t __QueueBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
+    void* __QueueBuffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);  /*!< void pointer type function. */
+    void __QueueBuffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData);      /*!< void type function. */
+    void* __QueueBuffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);     /*!< void pointer type function. */
+    void __QueueBuffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData);     /*!< void type function. */
 
     #ifdef __cplusplus
       }
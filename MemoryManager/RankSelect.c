@@ -0,0 +1,185 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+  #include "./RankSelect.h"
+
+  //! Macro: Words per Block
+  /*!
+    Amount of 64-bit words of a block.
+  */
+  #define __RANK_SELECT_BLOCK_WORDS__ (RANK_SELECT_BLOCK_SIZE / 64)
+
+  //! Macro: Blocks per Superblock
+  /*!
+    Amount of blocks of a superblock.
+  */
+  #define __RANK_SELECT_SUPERBLOCK_BLOCKS__ (RANK_SELECT_SUPERBLOCK_SIZE / RANK_SELECT_BLOCK_SIZE)
+
+  //! Macros: Bit Intrinsics
+  /*!
+    Population count and count trailing zeros of a 64-bit word.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __RankSelect_countOnes(ui64Word) ((uint32_t) __builtin_popcountll(ui64Word))
+    #define __RankSelect_countTrailingZeros(ui64Word) ((uint32_t) __builtin_ctzll(ui64Word))
+  #else
+    static uint32_t __RankSelect_countOnes(uint64_t ui64Word){
+      uint32_t ui32Counter = 0;
+      while (ui64Word != 0){
+        ui64Word = ui64Word & (ui64Word - 1);
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+
+    static uint32_t __RankSelect_countTrailingZeros(uint64_t ui64Word){
+      uint32_t ui32Counter = 0;
+      while ((ui64Word & 1) == 0){
+        ui64Word = ui64Word >> 1;
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+  #endif
+
+  //! Private Function: Word Loader
+  /*!
+    Loads a 64-bit word of the indexed bit vector. Bits after the end of the bit vector are read as 0.
+    \param rsIndex is a rankselect_t type. It's the index.
+    \param ui32WordPosition is a unsigned 32-bit integer. It's the word position.
+    \return Returns the word.
+  */
+  static inline uint64_t __RankSelect_loadWord(rankselect_t rsIndex, uint32_t ui32WordPosition){
+    uint32_t ui32FirstBit = ui32WordPosition << 6;
+    uint32_t ui32FirstByte = ui32FirstBit >> 3;
+    uint32_t ui32AmountOfBytes = BitVector_getSize(rsIndex->ui32AmountOfBits);
+    uint64_t ui64Word = 0;
+    uint8_t ui8Counter = 0;
+    if (ui32FirstBit >= rsIndex->ui32AmountOfBits){
+      return 0;
+    }
+    for (ui8Counter = 0 ; ui8Counter < 8 && (ui32FirstByte + ui8Counter) < ui32AmountOfBytes ; ui8Counter++){
+      ui64Word = ui64Word | ((uint64_t) rsIndex->bvBitVector[ui32FirstByte + ui8Counter] << (ui8Counter << 3));
+    }
+    if (rsIndex->ui32AmountOfBits - ui32FirstBit < 64){
+      ui64Word = ui64Word & (((uint64_t) 1 << (rsIndex->ui32AmountOfBits - ui32FirstBit)) - 1);
+    }
+    return ui64Word;
+  }
+
+  //! Private Function: Block Rank
+  /*!
+    Gets the amount of set bits before a block.
+  */
+  static inline uint32_t __RankSelect_getBlockRank(rankselect_t rsIndex, uint32_t ui32Block){
+    return rsIndex->ui32pSuperblockRanks[ui32Block / __RANK_SELECT_SUPERBLOCK_BLOCKS__] + rsIndex->ui16pBlockRanks[ui32Block];
+  }
+
+  //! Function: Rank/Select Index Builder
+  /*!
+    Builds the index of a bit vector. It reads the whole bit vector once.
+    \param rsIndex is a rankselect_t type. It's the index.
+  */
+  void RankSelect_build(rankselect_t rsIndex){
+    uint32_t ui32AmountOfWords = (rsIndex->ui32AmountOfBits + 63) >> 6;
+    uint32_t ui32AmountOfOnes = 0;
+    uint32_t ui32SuperblockOnes = 0;
+    uint32_t ui32NextSample = 0;
+    uint32_t ui32Word = 0;
+    for (ui32Word = 0 ; ui32Word < ui32AmountOfWords ; ui32Word++){
+      uint32_t ui32Block = ui32Word / __RANK_SELECT_BLOCK_WORDS__;
+      uint32_t ui32WordOnes = 0;
+      if ((ui32Word % __RANK_SELECT_BLOCK_WORDS__) == 0){
+        if ((ui32Block % __RANK_SELECT_SUPERBLOCK_BLOCKS__) == 0){
+          rsIndex->ui32pSuperblockRanks[ui32Block / __RANK_SELECT_SUPERBLOCK_BLOCKS__] = ui32AmountOfOnes;
+          ui32SuperblockOnes = 0;
+        }
+        rsIndex->ui16pBlockRanks[ui32Block] = (uint16_t) ui32SuperblockOnes;
+      }
+      ui32WordOnes = __RankSelect_countOnes(__RankSelect_loadWord(rsIndex, ui32Word));
+      while (ui32NextSample < ui32AmountOfOnes + ui32WordOnes){
+        rsIndex->ui32pSelectSamples[ui32NextSample / RANK_SELECT_SAMPLE_RATE] = ui32Block;
+        ui32NextSample = ui32NextSample + RANK_SELECT_SAMPLE_RATE;
+      }
+      ui32AmountOfOnes = ui32AmountOfOnes + ui32WordOnes;
+      ui32SuperblockOnes = ui32SuperblockOnes + ui32WordOnes;
+    }
+    rsIndex->ui32AmountOfOnes = ui32AmountOfOnes;
+  }
+
+  //! Function: Rank
+  /*!
+    Counts the set bits before a position in constant time: a superblock, a block and up to eight words.
+    \param rsIndex is a rankselect_t type. It's a built index.
+    \param ui32Position is a unsigned 32-bit integer. It's the position.
+    \return Returns the amount of set bits in [0, ui32Position).
+  */
+  uint32_t RankSelect_rank(rankselect_t rsIndex, uint32_t ui32Position){
+    uint32_t ui32Block = 0;
+    uint32_t ui32Word = 0;
+    uint32_t ui32Rank = 0;
+    if (ui32Position >= rsIndex->ui32AmountOfBits){
+      return rsIndex->ui32AmountOfOnes;
+    }
+    ui32Block = ui32Position / RANK_SELECT_BLOCK_SIZE;
+    ui32Rank = __RankSelect_getBlockRank(rsIndex, ui32Block);
+    for (ui32Word = ui32Block * __RANK_SELECT_BLOCK_WORDS__ ; ui32Word < (ui32Position >> 6) ; ui32Word++){
+      ui32Rank = ui32Rank + __RankSelect_countOnes(__RankSelect_loadWord(rsIndex, ui32Word));
+    }
+    if ((ui32Position & 63) != 0){
+      ui32Rank = ui32Rank + __RankSelect_countOnes(__RankSelect_loadWord(rsIndex, ui32Word) & (((uint64_t) 1 << (ui32Position & 63)) - 1));
+    }
+    return ui32Rank;
+  }
+
+  //! Function: Select
+  /*!
+    Finds the position of a set bit by its rank. The select samples bound the blocks to be searched, so the search is usually done on few blocks.
+    \param rsIndex is a rankselect_t type. It's a built index.
+    \param ui32Rank is a unsigned 32-bit integer. It's the rank of the set bit (0 is the first set bit).
+    \return Returns the bit position or BIT_VECTOR_NOT_FOUND.
+  */
+  uint32_t RankSelect_select(rankselect_t rsIndex, uint32_t ui32Rank){
+    uint32_t ui32Sample = ui32Rank / RANK_SELECT_SAMPLE_RATE;
+    uint32_t ui32FirstBlock = 0;
+    uint32_t ui32LastBlock = 0;
+    uint32_t ui32Word = 0;
+    uint64_t ui64Word = 0;
+    if (ui32Rank >= rsIndex->ui32AmountOfOnes){
+      return BIT_VECTOR_NOT_FOUND;
+    }
+    ui32FirstBlock = rsIndex->ui32pSelectSamples[ui32Sample];
+    if ((ui32Sample + 1) * RANK_SELECT_SAMPLE_RATE < rsIndex->ui32AmountOfOnes){
+      ui32LastBlock = rsIndex->ui32pSelectSamples[ui32Sample + 1];
+    }
+    else{
+      ui32LastBlock = (rsIndex->ui32AmountOfBits - 1) / RANK_SELECT_BLOCK_SIZE;
+    }
+    while (ui32FirstBlock < ui32LastBlock){
+      uint32_t ui32MiddleBlock = ui32FirstBlock + ((ui32LastBlock - ui32FirstBlock + 1) >> 1);
+      if (__RankSelect_getBlockRank(rsIndex, ui32MiddleBlock) <= ui32Rank){
+        ui32FirstBlock = ui32MiddleBlock;
+      }
+      else{
+        ui32LastBlock = ui32MiddleBlock - 1;
+      }
+    }
+    ui32Rank = ui32Rank - __RankSelect_getBlockRank(rsIndex, ui32FirstBlock);
+    for (ui32Word = ui32FirstBlock * __RANK_SELECT_BLOCK_WORDS__ ; ; ui32Word++){
+      uint32_t ui32WordOnes = 0;
+      ui64Word = __RankSelect_loadWord(rsIndex, ui32Word);
+      ui32WordOnes = __RankSelect_countOnes(ui64Word);
+      if (ui32Rank < ui32WordOnes){
+        break;
+      }
+      ui32Rank = ui32Rank - ui32WordOnes;
+    }
+    while (ui32Rank > 0){
+      ui64Word = ui64Word & (ui64Word - 1);
+      ui32Rank--;
+    }
+    return (ui32Word << 6) + __RankSelect_countTrailingZeros(ui64Word);
+  }
+
+#endif
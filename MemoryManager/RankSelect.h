@@ -0,0 +1,163 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __RANK_SELECT_HEADER__
+  #define __RANK_SELECT_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./BitVector.h"
+
+    //! Macros: Rank/Select Index Geometry
+    /*!
+      The index keeps the absolute amount of set bits before each superblock (32-bit), the amount of set bits from the superblock start to each block (16-bit) and the block of each RANK_SELECT_SAMPLE_RATE-th set bit. It's about 4% of the bit vector size.
+    */
+    #define RANK_SELECT_SUPERBLOCK_SIZE 4096
+    #define RANK_SELECT_BLOCK_SIZE 512
+    #define RANK_SELECT_SAMPLE_RATE 8192
+
+    //! Type Definition: Rank/Select Index Structure
+    /*!
+      Read-only rank/select index of a bit vector. It must be built again by RankSelect_build when the bit vector changes.
+    */
+    typedef struct {
+      const bitvector_t* const bvBitVector;                                                                                         /*!< const bitvector_t pointer type. */
+      uint32_t* const ui32pSuperblockRanks;                                                                                         /*!< const 32-bits integer pointer type. */
+      uint16_t* const ui16pBlockRanks;                                                                                              /*!< const 16-bits integer pointer type. */
+      uint32_t* const ui32pSelectSamples;                                                                                           /*!< const 32-bits integer pointer type. */
+      const uint32_t ui32AmountOfBits;                                                                                              /*!< const 32-bits integer type. */
+      uint32_t ui32AmountOfOnes;                                                                                                    /*!< 32-bits integer type. */
+    } rankselect_structure_t;
+
+    //! Type Definition: Rank/Select Index Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef rankselect_structure_t* rankselect_t;
+
+    //! Macros: Rank/Select Index Sizes
+    /*!
+      Calculate the amount of superblocks, blocks and select samples of an index.
+      \param uiAmountOfBits is a unsigned integer. It's the amount of bits of the bit vector.
+      \return Returns the amount of entries.
+    */
+    #define RankSelect_getAmountOfSuperblocks(uiAmountOfBits)\
+      ((((uint32_t) (uiAmountOfBits)) / RANK_SELECT_SUPERBLOCK_SIZE) + 1)
+
+    #define RankSelect_getAmountOfBlocks(uiAmountOfBits)\
+      ((((uint32_t) (uiAmountOfBits)) / RANK_SELECT_BLOCK_SIZE) + 1)
+
+    #define RankSelect_getAmountOfSamples(uiAmountOfBits)\
+      ((((uint32_t) (uiAmountOfBits)) / RANK_SELECT_SAMPLE_RATE) + 1)
+
+    //! Macro: Rank/Select Index Creator
+    /*!
+      This macro creates a rank/select index of a bit vector. It must be built by RankSelect_build before use.
+      \param rsName is the index name.
+      \param bvIndexedBitVector is a bitvector_t pointer. It's the indexed bit vector.
+      \param uiAmountOfBit is a unsigned integer. It's the amount of bits of the bit vector.
+    */
+    #define newRankSelect(rsName, bvIndexedBitVector, uiAmountOfBit)\
+      uint32_t __ui32RankSelectSuperblocks##rsName[RankSelect_getAmountOfSuperblocks(uiAmountOfBit)] = {0};\
+      uint16_t __ui16RankSelectBlocks##rsName[RankSelect_getAmountOfBlocks(uiAmountOfBit)] = {0};\
+      uint32_t __ui32RankSelectSamples##rsName[RankSelect_getAmountOfSamples(uiAmountOfBit)] = {0};\
+      rankselect_structure_t __rssRankSelect##rsName = {\
+        .bvBitVector = bvIndexedBitVector,\
+        .ui32pSuperblockRanks = __ui32RankSelectSuperblocks##rsName,\
+        .ui16pBlockRanks = __ui16RankSelectBlocks##rsName,\
+        .ui32pSelectSamples = __ui32RankSelectSamples##rsName,\
+        .ui32AmountOfBits = uiAmountOfBit,\
+        .ui32AmountOfOnes = 0\
+      };\
+      rankselect_t rsName = &__rssRankSelect##rsName
+
+    //! Macro: Static Rank/Select Index Creator
+    /*!
+      This macro creates a static rank/select index of a bit vector. It must be built by RankSelect_build before use.
+      \param rsName is the index name.
+      \param bvIndexedBitVector is a bitvector_t pointer. It's the indexed bit vector.
+      \param uiAmountOfBit is a unsigned integer. It's the amount of bits of the bit vector.
+    */
+    #define newStaticRankSelect(rsName, bvIndexedBitVector, uiAmountOfBit)\
+      static uint32_t __ui32RankSelectSuperblocks##rsName[RankSelect_getAmountOfSuperblocks(uiAmountOfBit)] = {0};\
+      static uint16_t __ui16RankSelectBlocks##rsName[RankSelect_getAmountOfBlocks(uiAmountOfBit)] = {0};\
+      static uint32_t __ui32RankSelectSamples##rsName[RankSelect_getAmountOfSamples(uiAmountOfBit)] = {0};\
+      static rankselect_structure_t __rssRankSelect##rsName = {\
+        .bvBitVector = bvIndexedBitVector,\
+        .ui32pSuperblockRanks = __ui32RankSelectSuperblocks##rsName,\
+        .ui16pBlockRanks = __ui16RankSelectBlocks##rsName,\
+        .ui32pSelectSamples = __ui32RankSelectSamples##rsName,\
+        .ui32AmountOfBits = uiAmountOfBit,\
+        .ui32AmountOfOnes = 0\
+      };\
+      static rankselect_t rsName = &__rssRankSelect##rsName
+
+    //! Macro: Amount of Set Bits Getter
+    /*!
+      Gets the amount of set bits of the indexed bit vector.
+      \param rsIndex is a rankselect_t type. It's a built index.
+      \return Returns the amount of set bits.
+    */
+    #define RankSelect_getAmountOfOnes(rsIndex)\
+      ((rsIndex)->ui32AmountOfOnes)
+
+    //! Macro: Clear Bits Rank
+    /*!
+      Counts the clear bits before a position.
+      \param rsIndex is a rankselect_t type. It's a built index.
+      \param ui32Position is a unsigned 32-bit integer. It's the position.
+      \return Returns the amount of clear bits in [0, ui32Position).
+    */
+    #define RankSelect_rankZeros(rsIndex, ui32Position)\
+      ((((ui32Position) < (rsIndex)->ui32AmountOfBits) ? (ui32Position) : (rsIndex)->ui32AmountOfBits) - RankSelect_rank(rsIndex, ui32Position))
+
+    void RankSelect_build(rankselect_t rsIndex);                                                                                    /*!< void type function. */
+    uint32_t RankSelect_rank(rankselect_t rsIndex, uint32_t ui32Position);                                                          /*!< 32-bits integer type function. */
+    uint32_t RankSelect_select(rankselect_t rsIndex, uint32_t ui32Rank);                                                            /*!< 32-bits integer type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
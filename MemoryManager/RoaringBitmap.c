@@ -0,0 +1,1036 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__) && defined(__DATA_BANK_MANAGER_ENABLE__)
+
+  #include "./RoaringBitmap.h"
+  #include <string.h>
+
+  //! Macros: Container Sizes
+  /*!
+    Amount of 64-bit words of a bitmap container and amount of elements needed by arrays and runs.
+  */
+  #define __ROARING_BITMAP_WORDS__ 1024
+  #define __RoaringBitmap_getArrayCapacity(ui32Cardinality) ((uint16_t) (((ui32Cardinality) + 3) >> 2))
+  #define __RoaringBitmap_getRunCapacity(ui32AmountOfRuns) ((uint16_t) (((ui32AmountOfRuns) + 1) >> 1))
+  #define __RoaringBitmap_getDirectoryCapacity(ui32AmountOfContainers) ((uint16_t) ((((ui32AmountOfContainers) * sizeof(roaring_container_t)) + ROARING_BITMAP_ELEMENT_SIZE - 1) / ROARING_BITMAP_ELEMENT_SIZE))
+  #define __RoaringBitmap_getIndexCapacity(ui32AmountOfBlocks) ((uint16_t) ((((ui32AmountOfBlocks) * sizeof(roaring_container_t*)) + ROARING_BITMAP_ELEMENT_SIZE - 1) / ROARING_BITMAP_ELEMENT_SIZE))
+
+  //! Macro: Maximum Amount of Containers
+  /*!
+    One container for each 16-bit key.
+  */
+  #define __ROARING_BITMAP_MAX_CONTAINERS__ 65536UL
+
+  //! Macro: Container Getter
+  /*!
+    Gets the address of a container of the directory by its position.
+  */
+  #define __RoaringBitmap_getContainer(rbBitmap, ui32Position)\
+    (&(rbBitmap)->rcppBlocks[(ui32Position) / ROARING_BITMAP_DIRECTORY_BLOCK_SIZE][(ui32Position) % ROARING_BITMAP_DIRECTORY_BLOCK_SIZE])
+
+  //! Macro: Container Cardinality
+  /*!
+    The cardinality of a container is saved minus 1, so a full container (65536 values) fits in 16 bits.
+  */
+  #define __RoaringBitmap_getCardinality(rcpContainer) ((uint32_t) (rcpContainer)->ui16Cardinality + 1)
+
+  //! Macros: Bit Intrinsics
+  /*!
+    Population count and count trailing zeros of a 64-bit word.
+  */
+  #if defined(__GNUC__) || defined(__clang__)
+    #define __RoaringBitmap_countOnes(ui64Word) ((uint32_t) __builtin_popcountll(ui64Word))
+    #define __RoaringBitmap_countTrailingZeros(ui64Word) ((uint32_t) __builtin_ctzll(ui64Word))
+  #else
+    static uint32_t __RoaringBitmap_countOnes(uint64_t ui64Word){
+      uint32_t ui32Counter = 0;
+      while (ui64Word != 0){
+        ui64Word = ui64Word & (ui64Word - 1);
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+
+    static uint32_t __RoaringBitmap_countTrailingZeros(uint64_t ui64Word){
+      uint32_t ui32Counter = 0;
+      while ((ui64Word & 1) == 0){
+        ui64Word = ui64Word >> 1;
+        ui32Counter++;
+      }
+      return ui32Counter;
+    }
+  #endif
+
+  //! Private Function: Data Bank Getter
+  /*!
+    Gets the data bank of a roaring bitmap.
+  */
+  static inline databank_t __RoaringBitmap_getDataBank(roaring_t rbBitmap){
+    return ((rbBitmap->dbDataBank != NULL) ? rbBitmap->dbDataBank : dbDefaultDataBank);
+  }
+
+  //! Private Function: Container Data Deallocation
+  /*!
+    Deallocates the data of a container and sets it to NULL.
+  */
+  static void __RoaringBitmap_freeContainer(roaring_t rbBitmap, roaring_container_t* rcpContainer){
+    if (rcpContainer->vpData != NULL){
+      DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rcpContainer->vpData, ROARING_BITMAP_ELEMENT_SIZE, rcpContainer->ui16Capacity);
+    }
+    rcpContainer->vpData = NULL;
+  }
+
+  //! Private Function: Words Range Setter
+  /*!
+    Sets the bits [ui32Start, ui32Start + ui32Amount) of a bitmap container.
+  */
+  static void __RoaringBitmap_setWordsRange(uint64_t* ui64pWords, uint32_t ui32Start, uint32_t ui32Amount){
+    uint32_t ui32End = ui32Start + ui32Amount;
+    uint32_t ui32FirstWord = ui32Start >> 6;
+    uint32_t ui32LastWord = (ui32End - 1) >> 6;
+    uint64_t ui64FirstMask = ~((uint64_t) 0) << (ui32Start & 63);
+    uint64_t ui64LastMask = ~((uint64_t) 0) >> (63 - ((ui32End - 1) & 63));
+    uint32_t ui32Word = 0;
+    if (ui32FirstWord == ui32LastWord){
+      ui64pWords[ui32FirstWord] = ui64pWords[ui32FirstWord] | (ui64FirstMask & ui64LastMask);
+      return;
+    }
+    ui64pWords[ui32FirstWord] = ui64pWords[ui32FirstWord] | ui64FirstMask;
+    for (ui32Word = ui32FirstWord + 1 ; ui32Word < ui32LastWord ; ui32Word++){
+      ui64pWords[ui32Word] = ~((uint64_t) 0);
+    }
+    ui64pWords[ui32LastWord] = ui64pWords[ui32LastWord] | ui64LastMask;
+  }
+
+  //! Private Function: Words Range Eraser
+  /*!
+    Clears the bits [ui32Start, ui32Start + ui32Amount) of a bitmap container.
+  */
+  static void __RoaringBitmap_clearWordsRange(uint64_t* ui64pWords, uint32_t ui32Start, uint32_t ui32Amount){
+    if (ui32Amount == 0){
+      return;
+    }
+    uint32_t ui32End = ui32Start + ui32Amount;
+    uint32_t ui32FirstWord = ui32Start >> 6;
+    uint32_t ui32LastWord = (ui32End - 1) >> 6;
+    uint64_t ui64FirstMask = ~((uint64_t) 0) << (ui32Start & 63);
+    uint64_t ui64LastMask = ~((uint64_t) 0) >> (63 - ((ui32End - 1) & 63));
+    uint32_t ui32Word = 0;
+    if (ui32FirstWord == ui32LastWord){
+      ui64pWords[ui32FirstWord] = ui64pWords[ui32FirstWord] & ~(ui64FirstMask & ui64LastMask);
+      return;
+    }
+    ui64pWords[ui32FirstWord] = ui64pWords[ui32FirstWord] & ~ui64FirstMask;
+    for (ui32Word = ui32FirstWord + 1 ; ui32Word < ui32LastWord ; ui32Word++){
+      ui64pWords[ui32Word] = 0;
+    }
+    ui64pWords[ui32LastWord] = ui64pWords[ui32LastWord] & ~ui64LastMask;
+  }
+
+  //! Private Function: Container to Words
+  /*!
+    Sets on a bitmap all values of a container (OR).
+  */
+  static void __RoaringBitmap_orIntoWords(uint64_t* ui64pWords, const roaring_container_t* rcpContainer){
+    uint32_t ui32Counter = 0;
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      const uint16_t* ui16pValues = (const uint16_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < __RoaringBitmap_getCardinality(rcpContainer) ; ui32Counter++){
+        ui64pWords[ui16pValues[ui32Counter] >> 6] = ui64pWords[ui16pValues[ui32Counter] >> 6] | ((uint64_t) 1 << (ui16pValues[ui32Counter] & 63));
+      }
+    }
+    else if (rcpContainer->ui8Type == ROARING_CONTAINER_BITMAP){
+      const uint64_t* ui64pSource = (const uint64_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < __ROARING_BITMAP_WORDS__ ; ui32Counter++){
+        ui64pWords[ui32Counter] = ui64pWords[ui32Counter] | ui64pSource[ui32Counter];
+      }
+    }
+    else{
+      const roaring_run_t* rrpRuns = (const roaring_run_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < rcpContainer->ui16AmountOfRuns ; ui32Counter++){
+        __RoaringBitmap_setWordsRange(ui64pWords, rrpRuns[ui32Counter].ui16Start, (uint32_t) rrpRuns[ui32Counter].ui16Length + 1);
+      }
+    }
+  }
+
+  //! Private Function: Words Cardinality
+  /*!
+    Counts the set bits of a bitmap container.
+  */
+  static uint32_t __RoaringBitmap_countWords(const uint64_t* ui64pWords){
+    uint32_t ui32Counter = 0;
+    uint32_t ui32Cardinality = 0;
+    for (ui32Counter = 0 ; ui32Counter < __ROARING_BITMAP_WORDS__ ; ui32Counter++){
+      ui32Cardinality = ui32Cardinality + __RoaringBitmap_countOnes(ui64pWords[ui32Counter]);
+    }
+    return ui32Cardinality;
+  }
+
+  //! Private Function: Amount of Runs Counter
+  /*!
+    Counts the runs of consecutive values of a container.
+  */
+  static uint32_t __RoaringBitmap_countRuns(const roaring_container_t* rcpContainer){
+    uint32_t ui32Counter = 0;
+    uint32_t ui32AmountOfRuns = 0;
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      const uint16_t* ui16pValues = (const uint16_t*) rcpContainer->vpData;
+      ui32AmountOfRuns = 1;
+      for (ui32Counter = 1 ; ui32Counter < __RoaringBitmap_getCardinality(rcpContainer) ; ui32Counter++){
+        if (ui16pValues[ui32Counter] != (uint16_t) (ui16pValues[ui32Counter - 1] + 1)){
+          ui32AmountOfRuns++;
+        }
+      }
+    }
+    else if (rcpContainer->ui8Type == ROARING_CONTAINER_BITMAP){
+      const uint64_t* ui64pWords = (const uint64_t*) rcpContainer->vpData;
+      uint64_t ui64Carry = 0;
+      for (ui32Counter = 0 ; ui32Counter < __ROARING_BITMAP_WORDS__ ; ui32Counter++){
+        ui32AmountOfRuns = ui32AmountOfRuns + __RoaringBitmap_countOnes(ui64pWords[ui32Counter] & ~((ui64pWords[ui32Counter] << 1) | ui64Carry));
+        ui64Carry = ui64pWords[ui32Counter] >> 63;
+      }
+    }
+    else{
+      ui32AmountOfRuns = rcpContainer->ui16AmountOfRuns;
+    }
+    return ui32AmountOfRuns;
+  }
+
+  //! Private Function: Value Iterator
+  /*!
+    Calls a function for each value of a container, in increasing order, until it returns false.
+    \return Returns false if the iteration was stopped.
+  */
+  static bool __RoaringBitmap_forEachValue(const roaring_container_t* rcpContainer, bool (*bfpCallback)(uint32_t ui32Value, void* vpContext), void* vpContext){
+    uint32_t ui32High = (uint32_t) rcpContainer->ui16Key << 16;
+    uint32_t ui32Counter = 0;
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      const uint16_t* ui16pValues = (const uint16_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < __RoaringBitmap_getCardinality(rcpContainer) ; ui32Counter++){
+        if (bfpCallback(ui32High | ui16pValues[ui32Counter], vpContext) == false){
+          return false;
+        }
+      }
+    }
+    else if (rcpContainer->ui8Type == ROARING_CONTAINER_BITMAP){
+      const uint64_t* ui64pWords = (const uint64_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < __ROARING_BITMAP_WORDS__ ; ui32Counter++){
+        uint64_t ui64Word = ui64pWords[ui32Counter];
+        while (ui64Word != 0){
+          if (bfpCallback(ui32High | ((ui32Counter << 6) + __RoaringBitmap_countTrailingZeros(ui64Word)), vpContext) == false){
+            return false;
+          }
+          ui64Word = ui64Word & (ui64Word - 1);
+        }
+      }
+    }
+    else{
+      const roaring_run_t* rrpRuns = (const roaring_run_t*) rcpContainer->vpData;
+      for (ui32Counter = 0 ; ui32Counter < rcpContainer->ui16AmountOfRuns ; ui32Counter++){
+        uint32_t ui32Value = rrpRuns[ui32Counter].ui16Start;
+        uint32_t ui32End = ui32Value + rrpRuns[ui32Counter].ui16Length;
+        for ( ; ui32Value <= ui32End ; ui32Value++){
+          if (bfpCallback(ui32High | ui32Value, vpContext) == false){
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  //! Private Function: Array Binary Search
+  /*!
+    Finds the position of a value in a sorted array, or the position where it should be inserted.
+  */
+  static uint32_t __RoaringBitmap_lowerBound(const uint16_t* ui16pValues, uint32_t ui32AmountOfValues, uint16_t ui16Value){
+    uint32_t ui32First = 0;
+    while (ui32AmountOfValues > 0){
+      uint32_t ui32Half = ui32AmountOfValues >> 1;
+      if (ui16pValues[ui32First + ui32Half] < ui16Value){
+        ui32First = ui32First + ui32Half + 1;
+        ui32AmountOfValues = ui32AmountOfValues - ui32Half - 1;
+      }
+      else{
+        ui32AmountOfValues = ui32Half;
+      }
+    }
+    return ui32First;
+  }
+
+  //! Private Function: Container Value Checker
+  /*!
+    Checks if a container has a value.
+  */
+  static bool __RoaringBitmap_containerContains(const roaring_container_t* rcpContainer, uint16_t ui16Value){
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      const uint16_t* ui16pValues = (const uint16_t*) rcpContainer->vpData;
+      uint32_t ui32Position = __RoaringBitmap_lowerBound(ui16pValues, __RoaringBitmap_getCardinality(rcpContainer), ui16Value);
+      return (ui32Position < __RoaringBitmap_getCardinality(rcpContainer) && ui16pValues[ui32Position] == ui16Value);
+    }
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_BITMAP){
+      return ((((const uint64_t*) rcpContainer->vpData)[ui16Value >> 6] >> (ui16Value & 63)) & 1) == 1;
+    }
+    const roaring_run_t* rrpRuns = (const roaring_run_t*) rcpContainer->vpData;
+    uint32_t ui32First = 0;
+    uint32_t ui32Last = rcpContainer->ui16AmountOfRuns;
+    while (ui32First < ui32Last){
+      uint32_t ui32Middle = (ui32First + ui32Last) >> 1;
+      if (rrpRuns[ui32Middle].ui16Start <= ui16Value){
+        ui32First = ui32Middle + 1;
+      }
+      else{
+        ui32Last = ui32Middle;
+      }
+    }
+    return (ui32First > 0 && (uint32_t) ui16Value <= (uint32_t) rrpRuns[ui32First - 1].ui16Start + rrpRuns[ui32First - 1].ui16Length);
+  }
+
+  //! Private Function: Bitmap Conversion
+  /*!
+    Converts a container to a bitmap container.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_toBitmap(roaring_t rbBitmap, roaring_container_t* rcpContainer){
+    uint64_t* ui64pWords = (uint64_t*) DataBank_callocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, __ROARING_BITMAP_WORDS__);
+    if (ui64pWords == NULL){
+      return false;
+    }
+    __RoaringBitmap_orIntoWords(ui64pWords, rcpContainer);
+    __RoaringBitmap_freeContainer(rbBitmap, rcpContainer);
+    rcpContainer->vpData = ui64pWords;
+    rcpContainer->ui16Capacity = __ROARING_BITMAP_WORDS__;
+    rcpContainer->ui16AmountOfRuns = 0;
+    rcpContainer->ui8Type = ROARING_CONTAINER_BITMAP;
+    return true;
+  }
+
+  //! Private Function: Array Collector
+  /*!
+    Used by __RoaringBitmap_toArray to write the values of a container in an array.
+  */
+  static bool __RoaringBitmap_collectValue(uint32_t ui32Value, void* vpContext){
+    uint16_t** ui16ppWritePosition = (uint16_t**) vpContext;
+    **ui16ppWritePosition = (uint16_t) ui32Value;
+    *ui16ppWritePosition = *ui16ppWritePosition + 1;
+    return true;
+  }
+
+  //! Private Function: Array Conversion
+  /*!
+    Converts a container with up to ROARING_BITMAP_ARRAY_LIMIT values to an array container.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_toArray(roaring_t rbBitmap, roaring_container_t* rcpContainer){
+    uint16_t ui16Capacity = __RoaringBitmap_getArrayCapacity(__RoaringBitmap_getCardinality(rcpContainer));
+    uint16_t* ui16pValues = (uint16_t*) DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, ui16Capacity);
+    uint16_t* ui16pWritePosition = ui16pValues;
+    if (ui16pValues == NULL){
+      return false;
+    }
+    __RoaringBitmap_forEachValue(rcpContainer, __RoaringBitmap_collectValue, &ui16pWritePosition);
+    __RoaringBitmap_freeContainer(rbBitmap, rcpContainer);
+    rcpContainer->vpData = ui16pValues;
+    rcpContainer->ui16Capacity = ui16Capacity;
+    rcpContainer->ui16AmountOfRuns = 0;
+    rcpContainer->ui8Type = ROARING_CONTAINER_ARRAY;
+    return true;
+  }
+
+  //! Private Function: Run Collector
+  /*!
+    Used by __RoaringBitmap_toRun to write the values of a container as runs.
+  */
+  static bool __RoaringBitmap_collectRun(uint32_t ui32Value, void* vpContext){
+    roaring_run_t** rrppLastRun = (roaring_run_t**) vpContext;
+    uint16_t ui16Value = (uint16_t) ui32Value;
+    if ((*rrppLastRun)->ui16Length != UINT16_MAX && (uint32_t) (*rrppLastRun)->ui16Start + (*rrppLastRun)->ui16Length + 1 == ui16Value){
+      (*rrppLastRun)->ui16Length++;
+    }
+    else{
+      if ((*rrppLastRun)->ui16Length != UINT16_MAX){
+        *rrppLastRun = *rrppLastRun + 1;
+      }
+      (*rrppLastRun)->ui16Start = ui16Value;
+      (*rrppLastRun)->ui16Length = 0;
+    }
+    return true;
+  }
+
+  //! Private Function: Run Conversion
+  /*!
+    Converts a container to a run container.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_toRun(roaring_t rbBitmap, roaring_container_t* rcpContainer, uint32_t ui32AmountOfRuns){
+    uint16_t ui16Capacity = __RoaringBitmap_getRunCapacity(ui32AmountOfRuns);
+    roaring_run_t* rrpRuns = (roaring_run_t*) DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, ui16Capacity);
+    roaring_run_t* rrpLastRun = rrpRuns;
+    if (rrpRuns == NULL){
+      return false;
+    }
+    rrpRuns[0].ui16Start = 0;
+    rrpRuns[0].ui16Length = UINT16_MAX;
+    __RoaringBitmap_forEachValue(rcpContainer, __RoaringBitmap_collectRun, &rrpLastRun);
+    __RoaringBitmap_freeContainer(rbBitmap, rcpContainer);
+    rcpContainer->vpData = rrpRuns;
+    rcpContainer->ui16Capacity = ui16Capacity;
+    rcpContainer->ui16AmountOfRuns = (uint16_t) ui32AmountOfRuns;
+    rcpContainer->ui8Type = ROARING_CONTAINER_RUN;
+    return true;
+  }
+
+  //! Private Function: Container Normalizer
+  /*!
+    Converts a run container to the array or bitmap type, so its values can be changed.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_toMutable(roaring_t rbBitmap, roaring_container_t* rcpContainer){
+    if (rcpContainer->ui8Type != ROARING_CONTAINER_RUN){
+      return true;
+    }
+    if (__RoaringBitmap_getCardinality(rcpContainer) <= ROARING_BITMAP_ARRAY_LIMIT){
+      return __RoaringBitmap_toArray(rbBitmap, rcpContainer);
+    }
+    return __RoaringBitmap_toBitmap(rbBitmap, rcpContainer);
+  }
+
+  //! Private Function: Container Finder
+  /*!
+    Finds a container by its key (binary search).
+    \return Returns the container position or the position where it should be inserted.
+  */
+  static uint32_t __RoaringBitmap_findContainer(roaring_t rbBitmap, uint16_t ui16Key){
+    uint32_t ui32First = 0;
+    uint32_t ui32Last = rbBitmap->ui32AmountOfContainers;
+    while (ui32First < ui32Last){
+      uint32_t ui32Middle = (ui32First + ui32Last) >> 1;
+      if (__RoaringBitmap_getContainer(rbBitmap, ui32Middle)->ui16Key < ui16Key){
+        ui32First = ui32Middle + 1;
+      }
+      else{
+        ui32Last = ui32Middle;
+      }
+    }
+    return ui32First;
+  }
+
+  //! Private Function: Directory Index Reservation
+  /*!
+    Grows the directory index to keep at least one more directory block.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_reserveBlock(roaring_t rbBitmap){
+    uint32_t ui32NewCapacity = 0;
+    roaring_container_t** rcppBlocks = NULL;
+    if (rbBitmap->ui16AmountOfBlocks < rbBitmap->ui16IndexCapacity){
+      return true;
+    }
+    ui32NewCapacity = (rbBitmap->ui16IndexCapacity == 0) ? 1 : ((uint32_t) rbBitmap->ui16IndexCapacity * 2);
+    rcppBlocks = (roaring_container_t**) DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getIndexCapacity(ui32NewCapacity));
+    if (rcppBlocks == NULL){
+      return false;
+    }
+    if (rbBitmap->rcppBlocks != NULL){
+      memcpy(rcppBlocks, rbBitmap->rcppBlocks, rbBitmap->ui16AmountOfBlocks * sizeof(roaring_container_t*));
+      DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rbBitmap->rcppBlocks, ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getIndexCapacity(rbBitmap->ui16IndexCapacity));
+    }
+    rbBitmap->rcppBlocks = rcppBlocks;
+    rbBitmap->ui16IndexCapacity = (uint16_t) ui32NewCapacity;
+    return true;
+  }
+
+  //! Private Function: Directory Reservation
+  /*!
+    Grows the directory to keep at least one more container. The first block doubles up to ROARING_BITMAP_DIRECTORY_BLOCK_SIZE containers, so small bitmaps keep a small directory; then full blocks are added.
+    \return Returns false if there is no memory or the directory has all 65536 keys.
+  */
+  static bool __RoaringBitmap_reserveContainer(roaring_t rbBitmap){
+    roaring_container_t* rcpBlock = NULL;
+    if (rbBitmap->ui16AmountOfBlocks > 0 && rbBitmap->ui32AmountOfContainers < ((uint32_t) rbBitmap->ui16AmountOfBlocks - 1) * ROARING_BITMAP_DIRECTORY_BLOCK_SIZE + rbBitmap->ui16Capacity){
+      return true;
+    }
+    if (rbBitmap->ui32AmountOfContainers >= __ROARING_BITMAP_MAX_CONTAINERS__){
+      return false;
+    }
+    if ((rbBitmap->ui16AmountOfBlocks == 0 || rbBitmap->ui16Capacity == ROARING_BITMAP_DIRECTORY_BLOCK_SIZE) && __RoaringBitmap_reserveBlock(rbBitmap) == false){
+      return false;
+    }
+    if (rbBitmap->ui16Capacity < ROARING_BITMAP_DIRECTORY_BLOCK_SIZE){
+      uint16_t ui16NewCapacity = (rbBitmap->ui16Capacity == 0) ? 4 : (uint16_t) (rbBitmap->ui16Capacity * 2);
+      if (ui16NewCapacity > ROARING_BITMAP_DIRECTORY_BLOCK_SIZE){
+        ui16NewCapacity = ROARING_BITMAP_DIRECTORY_BLOCK_SIZE;
+      }
+      rcpBlock = (roaring_container_t*) DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getDirectoryCapacity(ui16NewCapacity));
+      if (rcpBlock == NULL){
+        return false;
+      }
+      if (rbBitmap->ui16AmountOfBlocks > 0){
+        memcpy(rcpBlock, rbBitmap->rcppBlocks[0], rbBitmap->ui32AmountOfContainers * sizeof(roaring_container_t));
+        DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rbBitmap->rcppBlocks[0], ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getDirectoryCapacity(rbBitmap->ui16Capacity));
+      }
+      rbBitmap->rcppBlocks[0] = rcpBlock;
+      rbBitmap->ui16AmountOfBlocks = 1;
+      rbBitmap->ui16Capacity = ui16NewCapacity;
+      return true;
+    }
+    rcpBlock = (roaring_container_t*) DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getDirectoryCapacity(ROARING_BITMAP_DIRECTORY_BLOCK_SIZE));
+    if (rcpBlock == NULL){
+      return false;
+    }
+    rbBitmap->rcppBlocks[rbBitmap->ui16AmountOfBlocks] = rcpBlock;
+    rbBitmap->ui16AmountOfBlocks++;
+    return true;
+  }
+
+  //! Private Function: Container Insertion
+  /*!
+    Inserts a container in the directory. The containers after the position are moved one place, block by block.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_insertContainer(roaring_t rbBitmap, uint32_t ui32Position, const roaring_container_t* rcpContainer){
+    uint32_t ui32Last = rbBitmap->ui32AmountOfContainers;
+    if (__RoaringBitmap_reserveContainer(rbBitmap) == false){
+      return false;
+    }
+    while (ui32Last > ui32Position){
+      roaring_container_t* rcpBlock = rbBitmap->rcppBlocks[ui32Last / ROARING_BITMAP_DIRECTORY_BLOCK_SIZE];
+      uint32_t ui32Offset = ui32Last % ROARING_BITMAP_DIRECTORY_BLOCK_SIZE;
+      if (ui32Offset == 0){
+        rcpBlock[0] = *__RoaringBitmap_getContainer(rbBitmap, ui32Last - 1);
+        ui32Last--;
+      }
+      else{
+        uint32_t ui32First = (ui32Last - ui32Offset > ui32Position) ? 0 : (ui32Position % ROARING_BITMAP_DIRECTORY_BLOCK_SIZE);
+        memmove(&rcpBlock[ui32First + 1], &rcpBlock[ui32First], (ui32Offset - ui32First) * sizeof(roaring_container_t));
+        ui32Last = ui32Last - ui32Offset + ui32First;
+      }
+    }
+    *__RoaringBitmap_getContainer(rbBitmap, ui32Position) = *rcpContainer;
+    rbBitmap->ui32AmountOfContainers++;
+    return true;
+  }
+
+  //! Private Function: Container Removal
+  /*!
+    Deallocates a container and removes it from the directory. The containers after the position are moved one place, block by block, and an empty last block is deallocated.
+  */
+  static void __RoaringBitmap_removeContainer(roaring_t rbBitmap, uint32_t ui32Position){
+    __RoaringBitmap_freeContainer(rbBitmap, __RoaringBitmap_getContainer(rbBitmap, ui32Position));
+    rbBitmap->ui32AmountOfContainers--;
+    while (ui32Position < rbBitmap->ui32AmountOfContainers){
+      roaring_container_t* rcpBlock = rbBitmap->rcppBlocks[ui32Position / ROARING_BITMAP_DIRECTORY_BLOCK_SIZE];
+      uint32_t ui32Offset = ui32Position % ROARING_BITMAP_DIRECTORY_BLOCK_SIZE;
+      uint32_t ui32End = rbBitmap->ui32AmountOfContainers - (ui32Position - ui32Offset);
+      if (ui32Offset == ROARING_BITMAP_DIRECTORY_BLOCK_SIZE - 1){
+        rcpBlock[ui32Offset] = *__RoaringBitmap_getContainer(rbBitmap, ui32Position + 1);
+        ui32Position++;
+      }
+      else{
+        if (ui32End > ROARING_BITMAP_DIRECTORY_BLOCK_SIZE - 1){
+          ui32End = ROARING_BITMAP_DIRECTORY_BLOCK_SIZE - 1;
+        }
+        memmove(&rcpBlock[ui32Offset], &rcpBlock[ui32Offset + 1], (ui32End - ui32Offset) * sizeof(roaring_container_t));
+        ui32Position = ui32Position - ui32Offset + ui32End;
+      }
+    }
+    if (rbBitmap->ui16AmountOfBlocks > 1 && rbBitmap->ui32AmountOfContainers <= ((uint32_t) rbBitmap->ui16AmountOfBlocks - 1) * ROARING_BITMAP_DIRECTORY_BLOCK_SIZE){
+      rbBitmap->ui16AmountOfBlocks--;
+      DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rbBitmap->rcppBlocks[rbBitmap->ui16AmountOfBlocks], ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getDirectoryCapacity(ROARING_BITMAP_DIRECTORY_BLOCK_SIZE));
+    }
+  }
+
+  //! Private Function: Container Copy
+  /*!
+    Copies a container of a bitmap to a new container allocated from another bitmap data bank.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_copyContainer(roaring_t rbDestination, const roaring_container_t* rcpSource, roaring_container_t* rcpCopy){
+    *rcpCopy = *rcpSource;
+    rcpCopy->vpData = DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbDestination), ROARING_BITMAP_ELEMENT_SIZE, rcpSource->ui16Capacity);
+    if (rcpCopy->vpData == NULL){
+      return false;
+    }
+    memcpy(rcpCopy->vpData, rcpSource->vpData, (size_t) rcpSource->ui16Capacity * ROARING_BITMAP_ELEMENT_SIZE);
+    return true;
+  }
+
+  //! Private Function: Bitmap Result Finisher
+  /*!
+    Sets the cardinality of a bitmap container result. Results with few values become arrays and empty results are deallocated.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_finishBitmap(roaring_t rbDestination, roaring_container_t* rcpResult){
+    uint32_t ui32Cardinality = __RoaringBitmap_countWords((const uint64_t*) rcpResult->vpData);
+    if (ui32Cardinality == 0){
+      __RoaringBitmap_freeContainer(rbDestination, rcpResult);
+      return true;
+    }
+    rcpResult->ui16Cardinality = (uint16_t) (ui32Cardinality - 1);
+    if (ui32Cardinality <= ROARING_BITMAP_ARRAY_LIMIT){
+      return __RoaringBitmap_toArray(rbDestination, rcpResult);
+    }
+    return true;
+  }
+
+  //! Private Function: Container Union
+  /*!
+    Makes the union of two containers with the same key.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_uniteContainers(roaring_t rbDestination, const roaring_container_t* rcpContainerA, const roaring_container_t* rcpContainerB, roaring_container_t* rcpResult){
+    uint32_t ui32CardinalityA = __RoaringBitmap_getCardinality(rcpContainerA);
+    uint32_t ui32CardinalityB = __RoaringBitmap_getCardinality(rcpContainerB);
+    memset(rcpResult, 0, sizeof(roaring_container_t));
+    rcpResult->ui16Key = rcpContainerA->ui16Key;
+    if (rcpContainerA->ui8Type == ROARING_CONTAINER_ARRAY && rcpContainerB->ui8Type == ROARING_CONTAINER_ARRAY && (ui32CardinalityA + ui32CardinalityB) <= ROARING_BITMAP_ARRAY_LIMIT){
+      const uint16_t* ui16pValuesA = (const uint16_t*) rcpContainerA->vpData;
+      const uint16_t* ui16pValuesB = (const uint16_t*) rcpContainerB->vpData;
+      uint16_t* ui16pValues = NULL;
+      uint32_t ui32PositionA = 0;
+      uint32_t ui32PositionB = 0;
+      uint32_t ui32Cardinality = 0;
+      rcpResult->ui16Capacity = __RoaringBitmap_getArrayCapacity(ui32CardinalityA + ui32CardinalityB);
+      rcpResult->vpData = DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbDestination), ROARING_BITMAP_ELEMENT_SIZE, rcpResult->ui16Capacity);
+      if (rcpResult->vpData == NULL){
+        return false;
+      }
+      ui16pValues = (uint16_t*) rcpResult->vpData;
+      while (ui32PositionA < ui32CardinalityA && ui32PositionB < ui32CardinalityB){
+        if (ui16pValuesA[ui32PositionA] < ui16pValuesB[ui32PositionB]){
+          ui16pValues[ui32Cardinality++] = ui16pValuesA[ui32PositionA++];
+        }
+        else if (ui16pValuesA[ui32PositionA] > ui16pValuesB[ui32PositionB]){
+          ui16pValues[ui32Cardinality++] = ui16pValuesB[ui32PositionB++];
+        }
+        else{
+          ui16pValues[ui32Cardinality++] = ui16pValuesA[ui32PositionA++];
+          ui32PositionB++;
+        }
+      }
+      while (ui32PositionA < ui32CardinalityA){
+        ui16pValues[ui32Cardinality++] = ui16pValuesA[ui32PositionA++];
+      }
+      while (ui32PositionB < ui32CardinalityB){
+        ui16pValues[ui32Cardinality++] = ui16pValuesB[ui32PositionB++];
+      }
+      rcpResult->ui16Cardinality = (uint16_t) (ui32Cardinality - 1);
+      rcpResult->ui8Type = ROARING_CONTAINER_ARRAY;
+      return true;
+    }
+    rcpResult->ui16Capacity = __ROARING_BITMAP_WORDS__;
+    rcpResult->vpData = DataBank_callocFrom(__RoaringBitmap_getDataBank(rbDestination), ROARING_BITMAP_ELEMENT_SIZE, __ROARING_BITMAP_WORDS__);
+    if (rcpResult->vpData == NULL){
+      return false;
+    }
+    rcpResult->ui8Type = ROARING_CONTAINER_BITMAP;
+    __RoaringBitmap_orIntoWords((uint64_t*) rcpResult->vpData, rcpContainerA);
+    __RoaringBitmap_orIntoWords((uint64_t*) rcpResult->vpData, rcpContainerB);
+    return __RoaringBitmap_finishBitmap(rbDestination, rcpResult);
+  }
+
+  //! Private Function: Container Intersection
+  /*!
+    Makes the intersection of two containers with the same key. An empty result has vpData equal to NULL.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_intersectContainers(roaring_t rbDestination, const roaring_container_t* rcpContainerA, const roaring_container_t* rcpContainerB, roaring_container_t* rcpResult){
+    memset(rcpResult, 0, sizeof(roaring_container_t));
+    rcpResult->ui16Key = rcpContainerA->ui16Key;
+    if (rcpContainerB->ui8Type == ROARING_CONTAINER_ARRAY && (rcpContainerA->ui8Type != ROARING_CONTAINER_ARRAY || __RoaringBitmap_getCardinality(rcpContainerB) < __RoaringBitmap_getCardinality(rcpContainerA))){
+      const roaring_container_t* rcpSwap = rcpContainerA;
+      rcpContainerA = rcpContainerB;
+      rcpContainerB = rcpSwap;
+    }
+    if (rcpContainerA->ui8Type == ROARING_CONTAINER_ARRAY){
+      const uint16_t* ui16pValuesA = (const uint16_t*) rcpContainerA->vpData;
+      uint16_t* ui16pValues = NULL;
+      uint32_t ui32Counter = 0;
+      uint32_t ui32Cardinality = 0;
+      rcpResult->ui16Capacity = __RoaringBitmap_getArrayCapacity(__RoaringBitmap_getCardinality(rcpContainerA));
+      rcpResult->vpData = DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbDestination), ROARING_BITMAP_ELEMENT_SIZE, rcpResult->ui16Capacity);
+      if (rcpResult->vpData == NULL){
+        return false;
+      }
+      ui16pValues = (uint16_t*) rcpResult->vpData;
+      if (rcpContainerB->ui8Type == ROARING_CONTAINER_ARRAY){
+        const uint16_t* ui16pValuesB = (const uint16_t*) rcpContainerB->vpData;
+        uint32_t ui32PositionB = 0;
+        for (ui32Counter = 0 ; ui32Counter < __RoaringBitmap_getCardinality(rcpContainerA) && ui32PositionB < __RoaringBitmap_getCardinality(rcpContainerB) ; ui32Counter++){
+          while (ui32PositionB < __RoaringBitmap_getCardinality(rcpContainerB) && ui16pValuesB[ui32PositionB] < ui16pValuesA[ui32Counter]){
+            ui32PositionB++;
+          }
+          if (ui32PositionB < __RoaringBitmap_getCardinality(rcpContainerB) && ui16pValuesB[ui32PositionB] == ui16pValuesA[ui32Counter]){
+            ui16pValues[ui32Cardinality++] = ui16pValuesA[ui32Counter];
+          }
+        }
+      }
+      else{
+        for (ui32Counter = 0 ; ui32Counter < __RoaringBitmap_getCardinality(rcpContainerA) ; ui32Counter++){
+          if (__RoaringBitmap_containerContains(rcpContainerB, ui16pValuesA[ui32Counter]) == true){
+            ui16pValues[ui32Cardinality++] = ui16pValuesA[ui32Counter];
+          }
+        }
+      }
+      if (ui32Cardinality == 0){
+        __RoaringBitmap_freeContainer(rbDestination, rcpResult);
+        return true;
+      }
+      rcpResult->ui16Cardinality = (uint16_t) (ui32Cardinality - 1);
+      rcpResult->ui8Type = ROARING_CONTAINER_ARRAY;
+      return true;
+    }
+    rcpResult->ui16Capacity = __ROARING_BITMAP_WORDS__;
+    rcpResult->vpData = DataBank_callocFrom(__RoaringBitmap_getDataBank(rbDestination), ROARING_BITMAP_ELEMENT_SIZE, __ROARING_BITMAP_WORDS__);
+    if (rcpResult->vpData == NULL){
+      return false;
+    }
+    rcpResult->ui8Type = ROARING_CONTAINER_BITMAP;
+    __RoaringBitmap_orIntoWords((uint64_t*) rcpResult->vpData, rcpContainerA);
+    if (rcpContainerB->ui8Type == ROARING_CONTAINER_BITMAP){
+      uint64_t* ui64pWords = (uint64_t*) rcpResult->vpData;
+      const uint64_t* ui64pWordsB = (const uint64_t*) rcpContainerB->vpData;
+      uint32_t ui32Counter = 0;
+      for (ui32Counter = 0 ; ui32Counter < __ROARING_BITMAP_WORDS__ ; ui32Counter++){
+        ui64pWords[ui32Counter] = ui64pWords[ui32Counter] & ui64pWordsB[ui32Counter];
+      }
+    }
+    else{
+      const roaring_run_t* rrpRuns = (const roaring_run_t*) rcpContainerB->vpData;
+      uint32_t ui32Counter = 0;
+      uint32_t ui32GapStart = 0;
+      for (ui32Counter = 0 ; ui32Counter < rcpContainerB->ui16AmountOfRuns ; ui32Counter++){
+        __RoaringBitmap_clearWordsRange((uint64_t*) rcpResult->vpData, ui32GapStart, rrpRuns[ui32Counter].ui16Start - ui32GapStart);
+        ui32GapStart = (uint32_t) rrpRuns[ui32Counter].ui16Start + rrpRuns[ui32Counter].ui16Length + 1;
+      }
+      __RoaringBitmap_clearWordsRange((uint64_t*) rcpResult->vpData, ui32GapStart, 65536 - ui32GapStart);
+    }
+    return __RoaringBitmap_finishBitmap(rbDestination, rcpResult);
+  }
+
+  //! Private Function: Container Append
+  /*!
+    Appends a result container to the directory, or deallocates it if the directory can't grow.
+    \return Returns false if there is no memory.
+  */
+  static bool __RoaringBitmap_appendContainer(roaring_t rbDestination, roaring_container_t* rcpContainer){
+    if (rcpContainer->vpData == NULL){
+      return true;
+    }
+    if (__RoaringBitmap_insertContainer(rbDestination, rbDestination->ui32AmountOfContainers, rcpContainer) == false){
+      __RoaringBitmap_freeContainer(rbDestination, rcpContainer);
+      return false;
+    }
+    return true;
+  }
+
+  //! Function: Roaring Bitmap Data Bank Setter
+  /*!
+    Selects the data bank where the containers will be allocated. The bitmap is cleared.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \param dbDataBank is a databank_t type. It's the data bank (NULL selects dbDefaultDataBank).
+  */
+  void RoaringBitmap_setDataBank(roaring_t rbBitmap, databank_t dbDataBank){
+    RoaringBitmap_clear(rbBitmap);
+    rbBitmap->dbDataBank = dbDataBank;
+  }
+
+  //! Function: Roaring Bitmap Eraser
+  /*!
+    Removes all values and deallocates all memory of a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+  */
+  void RoaringBitmap_clear(roaring_t rbBitmap){
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui32AmountOfContainers ; ui32Counter++){
+      __RoaringBitmap_freeContainer(rbBitmap, __RoaringBitmap_getContainer(rbBitmap, ui32Counter));
+    }
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui16AmountOfBlocks ; ui32Counter++){
+      DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rbBitmap->rcppBlocks[ui32Counter], ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getDirectoryCapacity((ui32Counter == 0) ? rbBitmap->ui16Capacity : ROARING_BITMAP_DIRECTORY_BLOCK_SIZE));
+    }
+    if (rbBitmap->rcppBlocks != NULL){
+      DataBank_freeFrom(__RoaringBitmap_getDataBank(rbBitmap), &rbBitmap->rcppBlocks, ROARING_BITMAP_ELEMENT_SIZE, __RoaringBitmap_getIndexCapacity(rbBitmap->ui16IndexCapacity));
+    }
+    rbBitmap->rcppBlocks = NULL;
+    rbBitmap->ui32AmountOfContainers = 0;
+    rbBitmap->ui16AmountOfBlocks = 0;
+    rbBitmap->ui16IndexCapacity = 0;
+    rbBitmap->ui16Capacity = 0;
+  }
+
+  //! Function: Roaring Bitmap Insertion
+  /*!
+    Adds a value to a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \param ui32Value is a unsigned 32-bit integer. It's the value.
+    \return Returns true if the value is in the bitmap or false if there is no memory.
+  */
+  bool RoaringBitmap_add(roaring_t rbBitmap, uint32_t ui32Value){
+    uint16_t ui16Key = (uint16_t) (ui32Value >> 16);
+    uint16_t ui16Value = (uint16_t) ui32Value;
+    uint32_t ui32Position = __RoaringBitmap_findContainer(rbBitmap, ui16Key);
+    roaring_container_t* rcpContainer = NULL;
+    if (ui32Position >= rbBitmap->ui32AmountOfContainers || __RoaringBitmap_getContainer(rbBitmap, ui32Position)->ui16Key != ui16Key){
+      roaring_container_t rcNewContainer = {.vpData = NULL, .ui16Key = ui16Key, .ui16Cardinality = 0, .ui16Capacity = 1, .ui16AmountOfRuns = 0, .ui8Type = ROARING_CONTAINER_ARRAY};
+      rcNewContainer.vpData = DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, 1);
+      if (rcNewContainer.vpData == NULL){
+        return false;
+      }
+      *((uint16_t*) rcNewContainer.vpData) = ui16Value;
+      if (__RoaringBitmap_insertContainer(rbBitmap, ui32Position, &rcNewContainer) == false){
+        __RoaringBitmap_freeContainer(rbBitmap, &rcNewContainer);
+        return false;
+      }
+      return true;
+    }
+    rcpContainer = __RoaringBitmap_getContainer(rbBitmap, ui32Position);
+    if (__RoaringBitmap_containerContains(rcpContainer, ui16Value) == true){
+      return true;
+    }
+    if (__RoaringBitmap_toMutable(rbBitmap, rcpContainer) == false){
+      return false;
+    }
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY && __RoaringBitmap_getCardinality(rcpContainer) >= ROARING_BITMAP_ARRAY_LIMIT){
+      if (__RoaringBitmap_toBitmap(rbBitmap, rcpContainer) == false){
+        return false;
+      }
+    }
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      uint32_t ui32Cardinality = __RoaringBitmap_getCardinality(rcpContainer);
+      uint32_t ui32Position = 0;
+      uint16_t* ui16pValues = NULL;
+      if (ui32Cardinality == ((uint32_t) rcpContainer->ui16Capacity << 2)){
+        uint16_t ui16NewCapacity = (uint16_t) ((rcpContainer->ui16Capacity * 2 < __RoaringBitmap_getArrayCapacity(ROARING_BITMAP_ARRAY_LIMIT)) ? (rcpContainer->ui16Capacity * 2) : __RoaringBitmap_getArrayCapacity(ROARING_BITMAP_ARRAY_LIMIT));
+        void* vpNewValues = DataBank_mallocFrom(__RoaringBitmap_getDataBank(rbBitmap), ROARING_BITMAP_ELEMENT_SIZE, ui16NewCapacity);
+        if (vpNewValues == NULL){
+          return false;
+        }
+        memcpy(vpNewValues, rcpContainer->vpData, ui32Cardinality * sizeof(uint16_t));
+        __RoaringBitmap_freeContainer(rbBitmap, rcpContainer);
+        rcpContainer->vpData = vpNewValues;
+        rcpContainer->ui16Capacity = ui16NewCapacity;
+      }
+      ui16pValues = (uint16_t*) rcpContainer->vpData;
+      ui32Position = __RoaringBitmap_lowerBound(ui16pValues, ui32Cardinality, ui16Value);
+      memmove(&ui16pValues[ui32Position + 1], &ui16pValues[ui32Position], (ui32Cardinality - ui32Position) * sizeof(uint16_t));
+      ui16pValues[ui32Position] = ui16Value;
+    }
+    else{
+      ((uint64_t*) rcpContainer->vpData)[ui16Value >> 6] = ((uint64_t*) rcpContainer->vpData)[ui16Value >> 6] | ((uint64_t) 1 << (ui16Value & 63));
+    }
+    rcpContainer->ui16Cardinality++;
+    return true;
+  }
+
+  //! Function: Roaring Bitmap Removal
+  /*!
+    Removes a value from a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \param ui32Value is a unsigned 32-bit integer. It's the value.
+    \return Returns true if the value isn't in the bitmap or false if there is no memory.
+  */
+  bool RoaringBitmap_remove(roaring_t rbBitmap, uint32_t ui32Value){
+    uint16_t ui16Key = (uint16_t) (ui32Value >> 16);
+    uint16_t ui16Value = (uint16_t) ui32Value;
+    uint32_t ui32Position = __RoaringBitmap_findContainer(rbBitmap, ui16Key);
+    roaring_container_t* rcpContainer = NULL;
+    if (ui32Position >= rbBitmap->ui32AmountOfContainers || __RoaringBitmap_getContainer(rbBitmap, ui32Position)->ui16Key != ui16Key){
+      return true;
+    }
+    rcpContainer = __RoaringBitmap_getContainer(rbBitmap, ui32Position);
+    if (__RoaringBitmap_containerContains(rcpContainer, ui16Value) == false){
+      return true;
+    }
+    if (rcpContainer->ui16Cardinality == 0){
+      __RoaringBitmap_removeContainer(rbBitmap, ui32Position);
+      return true;
+    }
+    if (__RoaringBitmap_toMutable(rbBitmap, rcpContainer) == false){
+      return false;
+    }
+    if (rcpContainer->ui8Type == ROARING_CONTAINER_ARRAY){
+      uint16_t* ui16pValues = (uint16_t*) rcpContainer->vpData;
+      uint32_t ui32Position = __RoaringBitmap_lowerBound(ui16pValues, __RoaringBitmap_getCardinality(rcpContainer), ui16Value);
+      memmove(&ui16pValues[ui32Position], &ui16pValues[ui32Position + 1], (__RoaringBitmap_getCardinality(rcpContainer) - ui32Position - 1) * sizeof(uint16_t));
+      rcpContainer->ui16Cardinality--;
+    }
+    else{
+      ((uint64_t*) rcpContainer->vpData)[ui16Value >> 6] = ((uint64_t*) rcpContainer->vpData)[ui16Value >> 6] & ~((uint64_t) 1 << (ui16Value & 63));
+      rcpContainer->ui16Cardinality--;
+      if (__RoaringBitmap_getCardinality(rcpContainer) <= ROARING_BITMAP_ARRAY_LIMIT){
+        __RoaringBitmap_toArray(rbBitmap, rcpContainer);
+      }
+    }
+    return true;
+  }
+
+  //! Function: Roaring Bitmap Checker
+  /*!
+    Checks if a value is in a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \param ui32Value is a unsigned 32-bit integer. It's the value.
+    \return Returns true if the value is in the bitmap.
+  */
+  bool RoaringBitmap_contains(roaring_t rbBitmap, uint32_t ui32Value){
+    uint16_t ui16Key = (uint16_t) (ui32Value >> 16);
+    uint32_t ui32Position = __RoaringBitmap_findContainer(rbBitmap, ui16Key);
+    if (ui32Position >= rbBitmap->ui32AmountOfContainers || __RoaringBitmap_getContainer(rbBitmap, ui32Position)->ui16Key != ui16Key){
+      return false;
+    }
+    return __RoaringBitmap_containerContains(__RoaringBitmap_getContainer(rbBitmap, ui32Position), (uint16_t) ui32Value);
+  }
+
+  //! Function: Roaring Bitmap Cardinality
+  /*!
+    Counts the values of a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \return Returns the amount of values.
+  */
+  uint64_t RoaringBitmap_getCardinality(roaring_t rbBitmap){
+    uint32_t ui32Counter = 0;
+    uint64_t ui64Cardinality = 0;
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui32AmountOfContainers ; ui32Counter++){
+      ui64Cardinality = ui64Cardinality + __RoaringBitmap_getCardinality(__RoaringBitmap_getContainer(rbBitmap, ui32Counter));
+    }
+    return ui64Cardinality;
+  }
+
+  //! Function: Roaring Bitmap Memory Usage
+  /*!
+    Calculates the amount of data bank memory used by a roaring bitmap.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \return Returns the amount of bytes.
+  */
+  uint32_t RoaringBitmap_getMemoryUsage(roaring_t rbBitmap){
+    uint32_t ui32Counter = 0;
+    uint32_t ui32AmountOfElements = 0;
+    if (rbBitmap->rcppBlocks != NULL){
+      ui32AmountOfElements = __RoaringBitmap_getIndexCapacity(rbBitmap->ui16IndexCapacity);
+    }
+    if (rbBitmap->ui16AmountOfBlocks > 0){
+      ui32AmountOfElements = ui32AmountOfElements + __RoaringBitmap_getDirectoryCapacity(rbBitmap->ui16Capacity) + ((uint32_t) rbBitmap->ui16AmountOfBlocks - 1) * __RoaringBitmap_getDirectoryCapacity(ROARING_BITMAP_DIRECTORY_BLOCK_SIZE);
+    }
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui32AmountOfContainers ; ui32Counter++){
+      ui32AmountOfElements = ui32AmountOfElements + __RoaringBitmap_getContainer(rbBitmap, ui32Counter)->ui16Capacity;
+    }
+    return ui32AmountOfElements * ROARING_BITMAP_ELEMENT_SIZE;
+  }
+
+  //! Function: Roaring Bitmap Run Optimization
+  /*!
+    Converts each container to the smallest type: run containers for long sequences of values, arrays or bitmaps for the others.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \return Returns false if there is no memory for some conversion. The bitmap is still valid.
+  */
+  bool RoaringBitmap_runOptimize(roaring_t rbBitmap){
+    uint32_t ui32Counter = 0;
+    bool bResult = true;
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui32AmountOfContainers ; ui32Counter++){
+      roaring_container_t* rcpContainer = __RoaringBitmap_getContainer(rbBitmap, ui32Counter);
+      uint32_t ui32Cardinality = __RoaringBitmap_getCardinality(rcpContainer);
+      uint32_t ui32AmountOfRuns = __RoaringBitmap_countRuns(rcpContainer);
+      uint32_t ui32RunSize = __RoaringBitmap_getRunCapacity(ui32AmountOfRuns);
+      uint32_t ui32OtherSize = (ui32Cardinality <= ROARING_BITMAP_ARRAY_LIMIT) ? __RoaringBitmap_getArrayCapacity(ui32Cardinality) : __ROARING_BITMAP_WORDS__;
+      if (rcpContainer->ui8Type != ROARING_CONTAINER_RUN && ui32RunSize < ui32OtherSize){
+        bResult = bResult & __RoaringBitmap_toRun(rbBitmap, rcpContainer, ui32AmountOfRuns);
+      }
+      else if (rcpContainer->ui8Type == ROARING_CONTAINER_RUN && ui32RunSize >= ui32OtherSize){
+        bResult = bResult & __RoaringBitmap_toMutable(rbBitmap, rcpContainer);
+      }
+    }
+    return bResult;
+  }
+
+  //! Function: Roaring Bitmap Union
+  /*!
+    Makes rbDestination = rbBitmapA OR rbBitmapB. The destination is cleared first, so it must be other bitmap: an operand used as destination is rejected and left untouched.
+    \param rbDestination is a roaring_t type. It's the result bitmap.
+    \param rbBitmapA is a roaring_t type. It's the first operand.
+    \param rbBitmapB is a roaring_t type. It's the second operand.
+    \return Returns false if the destination is an operand or if there is no memory. In the last case, the destination has a part of the result.
+  */
+  bool RoaringBitmap_or(roaring_t rbDestination, roaring_t rbBitmapA, roaring_t rbBitmapB){
+    uint32_t ui32PositionA = 0;
+    uint32_t ui32PositionB = 0;
+    roaring_container_t rcResult;
+    if (rbDestination == rbBitmapA || rbDestination == rbBitmapB){
+      return false;
+    }
+    RoaringBitmap_clear(rbDestination);
+    while (ui32PositionA < rbBitmapA->ui32AmountOfContainers || ui32PositionB < rbBitmapB->ui32AmountOfContainers){
+      const roaring_container_t* rcpContainerA = (ui32PositionA < rbBitmapA->ui32AmountOfContainers) ? __RoaringBitmap_getContainer(rbBitmapA, ui32PositionA) : NULL;
+      const roaring_container_t* rcpContainerB = (ui32PositionB < rbBitmapB->ui32AmountOfContainers) ? __RoaringBitmap_getContainer(rbBitmapB, ui32PositionB) : NULL;
+      bool bResult = false;
+      if (rcpContainerB == NULL || (rcpContainerA != NULL && rcpContainerA->ui16Key < rcpContainerB->ui16Key)){
+        bResult = __RoaringBitmap_copyContainer(rbDestination, rcpContainerA, &rcResult);
+        ui32PositionA++;
+      }
+      else if (rcpContainerA == NULL || rcpContainerB->ui16Key < rcpContainerA->ui16Key){
+        bResult = __RoaringBitmap_copyContainer(rbDestination, rcpContainerB, &rcResult);
+        ui32PositionB++;
+      }
+      else{
+        bResult = __RoaringBitmap_uniteContainers(rbDestination, rcpContainerA, rcpContainerB, &rcResult);
+        ui32PositionA++;
+        ui32PositionB++;
+      }
+      if (bResult == false || __RoaringBitmap_appendContainer(rbDestination, &rcResult) == false){
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Function: Roaring Bitmap Intersection
+  /*!
+    Makes rbDestination = rbBitmapA AND rbBitmapB. The destination is cleared first, so it must be other bitmap: an operand used as destination is rejected and left untouched.
+    \param rbDestination is a roaring_t type. It's the result bitmap.
+    \param rbBitmapA is a roaring_t type. It's the first operand.
+    \param rbBitmapB is a roaring_t type. It's the second operand.
+    \return Returns false if the destination is an operand or if there is no memory. In the last case, the destination has a part of the result.
+  */
+  bool RoaringBitmap_and(roaring_t rbDestination, roaring_t rbBitmapA, roaring_t rbBitmapB){
+    uint32_t ui32PositionA = 0;
+    uint32_t ui32PositionB = 0;
+    roaring_container_t rcResult;
+    if (rbDestination == rbBitmapA || rbDestination == rbBitmapB){
+      return false;
+    }
+    RoaringBitmap_clear(rbDestination);
+    while (ui32PositionA < rbBitmapA->ui32AmountOfContainers && ui32PositionB < rbBitmapB->ui32AmountOfContainers){
+      const roaring_container_t* rcpContainerA = __RoaringBitmap_getContainer(rbBitmapA, ui32PositionA);
+      const roaring_container_t* rcpContainerB = __RoaringBitmap_getContainer(rbBitmapB, ui32PositionB);
+      if (rcpContainerA->ui16Key < rcpContainerB->ui16Key){
+        ui32PositionA++;
+      }
+      else if (rcpContainerB->ui16Key < rcpContainerA->ui16Key){
+        ui32PositionB++;
+      }
+      else{
+        ui32PositionA++;
+        ui32PositionB++;
+        if (__RoaringBitmap_intersectContainers(rbDestination, rcpContainerA, rcpContainerB, &rcResult) == false || __RoaringBitmap_appendContainer(rbDestination, &rcResult) == false){
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  //! Function: Roaring Bitmap Iterator
+  /*!
+    Calls a function for each value of a roaring bitmap, in increasing order.
+    \param rbBitmap is a roaring_t type. It's the roaring bitmap.
+    \param bfpCallback is a function pointer. It receives each value and vpContext; the iteration stops when it returns false.
+    \param vpContext is a void pointer. It's passed to the function.
+  */
+  void RoaringBitmap_forEach(roaring_t rbBitmap, bool (*bfpCallback)(uint32_t ui32Value, void* vpContext), void* vpContext){
+    uint32_t ui32Counter = 0;
+    for (ui32Counter = 0 ; ui32Counter < rbBitmap->ui32AmountOfContainers ; ui32Counter++){
+      if (__RoaringBitmap_forEachValue(__RoaringBitmap_getContainer(rbBitmap, ui32Counter), bfpCallback, vpContext) == false){
+        return;
+      }
+    }
+  }
+
+#endif
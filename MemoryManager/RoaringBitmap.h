@@ -0,0 +1,170 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __ROARING_BITMAP_HEADER__
+  #define __ROARING_BITMAP_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__) && defined(__DATA_BANK_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include "./DataBank.h"
+
+    //! Macro: Roaring Bitmap Element Size
+    /*!
+      All memory of a roaring bitmap (containers and directory) is allocated in elements of this size, so the data bank needs memory pools of 8-byte elements. The pools must be 8-byte aligned (MemoryPool_create aligns them).
+    */
+    #define ROARING_BITMAP_ELEMENT_SIZE 8
+
+    //! Macro: Array Container Limit
+    /*!
+      Maximum cardinality of an array container. Bigger containers become bitmaps (8 KiB).
+    */
+    #define ROARING_BITMAP_ARRAY_LIMIT 4096
+
+    //! Macro: Directory Block Size
+    /*!
+      The container directory is paged: an index of blocks of this amount of containers, so no directory allocation gets near the 16-bit data bank allocation size and all 65536 keys (the whole 32-bit range) fit. It must be a power of 2.
+    */
+    #define ROARING_BITMAP_DIRECTORY_BLOCK_SIZE 64
+
+    //! Enumeration Definition: Roaring Container Type
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef enum{
+      ROARING_CONTAINER_ARRAY = 0,
+      ROARING_CONTAINER_BITMAP,
+      ROARING_CONTAINER_RUN
+    } roaring_container_type_t;
+
+    //! Type Definition: Roaring Run
+    /*!
+      A run of consecutive values of a run container.
+    */
+    typedef struct{
+      uint16_t ui16Start;                         /*!< uint16_t integer type variable. */
+      uint16_t ui16Length;                        /*!< uint16_t integer type variable. It's the amount of values - 1. */
+    } roaring_run_t;
+
+    //! Type Definition: Roaring Container
+    /*!
+      A container keeps the 16 low bits of the values of a 64K chunk. The chunk is given by ui16Key (16 high bits).
+    */
+    typedef struct{
+      void* vpData;                               /*!< void pointer type variable. */
+      uint16_t ui16Key;                           /*!< uint16_t integer type variable. */
+      uint16_t ui16Cardinality;                   /*!< uint16_t integer type variable. It's the cardinality - 1. */
+      uint16_t ui16Capacity;                      /*!< uint16_t integer type variable. It's the amount of allocated elements. */
+      uint16_t ui16AmountOfRuns;                  /*!< uint16_t integer type variable. */
+      uint8_t ui8Type;                            /*!< uint8_t integer type variable (roaring_container_type_t). */
+    } roaring_container_t;
+
+    //! Type Definition: Roaring Bitmap Structure
+    /*!
+      Compressed bitmap of 32-bit values: a directory of containers sorted by key. Each container is an array (up to ROARING_BITMAP_ARRAY_LIMIT sorted values), a bitmap (65536 bits) or a list of runs.
+      The directory holds up to 65536 containers (every 16-bit key), in blocks of ROARING_BITMAP_DIRECTORY_BLOCK_SIZE containers; the first block starts with 4 containers and doubles. The only limit is the memory of the data bank.
+    */
+    typedef struct{
+      databank_t dbDataBank;                      /*!< databank_t type variable. */
+      roaring_container_t** rcppBlocks;           /*!< roaring_container_t pointer pointer type variable. It's the directory index. */
+      uint32_t ui32AmountOfContainers;            /*!< uint32_t integer type variable. */
+      uint16_t ui16AmountOfBlocks;                /*!< uint16_t integer type variable. */
+      uint16_t ui16IndexCapacity;                 /*!< uint16_t integer type variable. It's the amount of blocks the index can keep. */
+      uint16_t ui16Capacity;                      /*!< uint16_t integer type variable. It's the amount of containers of the first block. */
+    } roaring_structure_t;
+
+    //! Type Definition: roaring_t
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef roaring_structure_t* roaring_t;
+
+    //! Macro: Roaring Bitmap Creator
+    /*!
+      Constructs an empty roaring bitmap. It uses dbDefaultDataBank until RoaringBitmap_setDataBank is called.
+      \param rbName is a roaring bitmap name.
+    */
+    #define newRoaringBitmap(rbName)\
+      roaring_structure_t __rbsRoaringBitmapStructure##rbName = {\
+        .dbDataBank = NULL,\
+        .rcppBlocks = NULL,\
+        .ui32AmountOfContainers = 0,\
+        .ui16AmountOfBlocks = 0,\
+        .ui16IndexCapacity = 0,\
+        .ui16Capacity = 0\
+      };\
+      roaring_t rbName = &__rbsRoaringBitmapStructure##rbName
+
+    //! Macro: Static Roaring Bitmap Creator
+    /*!
+      Constructs a static empty roaring bitmap. It uses dbDefaultDataBank until RoaringBitmap_setDataBank is called.
+      \param rbName is a roaring bitmap name.
+    */
+    #define newStaticRoaringBitmap(rbName)\
+      static roaring_structure_t __rbsRoaringBitmapStructure##rbName = {\
+        .dbDataBank = NULL,\
+        .rcppBlocks = NULL,\
+        .ui32AmountOfContainers = 0,\
+        .ui16AmountOfBlocks = 0,\
+        .ui16IndexCapacity = 0,\
+        .ui16Capacity = 0\
+      };\
+      static roaring_t rbName = &__rbsRoaringBitmapStructure##rbName
+
+    void RoaringBitmap_setDataBank(roaring_t rbBitmap, databank_t dbDataBank);                                                      /*!< void type function. */
+    void RoaringBitmap_clear(roaring_t rbBitmap);                                                                                   /*!< void type function. */
+    bool RoaringBitmap_add(roaring_t rbBitmap, uint32_t ui32Value);                                                                 /*!< bool type function. */
+    bool RoaringBitmap_remove(roaring_t rbBitmap, uint32_t ui32Value);                                                              /*!< bool type function. */
+    bool RoaringBitmap_contains(roaring_t rbBitmap, uint32_t ui32Value);                                                            /*!< bool type function. */
+    uint64_t RoaringBitmap_getCardinality(roaring_t rbBitmap);                                                                      /*!< 64-bits integer type function. */
+    uint32_t RoaringBitmap_getMemoryUsage(roaring_t rbBitmap);                                                                      /*!< 32-bits integer type function. */
+    bool RoaringBitmap_runOptimize(roaring_t rbBitmap);                                                                             /*!< bool type function. */
+    bool RoaringBitmap_or(roaring_t rbDestination, roaring_t rbBitmapA, roaring_t rbBitmapB);                                       /*!< bool type function. */
+    bool RoaringBitmap_and(roaring_t rbDestination, roaring_t rbBitmapA, roaring_t rbBitmapB);                                      /*!< bool type function. */
+    void RoaringBitmap_forEach(roaring_t rbBitmap, bool (*bfpCallback)(uint32_t ui32Value, void* vpContext), void* vpContext);     /*!< void type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
@@ -0,0 +1,343 @@
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__) && defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+
+  #include "./SPSC.h"
+  #include <string.h>
+
+  //! Private Function: Counter Increment
+  /*!
+    Advance a counter of a single-producer/single-consumer buffer. The counters wrap at twice the buffer size.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \param ui32BufferSize is a 32-bits integer. It's the buffer size.
+    \return Returns the next counter.
+  */
+  static inline uint32_t __SPSCBuffer_increment(uint32_t ui32Counter, uint32_t ui32BufferSize){
+    ui32Counter++;
+    return (ui32Counter == 2 * ui32BufferSize) ? 0 : ui32Counter;
+  }
+
+  //! Private Function: Counter Addition
+  /*!
+    Advance a counter of a single-producer/single-consumer buffer by some slots, up to the buffer size.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \param ui32Amount is a 32-bits integer. It's the amount of slots.
+    \param ui32BufferSize is a 32-bits integer. It's the buffer size.
+    \return Returns the new counter.
+  */
+  static inline uint32_t __SPSCBuffer_add(uint32_t ui32Counter, uint32_t ui32Amount, uint32_t ui32BufferSize){
+    ui32Counter = ui32Counter + ui32Amount;
+    return (ui32Counter >= 2 * ui32BufferSize) ? ui32Counter - 2 * ui32BufferSize : ui32Counter;
+  }
+
+  //! Private Function: Counter Position
+  /*!
+    Get the slot position of a counter.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \param ui32BufferSize is a 32-bits integer. It's the buffer size.
+    \return Returns the position.
+  */
+  static inline uint8_t __SPSCBuffer_getPosition(uint32_t ui32Counter, uint32_t ui32BufferSize){
+    return (uint8_t) ((ui32Counter >= ui32BufferSize) ? ui32Counter - ui32BufferSize : ui32Counter);
+  }
+
+  //! Private Function: Counter Distance
+  /*!
+    Calculate the amount of data between a read counter and a write counter.
+    \param ui32WriteCounter is a 32-bits integer. It's the write counter.
+    \param ui32ReadCounter is a 32-bits integer. It's the read counter.
+    \param ui32BufferSize is a 32-bits integer. It's the buffer size.
+    \return Returns the amount of data.
+  */
+  static inline uint32_t __SPSCBuffer_distance(uint32_t ui32WriteCounter, uint32_t ui32ReadCounter, uint32_t ui32BufferSize){
+    return (ui32WriteCounter >= ui32ReadCounter) ? ui32WriteCounter - ui32ReadCounter : 2 * ui32BufferSize + ui32WriteCounter - ui32ReadCounter;
+  }
+
+  //! Private Function: Slot Address
+  /*!
+    Get the address of the slot of a counter.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \return Returns the slot address.
+  */
+  static inline void* __SPSCBuffer_getSlot(buffer_t bfBuffer, uint32_t ui32Counter){
+    return (char*) bfBuffer->vpVector + __SPSCBuffer_getPosition(ui32Counter, bfBuffer->ui8BufferSize) * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Read Slot Acquirer
+  /*!
+    Get the counter of the next pending data for the consumer. The slot of the last Buffer_popAddress is released here.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui32pCounter is a 32-bits integer pointer. It receives the counter of the pending data.
+    \return Returns true if there is a pending data.
+  */
+  static inline bool __SPSCBuffer_acquire(buffer_t bfBuffer, uint32_t* ui32pCounter){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32Counter = biIndexes->ui32PopCounter;
+    if (ui32Counter != biIndexes->ui32ReadCounter){
+      __atomic_store_n(&biIndexes->ui32ReadCounter, ui32Counter, __ATOMIC_RELEASE);
+    }
+    if (ui32Counter == biIndexes->ui32CachedWriteCounter){
+      biIndexes->ui32CachedWriteCounter = __atomic_load_n(&biIndexes->ui32WriteCounter, __ATOMIC_ACQUIRE);
+      if (ui32Counter == biIndexes->ui32CachedWriteCounter){
+        return false;
+      }
+      __Buffer_updateHighWaterMark(bfBuffer, __SPSCBuffer_distance(biIndexes->ui32CachedWriteCounter, ui32Counter, bfBuffer->ui8BufferSize));
+    }
+    *ui32pCounter = ui32Counter;
+    return true;
+  }
+
+  //! Private Function: SPSC Buffer Writer
+  /*!
+    Write a data on a single-producer/single-consumer buffer. Only one thread can call it. The high-water mark is sampled when the read counter is reloaded.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the buffer is full.
+  */
+  bool __SPSCBuffer_push(buffer_t bfBuffer, void* vpData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32WriteCounter;
+    if (__SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize) == ui32BufferSize){
+      biIndexes->ui32CachedReadCounter = __atomic_load_n(&biIndexes->ui32ReadCounter, __ATOMIC_ACQUIRE);
+      uint32_t ui32Pending = __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+      if (ui32Pending == ui32BufferSize){
+        __Buffer_updateHighWaterMark(bfBuffer, ui32BufferSize);
+        return false;
+      }
+      __Buffer_updateHighWaterMark(bfBuffer, ui32Pending + 1);
+    }
+    void* vpAdressBuffer = __SPSCBuffer_getSlot(bfBuffer, ui32Counter);
+    if (vpData != NULL){
+      memcpy(vpAdressBuffer, vpData, bfBuffer->ui8ElementSize);
+    }
+    else{
+      memset(vpAdressBuffer, 0, bfBuffer->ui8ElementSize);
+    }
+    __atomic_store_n(&biIndexes->ui32WriteCounter, __SPSCBuffer_increment(ui32Counter, ui32BufferSize), __ATOMIC_RELEASE);
+    return true;
+  }
+
+  //! Private Function: SPSC Buffer Reader
+  /*!
+    Read data on a single-producer/single-consumer buffer. Only one thread can call it. The slot is kept until the next pop, so the producer can't overwrite it while the consumer is reading.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns the adress of data on the buffer or NULL if it's empty.
+  */
+  void* __SPSCBuffer_pop(buffer_t bfBuffer){
+    uint32_t ui32Counter;
+    if (__SPSCBuffer_acquire(bfBuffer, &ui32Counter) == false){
+      return NULL;
+    }
+    __atomic_store_n(&bfBuffer->biIndexes->ui32PopCounter, __SPSCBuffer_increment(ui32Counter, bfBuffer->ui8BufferSize), __ATOMIC_RELAXED);
+    return __SPSCBuffer_getSlot(bfBuffer, ui32Counter);
+  }
+
+  //! Private Function: SPSC Buffer Copy Reader
+  /*!
+    Copy a data of a single-producer/single-consumer buffer and release its slot to the producer.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \return Returns false if the buffer is empty.
+  */
+  bool __SPSCBuffer_tryPop(buffer_t bfBuffer, void* vpData){
+    uint32_t ui32Counter;
+    if (__SPSCBuffer_acquire(bfBuffer, &ui32Counter) == false){
+      return false;
+    }
+    memcpy(vpData, __SPSCBuffer_getSlot(bfBuffer, ui32Counter), bfBuffer->ui8ElementSize);
+    ui32Counter = __SPSCBuffer_increment(ui32Counter, bfBuffer->ui8BufferSize);
+    __atomic_store_n(&bfBuffer->biIndexes->ui32PopCounter, ui32Counter, __ATOMIC_RELAXED);
+    __atomic_store_n(&bfBuffer->biIndexes->ui32ReadCounter, ui32Counter, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  //! Private Function: SPSC Amount of Pending Data Getter
+  /*!
+    Get the amount of pending data seen by the consumer. On the producer thread, the value can be bigger than the real amount.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns the amount of pending data.
+  */
+  uint8_t __SPSCBuffer_getAmountOfPendingData(buffer_t bfBuffer){
+    uint32_t ui32WriteCounter = __atomic_load_n(&bfBuffer->biIndexes->ui32WriteCounter, __ATOMIC_ACQUIRE);
+    uint32_t ui32PopCounter = __atomic_load_n(&bfBuffer->biIndexes->ui32PopCounter, __ATOMIC_RELAXED);
+    return (uint8_t) __SPSCBuffer_distance(ui32WriteCounter, ui32PopCounter, bfBuffer->ui8BufferSize);
+  }
+
+  //! Private Function: SPSC Write Position Getter
+  /*!
+    Get the write position of a single-producer/single-consumer buffer.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns write position.
+  */
+  uint8_t __SPSCBuffer_getWritePosition(buffer_t bfBuffer){
+    return __SPSCBuffer_getPosition(__atomic_load_n(&bfBuffer->biIndexes->ui32WriteCounter, __ATOMIC_RELAXED), bfBuffer->ui8BufferSize);
+  }
+
+  //! Private Function: SPSC Read Position Getter
+  /*!
+    Get the read position of a single-producer/single-consumer buffer.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \return Returns read position.
+  */
+  uint8_t __SPSCBuffer_getReadPosition(buffer_t bfBuffer){
+    return __SPSCBuffer_getPosition(__atomic_load_n(&bfBuffer->biIndexes->ui32PopCounter, __ATOMIC_RELAXED), bfBuffer->ui8BufferSize);
+  }
+
+  //! Private Function: SPSC Buffer Cleaner
+  /*!
+    Clean a single-producer/single-consumer buffer. The producer and the consumer must be stopped.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+  */
+  void __SPSCBuffer_clear(buffer_t bfBuffer){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    biIndexes->ui32CachedReadCounter = 0;
+    biIndexes->ui32CachedWriteCounter = 0;
+    biIndexes->ui32PopCounter = 0;
+    __atomic_store_n(&biIndexes->ui32ReadCounter, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&biIndexes->ui32WriteCounter, 0, __ATOMIC_RELEASE);
+  }
+
+  //! Private Function: SPSC Buffer Bulk Writer
+  /*!
+    Write the data that fits on a single-producer/single-consumer buffer and publish it at once. Only one thread can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a const void pointer. It's the vector of data (or NULL to insert zeros).
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data written.
+  */
+  uint32_t __SPSCBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32WriteCounter;
+    uint32_t ui32Free = ui32BufferSize - __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+    if (ui32Free < ui32AmountOfData){
+      biIndexes->ui32CachedReadCounter = __atomic_load_n(&biIndexes->ui32ReadCounter, __ATOMIC_ACQUIRE);
+      ui32Free = ui32BufferSize - __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+      __Buffer_updateHighWaterMark(bfBuffer, (ui32AmountOfData > ui32Free) ? ui32BufferSize : ui32BufferSize - ui32Free + ui32AmountOfData);
+    }
+    uint8_t ui8Amount = (uint8_t) ((ui32AmountOfData > ui32Free) ? ui32Free : ui32AmountOfData);
+    __Buffer_writeSlots(bfBuffer, __SPSCBuffer_getPosition(ui32Counter, ui32BufferSize), ui32BufferSize, vpData, ui8Amount);
+    __atomic_store_n(&biIndexes->ui32WriteCounter, __SPSCBuffer_add(ui32Counter, ui8Amount, ui32BufferSize), __ATOMIC_RELEASE);
+    return ui8Amount;
+  }
+
+  //! Private Function: SPSC Buffer Bulk Reader
+  /*!
+    Copy the pending data of a single-producer/single-consumer buffer and release all their slots at once. Only one thread can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfData is a 32-bits integer. It's the maximum amount of data.
+    \return Returns the amount of data read.
+  */
+  uint32_t __SPSCBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32PopCounter;
+    uint32_t ui32Pending = __SPSCBuffer_distance(biIndexes->ui32CachedWriteCounter, ui32Counter, ui32BufferSize);
+    if (ui32Pending < ui32AmountOfData){
+      biIndexes->ui32CachedWriteCounter = __atomic_load_n(&biIndexes->ui32WriteCounter, __ATOMIC_ACQUIRE);
+      ui32Pending = __SPSCBuffer_distance(biIndexes->ui32CachedWriteCounter, ui32Counter, ui32BufferSize);
+      __Buffer_updateHighWaterMark(bfBuffer, ui32Pending);
+    }
+    uint8_t ui8Amount = (uint8_t) ((ui32AmountOfData > ui32Pending) ? ui32Pending : ui32AmountOfData);
+    __Buffer_readSlots(bfBuffer, __SPSCBuffer_getPosition(ui32Counter, ui32BufferSize), ui32BufferSize, vpData, ui8Amount);
+    ui32Counter = __SPSCBuffer_add(ui32Counter, ui8Amount, ui32BufferSize);
+    __atomic_store_n(&biIndexes->ui32PopCounter, ui32Counter, __ATOMIC_RELAXED);
+    if (ui32Counter != biIndexes->ui32ReadCounter){
+      __atomic_store_n(&biIndexes->ui32ReadCounter, ui32Counter, __ATOMIC_RELEASE);
+    }
+    return ui8Amount;
+  }
+
+  //! Private Function: SPSC Buffer Slots Reserver
+  /*!
+    Get the contiguous free slots after the write counter of a single-producer/single-consumer buffer. Only the producer can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It's the desirable amount of slots and receives the amount of slots reserved.
+    \return Returns the address of the first slot or NULL if the buffer is full.
+  */
+  void* __SPSCBuffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32WriteCounter;
+    uint32_t ui32Free = ui32BufferSize - __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+    if (ui32Free < *ui8pAmountOfData){
+      biIndexes->ui32CachedReadCounter = __atomic_load_n(&biIndexes->ui32ReadCounter, __ATOMIC_ACQUIRE);
+      ui32Free = ui32BufferSize - __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+    }
+    uint8_t ui8Position = __SPSCBuffer_getPosition(ui32Counter, ui32BufferSize);
+    if (ui32Free > ui32BufferSize - ui8Position){
+      ui32Free = ui32BufferSize - ui8Position;
+    }
+    if (ui32Free < *ui8pAmountOfData){
+      *ui8pAmountOfData = (uint8_t) ui32Free;
+    }
+    if (*ui8pAmountOfData == 0){
+      return NULL;
+    }
+    return (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: SPSC Buffer Slots Committer
+  /*!
+    Publish reserved slots of a single-producer/single-consumer buffer to the consumer. Only the producer can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of slots written, up to the amount reserved.
+  */
+  void __SPSCBuffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32WriteCounter;
+    uint32_t ui32Free = ui32BufferSize - __SPSCBuffer_distance(ui32Counter, biIndexes->ui32CachedReadCounter, ui32BufferSize);
+    if (ui8AmountOfData > ui32Free){
+      ui8AmountOfData = (uint8_t) ui32Free;
+    }
+    __atomic_store_n(&biIndexes->ui32WriteCounter, __SPSCBuffer_add(ui32Counter, ui8AmountOfData, ui32BufferSize), __ATOMIC_RELEASE);
+  }
+
+  //! Private Function: SPSC Buffer Data Peeker
+  /*!
+    Get the contiguous pending data of a single-producer/single-consumer buffer, without releasing it. Only the consumer can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8pAmountOfData is a 8-bits integer pointer. It receives the amount of contiguous pending data.
+    \return Returns the address of the oldest data or NULL if the buffer is empty.
+  */
+  void* __SPSCBuffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32PopCounter;
+    biIndexes->ui32CachedWriteCounter = __atomic_load_n(&biIndexes->ui32WriteCounter, __ATOMIC_ACQUIRE);
+    uint32_t ui32Pending = __SPSCBuffer_distance(biIndexes->ui32CachedWriteCounter, ui32Counter, ui32BufferSize);
+    uint8_t ui8Position = __SPSCBuffer_getPosition(ui32Counter, ui32BufferSize);
+    if (ui32Pending > ui32BufferSize - ui8Position){
+      ui32Pending = ui32BufferSize - ui8Position;
+    }
+    *ui8pAmountOfData = (uint8_t) ui32Pending;
+    if (ui32Pending == 0){
+      return NULL;
+    }
+    return (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: SPSC Buffer Data Consumer
+  /*!
+    Release the oldest data of a single-producer/single-consumer buffer to the producer. Only the consumer can call it.
+    \param bfBuffer is a buffer_t type. This parameter is the address of buffer.
+    \param ui8AmountOfData is a 8-bits integer. It's the amount of data, up to the amount of pending data.
+  */
+  void __SPSCBuffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData){
+    bufferindexes_t biIndexes = bfBuffer->biIndexes;
+    uint32_t ui32BufferSize = bfBuffer->ui8BufferSize;
+    uint32_t ui32Counter = biIndexes->ui32PopCounter;
+    uint32_t ui32Pending = __SPSCBuffer_distance(biIndexes->ui32CachedWriteCounter, ui32Counter, ui32BufferSize);
+    if (ui8AmountOfData > ui32Pending){
+      ui8AmountOfData = (uint8_t) ui32Pending;
+    }
+    ui32Counter = __SPSCBuffer_add(ui32Counter, ui8AmountOfData, ui32BufferSize);
+    __atomic_store_n(&biIndexes->ui32PopCounter, ui32Counter, __ATOMIC_RELAXED);
+    __atomic_store_n(&biIndexes->ui32ReadCounter, ui32Counter, __ATOMIC_RELEASE);
+  }
+
+#endif
@@ -0,0 +1,66 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __SPSC_HEADER__
+  #define __SPSC_HEADER__
+
+  #include "./Buffer.h"
+
+  #if defined(__BUFFER_MANAGER_ENABLE__) && defined(__BUFFER_CONCURRENT_ENABLE__) && (defined(__GNUC__) || defined(__clang__))
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    bool __SPSCBuffer_push(buffer_t bfBuffer, void* vpData);                    /*!< bool type function. */
+    void* __SPSCBuffer_pop(buffer_t bfBuffer);                                  /*!< void pointer type function. */
+    uint32_t __SPSCBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
+    uint32_t __SPSCBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData); /*!< 32-bits integer type. */
+    void* __SPSCBuffer_reserve(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);   /*!< void pointer type function. */
+    void __SPSCBuffer_commit(buffer_t bfBuffer, uint8_t ui8AmountOfData);       /*!< void type function. */
+    void* __SPSCBuffer_peek(buffer_t bfBuffer, uint8_t* ui8pAmountOfData);      /*!< void pointer type function. */
+    void __SPSCBuffer_consume(buffer_t bfBuffer, uint8_t ui8AmountOfData);      /*!< void type function. */
+    bool __SPSCBuffer_tryPop(buffer_t bfBuffer, void* vpData);                  /*!< bool type function. */
+    uint8_t __SPSCBuffer_getAmountOfPendingData(buffer_t bfBuffer);             /*!< 8-bits integer type. */
+    uint8_t __SPSCBuffer_getWritePosition(buffer_t bfBuffer);                   /*!< 8-bits integer type. */
+    uint8_t __SPSCBuffer_getReadPosition(buffer_t bfBuffer);                    /*!< 8-bits integer type. */
+    void __SPSCBuffer_clear(buffer_t bfBuffer);                                 /*!< void type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
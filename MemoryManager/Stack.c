@@ -10,25 +10,21 @@
     Write a data on a stack buffer.
     \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of circular buffer.
     \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    \return Returns false if the buffer is full and its overflow policy discards the new data.
   */
-  void __StackBuffer_push(buffer_t bfBuffer, void* vpData){
-    bfBuffer->ui8ReadPosition = bfBuffer->ui8WritePosition;
-    void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8WritePosition * bfBuffer->ui8ElementSize;
+  bool __StackBuffer_push(buffer_t bfBuffer, void* vpData){
+    uint8_t ui8Position = __StackBuffer_nextWritePosition(bfBuffer);
+    if (ui8Position == __BUFFER_DISCARDED_POSITION__){
+      return false;
+    }
+    void* vpAdressBuffer = (char*) bfBuffer->vpVector + ui8Position * bfBuffer->ui8ElementSize;
     if (vpData != NULL){
       memcpy(vpAdressBuffer, vpData, bfBuffer->ui8ElementSize);
     }
     else{
       memset(vpAdressBuffer, 0, bfBuffer->ui8ElementSize);
     }
-    if (bfBuffer->ui8WritePosition == bfBuffer->ui8BufferSize - 1){
-      bfBuffer->ui8WritePosition = 0;
-    }
-    else{
-      bfBuffer->ui8WritePosition++;
-    }
-    if (bfBuffer->ui8AmountOfData < bfBuffer->ui8BufferSize){
-      bfBuffer->ui8AmountOfData++;
-    }
+    return true;
   }
 
   //! Private Function: Circular Buffer Reader
@@ -38,20 +34,60 @@
     \return Returns the adress of data on the buffer.
   */
   void* __StackBuffer_pop(buffer_t bfBuffer){
-    if (bfBuffer->ui8AmountOfData > 0){
-      void* vpAdressBuffer = (char*) bfBuffer->vpVector + bfBuffer->ui8ReadPosition * bfBuffer->ui8ElementSize;
-      if (bfBuffer->ui8ReadPosition == 0){
-        bfBuffer->ui8ReadPosition = bfBuffer->ui8BufferSize - 1;
-      }
-      else{
-        bfBuffer->ui8ReadPosition--;
+    if (bfBuffer->ui8AmountOfData == 0){
+      return NULL;
+    }
+    return (char*) bfBuffer->vpVector + __StackBuffer_nextReadPosition(bfBuffer) * bfBuffer->ui8ElementSize;
+  }
+
+  //! Private Function: Stack Buffer Bulk Writer
+  /*!
+    Write some data on a stack buffer. If the buffer overflows, the oldest data is overwritten.
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of stack buffer.
+    \param vpData is a const void pointer. It's the vector of data (or NULL to insert zeros).
+    \param ui32AmountOfData is a 32-bits integer. It's the amount of data.
+    \return Returns the amount of data.
+  */
+  uint32_t __StackBuffer_pushN(buffer_t bfBuffer, const void* vpData, uint32_t ui32AmountOfData){
+    if (ui32AmountOfData == 0){
+      return 0;
+    }
+    uint8_t ui8Amount = (ui32AmountOfData > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : (uint8_t) ui32AmountOfData;
+    uint32_t ui32Position = bfBuffer->ui8WritePosition;
+    if (ui32AmountOfData > ui8Amount){
+      ui32Position = (ui32Position + ui32AmountOfData - ui8Amount) % bfBuffer->ui8BufferSize;                                     /*!< The overwritten data is skipped. */
+      if (vpData != NULL){
+        vpData = (const char*) vpData + (ui32AmountOfData - ui8Amount) * bfBuffer->ui8ElementSize;
       }
-      bfBuffer->ui8AmountOfData--;
-      return vpAdressBuffer;
     }
-    else{
-      return NULL;
+    __Buffer_writeSlots(bfBuffer, (uint8_t) ui32Position, bfBuffer->ui8BufferSize, vpData, ui8Amount);
+    ui32Position = ui32Position + ui8Amount;
+    bfBuffer->ui8WritePosition = (uint8_t) ((ui32Position >= bfBuffer->ui8BufferSize) ? ui32Position - bfBuffer->ui8BufferSize : ui32Position);
+    bfBuffer->ui8ReadPosition = (bfBuffer->ui8WritePosition == 0) ? bfBuffer->ui8BufferSize - 1 : bfBuffer->ui8WritePosition - 1;
+    ui32Position = bfBuffer->ui8AmountOfData + ui8Amount;
+    bfBuffer->ui8AmountOfData = (uint8_t) ((ui32Position > bfBuffer->ui8BufferSize) ? bfBuffer->ui8BufferSize : ui32Position);
+    return ui32AmountOfData;
+  }
+
+  //! Private Function: Stack Buffer Bulk Reader
+  /*!
+    Read the newest data of a stack buffer. The data is copied in the order it was pushed (the newest data is the last one).
+    \param bfBuffer is a buffer_handler_t pointer. This parameter is the address of stack buffer.
+    \param vpData is a void pointer. It receives the data.
+    \param ui32AmountOfData is a 32-bits integer. It's the maximum amount of data.
+    \return Returns the amount of data read.
+  */
+  uint32_t __StackBuffer_popN(buffer_t bfBuffer, void* vpData, uint32_t ui32AmountOfData){
+    uint8_t ui8Amount = (ui32AmountOfData > bfBuffer->ui8AmountOfData) ? bfBuffer->ui8AmountOfData : (uint8_t) ui32AmountOfData;
+    if (ui8Amount == 0){
+      return 0;
     }
+    int32_t i32Position = bfBuffer->ui8ReadPosition - (ui8Amount - 1);
+    uint8_t ui8Position = (uint8_t) ((i32Position < 0) ? i32Position + bfBuffer->ui8BufferSize : i32Position);
+    __Buffer_readSlots(bfBuffer, ui8Position, bfBuffer->ui8BufferSize, vpData, ui8Amount);
+    bfBuffer->ui8ReadPosition = (ui8Position == 0) ? bfBuffer->ui8BufferSize - 1 : ui8Position - 1;
+    bfBuffer->ui8AmountOfData = bfBuffer->ui8AmountOfData - ui8Amount;
+    return ui8Amount;
   }
 
 #endif
@@ -43,6 +43,14 @@
   #pragma message "Bit vector manager disabled!"
 #endif
 
+//! System Message: Bit Vector Word Size Error
+/*!
+  Please don't modify this.
+*/
+#if (defined(__BIT_VECTOR_MANAGER_ENABLE__) && (__BIT_VECTOR_WORD_SIZE__ != 8) && (__BIT_VECTOR_WORD_SIZE__ != 16) && (__BIT_VECTOR_WORD_SIZE__ != 32) && (__BIT_VECTOR_WORD_SIZE__ != 64))
+  #error Invalid __BIT_VECTOR_WORD_SIZE__ value!
+#endif
+
 //! System Message: Memory Pool Manager Status
 /*!
   Please don't modify this.
@@ -59,6 +67,14 @@
   #pragma message "Data bank manager disabled!"
 #endif
 
+//! System Message: Data Bank Profiler Status
+/*!
+  Please don't modify this.
+*/
+#if (defined(__MEMORY_POOL_MANAGER_ENABLE__) && defined(__DATA_BANK_MANAGER_ENABLE__) && defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__DATA_BANK_PROFILER_ENABLE__))
+  #pragma message "Data bank profiler enabled! Disable it on production firmwares."
+#endif
+
 //! System Message: Buffer Manager Status
 /*!
   Please don't modify this.
@@ -0,0 +1,269 @@
+#include "./Configs.h"
+
+#if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__) && defined(__MEMORY_POOL_TELEMETRY_ENABLE__)
+
+  #include "./Telemetry.h"
+  #include <stdio.h>
+  #include <stdarg.h>
+
+  //! Type Definition: Telemetry Entry
+  /*!
+    A memory pool and its name.
+  */
+  typedef struct{
+    mpool_t mpMemoryPool;                         /*!< mpool_t type variable. */
+    const char* cpName;                           /*!< const char pointer type variable. */
+  } telemetry_entry_t;
+
+  #if defined(__DATA_BANK_MANAGER_ENABLE__)
+    #include "./DataBank.h"
+
+    //! Telemetry: Data Bank Pool Names
+    /*!
+      Names of the __DATA_BANK_POOL_LIST__ pools, in the order they are registered on the default data bank.
+    */
+    static const char* const __cpDataBankPoolNames[] = {
+      #define X(mpMemoryPoolName, ui8DataPoolSize, ui16MemoryPoolSize)\
+        #mpMemoryPoolName,
+
+        __DATA_BANK_POOL_LIST__
+      #undef X
+    };
+
+    //! Macro: Amount of Data Bank Pools
+    /*!
+      Maximum amount of memory pools of the default data bank (listed and spare pools).
+    */
+    #define __TELEMETRY_AMOUNT_OF_DATA_BANK_POOLS__\
+      ((sizeof(__cpDataBankPoolNames)/sizeof(const char*)) + __DATA_BANK_SPARE_POOLS__)
+  #else
+    #define __TELEMETRY_AMOUNT_OF_DATA_BANK_POOLS__ 0
+  #endif
+
+  #if defined(__TYPED_LIST_MANAGER_ENABLE__)
+    #include "./TypedList.h"
+  #endif
+
+  #if defined(__UNTYPED_LIST_MANAGER_ENABLE__)
+    #include "./UntypedList.h"
+  #endif
+
+  //! Macro: Maximum Amount of Pools
+  /*!
+    Maximum amount of memory pools in telemetry: the default data bank pools, the list pools and the user pools.
+  */
+  #define __TELEMETRY_MAX_AMOUNT_OF_POOLS__\
+    (__TELEMETRY_AMOUNT_OF_DATA_BANK_POOLS__ + 2 + __MEMORY_POOL_TELEMETRY_SIZE__)
+
+  //! Telemetry: User Pools Table
+  /*!
+    Table of the memory pools registered by Telemetry_registerPool.
+  */
+  static telemetry_entry_t __tepRegisteredPools[__MEMORY_POOL_TELEMETRY_SIZE__];
+  static uint8_t __ui8AmountOfRegisteredPools = 0;
+
+  //! Function: Telemetry Pool Register
+  /*!
+    Registers a user memory pool in telemetry. The library memory pools (DataBank and lists) are already registered.
+    \param mpMemoryPool is a mpool_t type. It's the memory pool.
+    \param cpName is a string. It's the name of the memory pool on the reports. It must be a valid metric label (no quotes).
+    \return Returns TELEMETRY_STATUS_POOL_REGISTERED or TELEMETRY_STATUS_POOL_NOT_REGISTERED.
+  */
+  telemetry_status_t Telemetry_registerPool(mpool_t mpMemoryPool, const char* cpName){
+    if (mpMemoryPool == NULL || cpName == NULL || __ui8AmountOfRegisteredPools >= __MEMORY_POOL_TELEMETRY_SIZE__){
+      return TELEMETRY_STATUS_POOL_NOT_REGISTERED;
+    }
+    __tepRegisteredPools[__ui8AmountOfRegisteredPools].mpMemoryPool = mpMemoryPool;
+    __tepRegisteredPools[__ui8AmountOfRegisteredPools].cpName = cpName;
+    __ui8AmountOfRegisteredPools++;
+    return TELEMETRY_STATUS_POOL_REGISTERED;
+  }
+
+  //! Private Function: Amount of Library Pools Getter
+  /*!
+    Gets the amount of memory pools created by this library: the pools of the default data bank and the list element pools.
+    \return Returns the amount of library memory pools.
+  */
+  static uint8_t __Telemetry_getAmountOfLibraryPools(void){
+    uint8_t ui8AmountOfPools = 0;
+    #if defined(__DATA_BANK_MANAGER_ENABLE__)
+      ui8AmountOfPools = DataBank_getAmountOfPools(dbDefaultDataBank);
+    #endif
+    #if defined(__TYPED_LIST_MANAGER_ENABLE__)
+      ui8AmountOfPools++;
+    #endif
+    #if defined(__UNTYPED_LIST_MANAGER_ENABLE__)
+      ui8AmountOfPools++;
+    #endif
+    return ui8AmountOfPools;
+  }
+
+  //! Private Function: Library Pool Getter
+  /*!
+    Gets a memory pool created by this library. The default data bank pools come first, then the typed list and the untyped list pools. The pools registered on the default data bank at runtime are named "mpDataBankPool<position>" on the name buffer of the caller.
+    \param ui8Position is a 8-bit integer. It's the library memory pool position.
+    \param tepEntry is a telemetry_entry_t pointer. It's where the memory pool and its name will be saved.
+    \param cpNameBuffer is a char pointer. It's a buffer of __TELEMETRY_NAME_SIZE__ chars for the names built at runtime.
+    \return Returns true if the entry was saved or false if the position is invalid.
+  */
+  static bool __Telemetry_getLibraryPool(uint8_t ui8Position, telemetry_entry_t* tepEntry, char* cpNameBuffer){
+    #if defined(__DATA_BANK_MANAGER_ENABLE__)
+      const uint8_t ui8AmountOfListedPools = (uint8_t) (sizeof(__cpDataBankPoolNames)/sizeof(const char*));
+      if (ui8Position < DataBank_getAmountOfPools(dbDefaultDataBank)){
+        tepEntry->mpMemoryPool = DataBank_getPoolAt(dbDefaultDataBank, ui8Position);
+        if (ui8Position < ui8AmountOfListedPools){
+          tepEntry->cpName = __cpDataBankPoolNames[ui8Position];
+        }
+        else{
+          snprintf(cpNameBuffer, __TELEMETRY_NAME_SIZE__, "mpDataBankPool%u", (unsigned int) ui8Position);
+          tepEntry->cpName = cpNameBuffer;
+        }
+        return true;
+      }
+      ui8Position = ui8Position - DataBank_getAmountOfPools(dbDefaultDataBank);
+    #endif
+    #if defined(__TYPED_LIST_MANAGER_ENABLE__)
+      if (ui8Position == 0){
+        tepEntry->mpMemoryPool = TypedList_getMemoryPool();
+        tepEntry->cpName = "mpUntypedElement";
+        return true;
+      }
+      ui8Position--;
+    #endif
+    #if defined(__UNTYPED_LIST_MANAGER_ENABLE__)
+      if (ui8Position == 0){
+        tepEntry->mpMemoryPool = UntypedList_getMemoryPool();
+        tepEntry->cpName = "mpTypedElement";
+        return true;
+      }
+    #endif
+    (void) tepEntry;
+    (void) cpNameBuffer;
+    return false;
+  }
+
+  //! Function: Amount of Pools Getter
+  /*!
+    Gets the amount of memory pools in telemetry.
+    \return Returns the amount of library and user memory pools.
+  */
+  uint8_t Telemetry_getAmountOfPools(void){
+    return __Telemetry_getAmountOfLibraryPools() + __ui8AmountOfRegisteredPools;
+  }
+
+  //! Function: Pool Report Getter
+  /*!
+    Gets a snapshot of a memory pool in telemetry. Only the maximum free run needs a bit vector scan; nothing is locked or changed, and the names built at runtime are written on the report, so concurrent reports and dumps don't share any buffer.
+    \param ui8Position is a 8-bit integer. It's the memory pool position (library memory pools first).
+    \param trReport is a telemetry_report_t pointer. It's where the report will be saved.
+    \return Returns true if the report was saved or false if the position is invalid.
+  */
+  bool Telemetry_getReport(uint8_t ui8Position, telemetry_report_t* trReport){
+    telemetry_entry_t teLibraryEntry;
+    const telemetry_entry_t* tepEntry = &teLibraryEntry;
+    uint8_t ui8AmountOfLibraryPools = __Telemetry_getAmountOfLibraryPools();
+    if (ui8Position < ui8AmountOfLibraryPools){
+      if (!__Telemetry_getLibraryPool(ui8Position, &teLibraryEntry, trReport->cName)){
+        return false;
+      }
+    }
+    else if (ui8Position < ui8AmountOfLibraryPools + __ui8AmountOfRegisteredPools){
+      tepEntry = &__tepRegisteredPools[ui8Position - ui8AmountOfLibraryPools];
+    }
+    else{
+      return false;
+    }
+    trReport->cpName = tepEntry->cpName;
+    trReport->ui8ElementSize = MemoryPool_getElementSize(tepEntry->mpMemoryPool);
+    trReport->ui16PoolSize = MemoryPool_getSize(tepEntry->mpMemoryPool);
+    trReport->ui16FreeSpace = MemoryPool_getFreeSpace(tepEntry->mpMemoryPool);
+    trReport->ui16MaxFreeSpace = MemoryPool_getMaxFreeSpace(tepEntry->mpMemoryPool);
+    trReport->ui16HighWaterMark = MemoryPool_getHighWaterMark(tepEntry->mpMemoryPool);
+    if (trReport->ui16MaxFreeSpace > trReport->ui16FreeSpace){
+      trReport->ui16MaxFreeSpace = trReport->ui16FreeSpace;
+    }
+    trReport->ui8Fragmentation = (trReport->ui16FreeSpace == 0) ? 0 : (uint8_t) (((uint32_t) (trReport->ui16FreeSpace - trReport->ui16MaxFreeSpace) * 100)/trReport->ui16FreeSpace);
+    return true;
+  }
+
+  //! Private Function: Telemetry Writer
+  /*!
+    Appends a formatted text on the dump buffer. When the buffer is full, only the length is counted.
+    \param cpBuffer is a char pointer. It's the dump buffer.
+    \param szBufferSize is a size_t integer. It's the dump buffer size.
+    \param szpLength is a size_t pointer. It's the length of the dump.
+    \param cpFormat is a string. It's the printf format.
+  */
+  static void __Telemetry_write(char* cpBuffer, size_t szBufferSize, size_t* szpLength, const char* cpFormat, ...){
+    va_list vlArguments;
+    int iLength = 0;
+    va_start(vlArguments, cpFormat);
+    if (*szpLength < szBufferSize){
+      iLength = vsnprintf(cpBuffer + *szpLength, szBufferSize - *szpLength, cpFormat, vlArguments);
+    }
+    else{
+      iLength = vsnprintf(NULL, 0, cpFormat, vlArguments);
+    }
+    va_end(vlArguments);
+    if (iLength > 0){
+      *szpLength = *szpLength + (size_t) iLength;
+    }
+  }
+
+  //! Macro: Prometheus Metric Writer
+  /*!
+    Writes a Prometheus gauge with a sample for each memory pool report.
+  */
+  #define __Telemetry_writePrometheusMetric(cpMetric, cpHelp, xField)\
+    __Telemetry_write(cpBuffer, szBufferSize, &szLength, "# HELP " cpMetric " " cpHelp "\n# TYPE " cpMetric " gauge\n");\
+    for (ui8Counter = 0 ; ui8Counter < ui8AmountOfPools ; ui8Counter++){\
+      __Telemetry_write(cpBuffer, szBufferSize, &szLength, cpMetric "{pool=\"%s\"} %u\n", trpReports[ui8Counter].cpName, (unsigned int) trpReports[ui8Counter].xField);\
+    }
+
+  //! Function: Telemetry Dump
+  /*!
+    Writes the reports of all memory pools on a text buffer, in JSON or Prometheus text format. Each report is taken once, so all metrics of a pool come from the same snapshot. Like snprintf, the text is always ended with '\\0' and the returned length can be bigger than the buffer size.
+    \param cpBuffer is a char pointer. It's the dump buffer.
+    \param szBufferSize is a size_t integer. It's the dump buffer size.
+    \param tfFormat is a telemetry_format_t type. The available values are TELEMETRY_FORMAT_JSON or TELEMETRY_FORMAT_PROMETHEUS.
+    \return Returns the length of the complete dump, without the '\\0'.
+  */
+  size_t Telemetry_dump(char* cpBuffer, size_t szBufferSize, telemetry_format_t tfFormat){
+    telemetry_report_t trpReports[__TELEMETRY_MAX_AMOUNT_OF_POOLS__];
+    size_t szLength = 0;
+    uint8_t ui8Counter = 0;
+    uint8_t ui8AmountOfPools = Telemetry_getAmountOfPools();
+    if (ui8AmountOfPools > __TELEMETRY_MAX_AMOUNT_OF_POOLS__){
+      ui8AmountOfPools = __TELEMETRY_MAX_AMOUNT_OF_POOLS__;
+    }
+    for (ui8Counter = 0 ; ui8Counter < ui8AmountOfPools ; ui8Counter++){
+      Telemetry_getReport(ui8Counter, &trpReports[ui8Counter]);
+    }
+    if (cpBuffer != NULL && szBufferSize > 0){
+      cpBuffer[0] = '\0';
+    }
+    else{
+      szBufferSize = 0;
+    }
+    if (tfFormat == TELEMETRY_FORMAT_JSON){
+      __Telemetry_write(cpBuffer, szBufferSize, &szLength, "{\"pools\":[");
+      for (ui8Counter = 0 ; ui8Counter < ui8AmountOfPools ; ui8Counter++){
+        __Telemetry_write(cpBuffer, szBufferSize, &szLength, "%s{\"name\":\"%s\",\"element_size\":%u,\"size\":%u,\"free\":%u,\"max_free_run\":%u,\"fragmentation\":%u,\"high_water_mark\":%u}",
+          (ui8Counter == 0) ? "" : ",", trpReports[ui8Counter].cpName, (unsigned int) trpReports[ui8Counter].ui8ElementSize, (unsigned int) trpReports[ui8Counter].ui16PoolSize,
+          (unsigned int) trpReports[ui8Counter].ui16FreeSpace, (unsigned int) trpReports[ui8Counter].ui16MaxFreeSpace, (unsigned int) trpReports[ui8Counter].ui8Fragmentation,
+          (unsigned int) trpReports[ui8Counter].ui16HighWaterMark);
+      }
+      __Telemetry_write(cpBuffer, szBufferSize, &szLength, "]}\n");
+    }
+    else{
+      __Telemetry_writePrometheusMetric("memory_pool_element_size_bytes", "Size of the memory pool elements.", ui8ElementSize);
+      __Telemetry_writePrometheusMetric("memory_pool_size_blocks", "Amount of blocks of the memory pool.", ui16PoolSize);
+      __Telemetry_writePrometheusMetric("memory_pool_free_blocks", "Amount of free blocks of the memory pool.", ui16FreeSpace);
+      __Telemetry_writePrometheusMetric("memory_pool_max_free_run_blocks", "Biggest contiguous allocation available in the memory pool.", ui16MaxFreeSpace);
+      __Telemetry_writePrometheusMetric("memory_pool_fragmentation_percent", "Percentage of the free blocks outside the biggest free run.", ui8Fragmentation);
+      __Telemetry_writePrometheusMetric("memory_pool_high_water_mark_blocks", "Maximum amount of blocks allocated at the same time.", ui16HighWaterMark);
+    }
+    return szLength;
+  }
+
+#endif
@@ -0,0 +1,101 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+
+#ifndef __TELEMETRY_HEADER__
+  #define __TELEMETRY_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__) && defined(__MEMORY_POOL_TELEMETRY_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include <stddef.h>
+    #include "./MemoryPool.h"
+
+    //! Enumeration Definition: Telemetry Format
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef enum{
+      TELEMETRY_FORMAT_JSON = 0,
+      TELEMETRY_FORMAT_PROMETHEUS
+    } telemetry_format_t;
+
+    //! Enumeration Definition: Telemetry Status
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef enum{
+      TELEMETRY_STATUS_POOL_REGISTERED = 0,
+      TELEMETRY_STATUS_POOL_NOT_REGISTERED
+    } telemetry_status_t;
+
+    //! Macro: Telemetry Name Size
+    /*!
+      Size of the name buffer of a report, enough for the "mpDataBankPool<position>" names of the data bank spare pools.
+    */
+    #define __TELEMETRY_NAME_SIZE__ 20
+
+    //! Type Definition: Telemetry Pool Report
+    /*!
+      Snapshot of a memory pool. The values are read without stopping the memory pool users, so they can be a little out of date. The names built at runtime (the data bank spare pools) are written on cName and cpName points to it, so a copy of a report must point its cpName to its own cName.
+    */
+    typedef struct{
+      const char* cpName;                         /*!< const char pointer type variable. */
+      char cName[__TELEMETRY_NAME_SIZE__];        /*!< char array type variable. */
+      uint8_t ui8ElementSize;                     /*!< uint8_t integer type variable. */
+      uint16_t ui16PoolSize;                      /*!< uint16_t integer type variable. */
+      uint16_t ui16FreeSpace;                     /*!< uint16_t integer type variable. */
+      uint16_t ui16MaxFreeSpace;                  /*!< uint16_t integer type variable. */
+      uint16_t ui16HighWaterMark;                 /*!< uint16_t integer type variable. */
+      uint8_t ui8Fragmentation;                   /*!< uint8_t integer type variable. Percentage of the free space that is not in the biggest free run. */
+    } telemetry_report_t;
+
+    telemetry_status_t Telemetry_registerPool(mpool_t mpMemoryPool, const char* cpName);                                                  /*!< telemetry_status_t type function. */
+    uint8_t Telemetry_getAmountOfPools(void);                                                                                             /*!< 8-bits integer type function. */
+    bool Telemetry_getReport(uint8_t ui8Position, telemetry_report_t* trReport);                                                          /*!< bool type function. */
+    size_t Telemetry_dump(char* cpBuffer, size_t szBufferSize, telemetry_format_t tfFormat);                                              /*!< size_t type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
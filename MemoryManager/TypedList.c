@@ -176,5 +176,16 @@
       #endif
     }
 
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      //! Function: List Memory Pool Getter
+      /*!
+        Gets the memory pool of the list elements, so it can be inspected (for example, by telemetry).
+        \return Returns the memory pool of the list elements.
+      */
+      mpool_t TypedList_getMemoryPool(void){
+        return mpUntypedElement;
+      }
+    #endif
+
   #endif
 #endif
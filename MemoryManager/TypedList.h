@@ -46,6 +46,10 @@
 
     #include <stdint.h>
 
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      #include "./MemoryPool.h"
+    #endif
+
     //! Structure: Typed Linked List
     /*!
       Typed linked list structure.
@@ -177,6 +181,9 @@
     typed_list_status_t TypedList_insert(typed_list_t tlList, void* vpData, uint16_t ui16Position);             /*!< typed_list_status_t integer type function. */
     typed_list_status_t TypedList_remove(typed_list_t tlList, uint16_t ui16Position);                           /*!< typed_list_status_t integer type function. */
     uint16_t TypedList_getFreeSpace(void);                                                                      /*!< 16-bits integer type function. */
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      mpool_t TypedList_getMemoryPool(void);                                                                    /*!< mpool_t type function. */
+    #endif
 
     #ifdef __cplusplus
       }
@@ -21,7 +21,9 @@
     struct telem_t{
       void* vpData;                                                                                       /*!< Pointer void type. */
       struct telem_t* tepNext;                                                                            /*!< Pointer telem_t type. */
-      uint8_t ui8DataSize;                                                                                    /*!< 8-bits integer type. */
+      #if !defined(__BIT_VECTOR_MANAGER_ENABLE__) || !defined(__MEMORY_POOL_MANAGER_ENABLE__)
+        uint8_t ui8DataSize;                                                                              /*!< 8-bits integer type. With memory pools, the size is given by the data bank. */
+      #endif
     };
 
     //! Type Definition: telem_t and telem_t
@@ -78,7 +80,9 @@
         else{
           memset(tepNewElement->vpData, 0, ui8DataSize);
         }
-        tepNewElement->ui8DataSize = ui8DataSize;
+        #if !defined(__BIT_VECTOR_MANAGER_ENABLE__) || !defined(__MEMORY_POOL_MANAGER_ENABLE__)
+          tepNewElement->ui8DataSize = ui8DataSize;
+        #endif
 
         telem_t* tepBuffer = ulList->tepStart;
         if (ui16Position == 0){
@@ -126,7 +130,7 @@
       }
 
       #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
-        DataBank_free(&tepBuffer->vpData, tepBuffer->ui8DataSize, 1);
+        DataBank_freePtr(&tepBuffer->vpData);
         if (tepBuffer->vpData != NULL){
           return UNTYPED_LIST_STATUS_DATA_NOT_REMOVED;
         }
@@ -180,7 +184,12 @@
       for (ui16Counter = 0; ui16Counter < ui16Position; ui16Counter++){
         tepBuffer = tepBuffer->tepNext;
       }
-      return tepBuffer->ui8DataSize;
+      #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+        mpool_t mpDataPool = DataBank_getPoolByAddress(dbDefaultDataBank, tepBuffer->vpData);
+        return ((mpDataPool != NULL) ? MemoryPool_getElementSize(mpDataPool) : 0);
+      #else
+        return tepBuffer->ui8DataSize;
+      #endif
     }
 
     //! Function: List Free Space
@@ -196,5 +205,16 @@
       #endif
     }
 
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      //! Function: List Memory Pool Getter
+      /*!
+        Gets the memory pool of the list elements, so it can be inspected (for example, by telemetry).
+        \return Returns the memory pool of the list elements.
+      */
+      mpool_t UntypedList_getMemoryPool(void){
+        return mpTypedElement;
+      }
+    #endif
+
   #endif
 #endif
@@ -46,6 +46,10 @@
 
     #include <stdint.h>
 
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      #include "./MemoryPool.h"
+    #endif
+
     //! Structure: Typed Linked List
     /*!
       Typed linked list structure.
@@ -165,6 +169,9 @@
     untyped_list_status_t UntypedList_remove(untyped_list_t ulList, uint16_t ui16Position);                                                 /*!< untyped_list_status_t integer type function. */
     uint8_t UntypedList_getDataSize(untyped_list_t ulList, uint16_t ui16Position);                                                          /*!< 8-bits integer type function. */
     uint16_t UntypedList_getFreeSpace(void);                                                                                                /*!< 16-bits integer type function. */
+    #if defined(__BIT_VECTOR_MANAGER_ENABLE__) && defined(__MEMORY_POOL_MANAGER_ENABLE__)
+      mpool_t UntypedList_getMemoryPool(void);                                                                                              /*!< mpool_t type function. */
+    #endif
 
     #ifdef __cplusplus
       }
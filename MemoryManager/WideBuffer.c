@@ -0,0 +1,203 @@
+#include "./Configs.h"
+
+#if defined(__BUFFER_MANAGER_ENABLE__)
+
+  #include "./WideBuffer.h"
+  #include <string.h>
+
+  //! Private Function: Power of Two Checker
+  /*!
+    Tell if the size of a wide buffer is a power of two, so its counters run freely and its slots are found with the mask.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns true if the size is a power of two.
+  */
+  static inline bool __WideBuffer_isPowerOfTwo(widebuffer_t wbBuffer){
+    return (wbBuffer->ui32BufferSize & wbBuffer->ui32Mask) == 0;
+  }
+
+  //! Private Function: Wrapped Counter Increment
+  /*!
+    Advance a read or write counter of a buffer whose size isn't a power of two: the counters wrap at twice the size.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \return Returns the next counter.
+  */
+  static inline uint32_t __WideBuffer_increment(widebuffer_t wbBuffer, uint32_t ui32Counter){
+    ui32Counter++;
+    return (ui32Counter == 2 * wbBuffer->ui32BufferSize) ? 0 : ui32Counter;
+  }
+
+  //! Private Function: Wrapped Counter Position
+  /*!
+    Get the slot position of a counter of a buffer whose size isn't a power of two.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \return Returns the position.
+  */
+  static inline uint32_t __WideBuffer_getWrappedPosition(widebuffer_t wbBuffer, uint32_t ui32Counter){
+    return (ui32Counter >= wbBuffer->ui32BufferSize) ? ui32Counter - wbBuffer->ui32BufferSize : ui32Counter;
+  }
+
+  //! Private Function: Counter Distance
+  /*!
+    Calculate the amount of data between the read and write counters.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns the amount of data.
+  */
+  static inline uint32_t __WideBuffer_distance(widebuffer_t wbBuffer){
+    uint32_t ui32Distance = wbBuffer->ui32WriteCounter - wbBuffer->ui32ReadCounter;
+    if (__WideBuffer_isPowerOfTwo(wbBuffer) == false && wbBuffer->ui32WriteCounter < wbBuffer->ui32ReadCounter){
+      ui32Distance = ui32Distance + 2 * wbBuffer->ui32BufferSize;
+    }
+    return ui32Distance;
+  }
+
+  //! Private Function: Counter Position
+  /*!
+    Get the slot position of a counter, out of the push and pop paths.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param ui32Counter is a 32-bits integer. It's the counter.
+    \return Returns the position.
+  */
+  static inline uint32_t __WideBuffer_getPosition(widebuffer_t wbBuffer, uint32_t ui32Counter){
+    return (__WideBuffer_isPowerOfTwo(wbBuffer) == true) ? ui32Counter & wbBuffer->ui32Mask : __WideBuffer_getWrappedPosition(wbBuffer, ui32Counter);
+  }
+
+  //! Private Function: Slot Writer
+  /*!
+    Copy a data (or zeros) on a slot of a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param ui32Position is a 32-bits integer. It's the slot position.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+  */
+  static inline void __WideBuffer_write(widebuffer_t wbBuffer, uint32_t ui32Position, void* vpData){
+    void* vpAdressBuffer = (char*) wbBuffer->vpVector + (size_t) ui32Position * wbBuffer->ui32ElementSize;
+    if (vpData != NULL){
+      memcpy(vpAdressBuffer, vpData, wbBuffer->ui32ElementSize);
+    }
+    else{
+      memset(vpAdressBuffer, 0, wbBuffer->ui32ElementSize);
+    }
+  }
+
+  //! Private Functions: Wide Buffer Writers
+  /*!
+    Write a data on a wide buffer whose size is a power of two (masked) or not (wrapped). If the buffer is full, the oldest data is discarded. newWideBuffer and newStaticWideBuffer select one of them (see WideBuffer_push).
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+  */
+  void __WideBuffer_pushMasked(widebuffer_t wbBuffer, void* vpData){
+    __WideBuffer_write(wbBuffer, wbBuffer->ui32WriteCounter & wbBuffer->ui32Mask, vpData);
+    wbBuffer->ui32WriteCounter++;
+    wbBuffer->ui32ReadCounter = wbBuffer->ui32ReadCounter + (wbBuffer->ui32WriteCounter - wbBuffer->ui32ReadCounter > wbBuffer->ui32BufferSize);
+  }
+
+  void __WideBuffer_pushWrapped(widebuffer_t wbBuffer, void* vpData){
+    __WideBuffer_write(wbBuffer, __WideBuffer_getWrappedPosition(wbBuffer, wbBuffer->ui32WriteCounter), vpData);
+    wbBuffer->ui32WriteCounter = __WideBuffer_increment(wbBuffer, wbBuffer->ui32WriteCounter);
+    if (__WideBuffer_distance(wbBuffer) > wbBuffer->ui32BufferSize){
+      wbBuffer->ui32ReadCounter = __WideBuffer_increment(wbBuffer, wbBuffer->ui32ReadCounter);
+    }
+  }
+
+  //! Function: Wide Buffer Writer
+  /*!
+    Write a data on a wide buffer with the push function of its size (the WideBuffer_push macro calls it straight). If the buffer is full, the oldest data is discarded.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+  */
+  void (WideBuffer_push)(widebuffer_t wbBuffer, void* vpData){
+    wbBuffer->vfpPush(wbBuffer, vpData);
+  }
+
+  //! Private Functions: Wide Buffer Readers
+  /*!
+    Pull the address of the next data of a wide buffer whose size is a power of two (masked) or not (wrapped). The slot can be overwritten by the next push.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns data buffer adress or NULL if the buffer is empty.
+  */
+  void* __WideBuffer_popAddressMasked(widebuffer_t wbBuffer){
+    if (wbBuffer->ui32ReadCounter == wbBuffer->ui32WriteCounter){
+      return NULL;
+    }
+    void* vpAdressBuffer = (char*) wbBuffer->vpVector + (size_t) (wbBuffer->ui32ReadCounter & wbBuffer->ui32Mask) * wbBuffer->ui32ElementSize;
+    wbBuffer->ui32ReadCounter++;
+    return vpAdressBuffer;
+  }
+
+  void* __WideBuffer_popAddressWrapped(widebuffer_t wbBuffer){
+    if (wbBuffer->ui32ReadCounter == wbBuffer->ui32WriteCounter){
+      return NULL;
+    }
+    void* vpAdressBuffer = (char*) wbBuffer->vpVector + (size_t) __WideBuffer_getWrappedPosition(wbBuffer, wbBuffer->ui32ReadCounter) * wbBuffer->ui32ElementSize;
+    wbBuffer->ui32ReadCounter = __WideBuffer_increment(wbBuffer, wbBuffer->ui32ReadCounter);
+    return vpAdressBuffer;
+  }
+
+  //! Function: Wide Buffer Reader
+  /*!
+    Pull wide buffer address data with the pop function of its size. The slot can be overwritten by the next push.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns data buffer adress or NULL if the buffer is empty.
+  */
+  void* (WideBuffer_popAddress)(widebuffer_t wbBuffer){
+    return wbBuffer->vpfpPopAddress(wbBuffer);
+  }
+
+  //! Function: Wide Buffer Copy Reader
+  /*!
+    Copy the next data of a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \param vpData is a void pointer. It receives the data.
+    \return Returns false if the buffer is empty.
+  */
+  bool WideBuffer_tryPop(widebuffer_t wbBuffer, void* vpData){
+    void* vpAdressBuffer = wbBuffer->vpfpPopAddress(wbBuffer);
+    if (vpAdressBuffer == NULL){
+      return false;
+    }
+    memcpy(vpData, vpAdressBuffer, wbBuffer->ui32ElementSize);
+    return true;
+  }
+
+  //! Function: Amount of Pending Data Getter
+  /*!
+    Get the amount of pending data on a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns the amount of pending data.
+  */
+  uint32_t WideBuffer_getAmountOfPendingData(widebuffer_t wbBuffer){
+    return __WideBuffer_distance(wbBuffer);
+  }
+
+  //! Function: Wide Buffer Cleaner
+  /*!
+    Clean a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+  */
+  void WideBuffer_clear(widebuffer_t wbBuffer){
+    wbBuffer->ui32ReadCounter = 0;
+    wbBuffer->ui32WriteCounter = 0;
+  }
+
+  //! Function: Write Position Getter
+  /*!
+    Get the write position of a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns write position.
+  */
+  uint32_t WideBuffer_getWritePosition(widebuffer_t wbBuffer){
+    return __WideBuffer_getPosition(wbBuffer, wbBuffer->ui32WriteCounter);
+  }
+
+  //! Function: Read Position Getter
+  /*!
+    Get the read position of a wide buffer.
+    \param wbBuffer is a widebuffer_t type. This parameter is the address of buffer.
+    \return Returns read position.
+  */
+  uint32_t WideBuffer_getReadPosition(widebuffer_t wbBuffer){
+    return __WideBuffer_getPosition(wbBuffer, wbBuffer->ui32ReadCounter);
+  }
+
+#endif
@@ -0,0 +1,172 @@
+//! MemoryManager Version 3.2b
+/*!
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#ifndef __WIDE_BUFFER_HEADER__
+  #define __WIDE_BUFFER_HEADER__
+
+  #include "./Configs.h"
+
+  #if defined(__BUFFER_MANAGER_ENABLE__)
+
+    #ifdef __cplusplus
+      extern "C" {
+    #endif
+
+    #include <stdint.h>
+    #include <EmbeddedTools.h>
+
+    //! Type Definition: Wide Buffer Structure
+    /*!
+      Queue buffer with 32-bit indexes and element sizes, for rings of millions of elements. Each buffer gets, at its creation, the push and pop functions of its size: when the size is a power of two, the read and write counters run freely and the slots are found with a mask, so push and pop neither branch to wrap nor test the size. Other sizes work too, with counters that wrap at twice the size. As BUFFER_TYPE_QUEUE, the oldest data is discarded when the buffer is full.
+    */
+    typedef struct widebuffer_structure_t widebuffer_structure_t;
+
+    //! Type Definition: Wide Buffer Pointer
+    /*!
+      This typedef is for facilitate the use of this library.
+    */
+    typedef widebuffer_structure_t* widebuffer_t;
+
+    struct widebuffer_structure_t {
+      void* const vpVector;                                                                                                         /*!< const void pointer type. */
+      const uint32_t ui32ElementSize;                                                                                               /*!< const 32-bits integer type. */
+      const uint32_t ui32BufferSize;                                                                                                /*!< const 32-bits integer type. */
+      const uint32_t ui32Mask;                                                                                                      /*!< const 32-bits integer type. */
+      void (*const vfpPush)(widebuffer_t wbBuffer, void* vpData);                                                                   /*!< const void type function pointer. */
+      void* (*const vpfpPopAddress)(widebuffer_t wbBuffer);                                                                         /*!< const void pointer type function pointer. */
+      uint32_t ui32ReadCounter;                                                                                                     /*!< 32-bits integer type. */
+      uint32_t ui32WriteCounter;                                                                                                    /*!< 32-bits integer type. */
+    };
+
+    void __WideBuffer_pushMasked(widebuffer_t wbBuffer, void* vpData);                                                              /*!< void type function. */
+    void __WideBuffer_pushWrapped(widebuffer_t wbBuffer, void* vpData);                                                             /*!< void type function. */
+    void* __WideBuffer_popAddressMasked(widebuffer_t wbBuffer);                                                                     /*!< void pointer type function. */
+    void* __WideBuffer_popAddressWrapped(widebuffer_t wbBuffer);                                                                    /*!< void pointer type function. */
+
+    //! Macro: Wide Buffer Size Specialization
+    /*!
+      Select, from the buffer size, the functions with free running counters and a mask (powers of two) or with counters that wrap at twice the size.
+      \param ui32SizeOfBuffer is a 32-Bit integer. Its buffer size.
+      \param xMasked is the function for powers of two.
+      \param xWrapped is the function for other sizes.
+    */
+    #define __WideBuffer_specialize(ui32SizeOfBuffer, xMasked, xWrapped)\
+      ((((ui32SizeOfBuffer) & ((ui32SizeOfBuffer) - 1)) == 0) ? (xMasked) : (xWrapped))
+
+    //! Macro: Wide Buffer Creator
+    /*!
+      Create a wide buffer. Big buffers should be created with newStaticWideBuffer, out of the stack.
+      \param wbBufferName is a buffer name.
+      \param xDataType is the type of receiving buffer data.
+      \param ui32SizeOfBuffer is a 32-Bit integer. Its buffer size, up to 2^31 elements. Powers of two are faster.
+    */
+    #define newWideBuffer(wbBufferName, xDataType, ui32SizeOfBuffer)\
+      xDataType __xWideBufferVector##wbBufferName[ui32SizeOfBuffer];\
+      widebuffer_structure_t __wbsWideBuffer##wbBufferName = {\
+        .vpVector = (void*) __xWideBufferVector##wbBufferName,\
+        .ui32ElementSize = sizeof(xDataType),\
+        .ui32BufferSize = ui32SizeOfBuffer,\
+        .ui32Mask = (ui32SizeOfBuffer) - 1,\
+        .vfpPush = __WideBuffer_specialize(ui32SizeOfBuffer, __WideBuffer_pushMasked, __WideBuffer_pushWrapped),\
+        .vpfpPopAddress = __WideBuffer_specialize(ui32SizeOfBuffer, __WideBuffer_popAddressMasked, __WideBuffer_popAddressWrapped),\
+        .ui32ReadCounter = 0,\
+        .ui32WriteCounter = 0\
+      };\
+      widebuffer_t wbBufferName = &(__wbsWideBuffer##wbBufferName);\
+
+    //! Macro: Static Wide Buffer Creator
+    /*!
+      Create a static wide buffer.
+      \param wbBufferName is a buffer name.
+      \param xDataType is the type of receiving buffer data.
+      \param ui32SizeOfBuffer is a 32-Bit integer. Its buffer size, up to 2^31 elements. Powers of two are faster.
+    */
+    #define newStaticWideBuffer(wbBufferName, xDataType, ui32SizeOfBuffer)\
+      static xDataType __xWideBufferVector##wbBufferName[ui32SizeOfBuffer];\
+      static widebuffer_structure_t __wbsWideBuffer##wbBufferName = {\
+        .vpVector = (void*) __xWideBufferVector##wbBufferName,\
+        .ui32ElementSize = sizeof(xDataType),\
+        .ui32BufferSize = ui32SizeOfBuffer,\
+        .ui32Mask = (ui32SizeOfBuffer) - 1,\
+        .vfpPush = __WideBuffer_specialize(ui32SizeOfBuffer, __WideBuffer_pushMasked, __WideBuffer_pushWrapped),\
+        .vpfpPopAddress = __WideBuffer_specialize(ui32SizeOfBuffer, __WideBuffer_popAddressMasked, __WideBuffer_popAddressWrapped),\
+        .ui32ReadCounter = 0,\
+        .ui32WriteCounter = 0\
+      };\
+      static widebuffer_t wbBufferName = &__wbsWideBuffer##wbBufferName;
+
+    //! Macro: Wide Buffer Writer
+    /*!
+      Write a data on a wide buffer with the push function of its size. If the buffer is full, the oldest data is discarded.
+      \param wbBuffer is a widebuffer_t type. This parameter is a initialized buffer.
+      \param vpData is a void pointer. This parameter is the data to be inserted on the buffer.
+    */
+    #define WideBuffer_push(wbBuffer, vpData)\
+      ((wbBuffer)->vfpPush((wbBuffer), (vpData)))
+
+    //! Macro: Pointer Wide Buffer Data Getter
+    /*!
+      Pull wide buffer address data.
+      \param wbBuffer is a widebuffer_t type. This parameter is a initialized buffer.
+      \param xDataType is the type of receiving buffer data.
+      \return Returns data buffer adress or NULL if the buffer is empty.
+    */
+    #define WideBuffer_popAddress(wbBuffer, xDataType)\
+      ((xDataType*) (wbBuffer)->vpfpPopAddress(wbBuffer))
+
+    //! Macro: Content Wide Buffer Data Getter
+    /*!
+      Pull wide buffer data. The buffer must not be empty.
+      \param wbBuffer is a widebuffer_t type. This parameter is a initialized buffer.
+      \param xDataType is the type of receiving buffer data.
+      \return Returns buffer data.
+    */
+    #define WideBuffer_pop(wbBuffer, xDataType)\
+      (*(WideBuffer_popAddress(wbBuffer, xDataType)))
+
+    void WideBuffer_clear(widebuffer_t wbBuffer);                                                                                   /*!< void type function. */
+    void (WideBuffer_push)(widebuffer_t wbBuffer, void* vpData);                                                                    /*!< void type function. */
+    bool WideBuffer_tryPop(widebuffer_t wbBuffer, void* vpData);                                                                    /*!< bool type function. */
+    uint32_t WideBuffer_getAmountOfPendingData(widebuffer_t wbBuffer);                                                              /*!< 32-bits integer type. */
+    uint32_t WideBuffer_getWritePosition(widebuffer_t wbBuffer);                                                                    /*!< 32-bits integer type. */
+    uint32_t WideBuffer_getReadPosition(widebuffer_t wbBuffer);                                                                     /*!< 32-bits integer type. */
+    void* (WideBuffer_popAddress)(widebuffer_t wbBuffer);                                                                           /*!< void pointer type function. */
+
+    #ifdef __cplusplus
+      }
+    #endif
+
+  #endif
+#endif
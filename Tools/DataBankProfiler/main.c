@@ -0,0 +1,211 @@
+//! DataBankProfiler - DataBank pools sizing tool
+/*!
+  This host tool replays an allocation trace recorded by the DataBank
+  profiler (__DATA_BANK_PROFILER_ENABLE__ and DataBank_setProfilerCallback)
+  and prints a pool list for your Configs.h file. The callback is set per data
+  bank, so a trace file must hold the records of only one bank: record each
+  bank on its own file and replay each file with the name of its list
+  (__DATA_BANK_POOL_LIST__ is the list of dbDefaultDataBank).
+
+  For each element size, the occupancy of the pool (in blocks) is sampled
+  after every allocation request, including the failed ones. The pool size is
+  the occupancy quantile for the target failure probability plus a headroom
+  for fragmentation. The pools registered in the bank (the
+  DATA_BANK_TRACE_POOL records) that no request used keep their size, so the
+  list can replace the old one as it is.
+
+  Usage: DataBankProfiler <trace file> [failure probability] [headroom %] [list name]
+  Default values: failure probability = 0.001, headroom = 10% and list name =
+  __DATA_BANK_POOL_LIST__.
+
+  This code file was written by Jorge Henrique Moreira Santana and is under
+  the GNU GPLv3 license. All legal rights are reserved.
+
+  Permissions of this copyleft license are conditioned on making available
+  complete source code of licensed works and modifications under the same
+  license or the GNU GPLv3. Copyright and license notices must be preserved.
+
+  Contributors provide an express grant of patent rights. However, a larger
+  work using the licensed work through interfaces provided by the licensed
+  work may be distributed under different terms and without source code for
+  the larger work.
+
+  * Permissions:
+    -> Commercial use;
+    -> Modification;
+    -> Distribuition;
+    -> Patent Use;
+    -> Private Use;
+
+  * Limitations:
+    -> Liability;
+    -> Warranty;
+
+  * Conditions:
+    -> License and copyright notice;
+    -> Disclose source;
+    -> State changes;
+    -> Same license (library);
+
+  For more informations, check the LICENSE document. If you want to use a
+  commercial product without having to provide the source code, send an email
+  to jorge_henrique_123@hotmail.com to talk.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/*!
+  Maximum occupancy of a pool: the biggest pool plus the biggest request.
+*/
+#define __MAX_OCCUPANCY__ (2 * 65536)
+
+/*!
+  Statistics of an element size.
+*/
+typedef struct{
+  uint32_t* ui32pHistogram;
+  uint64_t ui64AmountOfSamples;
+  uint32_t ui32LiveBlocks;
+  uint32_t ui32PeakBlocks;
+  uint32_t ui32AmountOfErrors;
+  uint32_t ui32PoolSize;
+  uint32_t ui32RegisteredSize;
+} class_statistics_t;
+
+/*!
+  Occupancy quantile of an element size.
+*/
+static uint32_t getQuantile(class_statistics_t* csClass, double dQuantile){
+  uint64_t ui64Target = (uint64_t) (dQuantile * (double) csClass->ui64AmountOfSamples);
+  uint64_t ui64Accumulated = 0;
+  uint32_t ui32Occupancy = 0;
+  for (ui32Occupancy = 0 ; ui32Occupancy < __MAX_OCCUPANCY__ ; ui32Occupancy++){
+    ui64Accumulated = ui64Accumulated + csClass->ui32pHistogram[ui32Occupancy];
+    if (ui64Accumulated > ui64Target){
+      return ui32Occupancy;
+    }
+  }
+  return csClass->ui32PeakBlocks;
+}
+
+/*!
+  Frees the histograms of all element sizes.
+*/
+static void freeHistograms(class_statistics_t* csClasses){
+  uint16_t ui16Counter = 0;
+  for (ui16Counter = 0 ; ui16Counter < 256 ; ui16Counter++){
+    free(csClasses[ui16Counter].ui32pHistogram);
+    csClasses[ui16Counter].ui32pHistogram = NULL;
+  }
+}
+
+/*!
+  Main function.
+*/
+int main(int iArgc, char** cppArgv){
+  static class_statistics_t csClasses[256];
+  uint8_t ui8pRecord[4];
+  uint64_t ui64AmountOfRecords = 0;
+  double dFailureProbability = 0.001;
+  double dHeadroom = 10;
+  const char* cpListName = "__DATA_BANK_POOL_LIST__";
+  uint16_t ui16Counter = 0;
+  if (iArgc < 2){
+    printf("Usage: %s <trace file> [failure probability] [headroom %%] [list name]\n", cppArgv[0]);
+    return 1;
+  }
+  if (iArgc > 2){
+    dFailureProbability = atof(cppArgv[2]);
+  }
+  if (iArgc > 3){
+    dHeadroom = atof(cppArgv[3]);
+  }
+  if (iArgc > 4){
+    cpListName = cppArgv[4];
+  }
+  FILE* fpTrace = fopen(cppArgv[1], "rb");
+  if (fpTrace == NULL){
+    printf("ERROR: The trace file can't be opened!\n");
+    return 2;
+  }
+
+  /*!
+    Replaying the trace...
+  */
+  while (fread(ui8pRecord, sizeof(ui8pRecord), 1, fpTrace) == 1){
+    uint8_t ui8Operation = ui8pRecord[0];
+    class_statistics_t* csClass = &csClasses[ui8pRecord[1]];
+    uint32_t ui32AllocationSize = (uint32_t) ui8pRecord[2] | ((uint32_t) ui8pRecord[3] << 8);
+    uint32_t ui32Demand = 0;
+    ui64AmountOfRecords++;
+    if (ui8Operation == 3){                                                                           /*!< DATA_BANK_TRACE_POOL */
+      csClass->ui32RegisteredSize = csClass->ui32RegisteredSize + ui32AllocationSize;
+      continue;
+    }
+    if (csClass->ui32pHistogram == NULL){
+      csClass->ui32pHistogram = (uint32_t*) calloc(__MAX_OCCUPANCY__, sizeof(uint32_t));
+      if (csClass->ui32pHistogram == NULL){
+        printf("ERROR: Allocation memory error!\n");
+        fclose(fpTrace);
+        freeHistograms(csClasses);
+        return 3;
+      }
+    }
+    if (ui8Operation == 1){                                                                           /*!< DATA_BANK_TRACE_DEALLOCATION */
+      csClass->ui32LiveBlocks = (csClass->ui32LiveBlocks > ui32AllocationSize) ? (csClass->ui32LiveBlocks - ui32AllocationSize) : 0;
+      continue;
+    }
+    ui32Demand = csClass->ui32LiveBlocks + ui32AllocationSize;
+    if (ui32Demand >= __MAX_OCCUPANCY__){
+      ui32Demand = __MAX_OCCUPANCY__ - 1;
+    }
+    csClass->ui32pHistogram[ui32Demand]++;
+    csClass->ui64AmountOfSamples++;
+    if (ui32Demand > csClass->ui32PeakBlocks){
+      csClass->ui32PeakBlocks = ui32Demand;
+    }
+    if (ui8Operation == 0){                                                                           /*!< DATA_BANK_TRACE_ALLOCATION */
+      csClass->ui32LiveBlocks = ui32Demand;
+    }
+    else{                                                                                             /*!< DATA_BANK_TRACE_ALLOCATION_ERROR: The request is counted but never freed. */
+      csClass->ui32AmountOfErrors++;
+    }
+  }
+  fclose(fpTrace);
+
+  /*!
+    Printing the statistics and the pool list...
+  */
+  printf("/*\n  DataBankProfiler: %llu records, failure probability %g, headroom %g%%.\n\n", (unsigned long long) ui64AmountOfRecords, dFailureProbability, dHeadroom);
+  printf("  Size | Requests | Errors |   Peak | p99.9 | Registered | Pool size\n");
+  for (ui16Counter = 1 ; ui16Counter < 256 ; ui16Counter++){
+    class_statistics_t* csClass = &csClasses[ui16Counter];
+    if (csClass->ui64AmountOfSamples > 0){
+      uint32_t ui32PoolSize = getQuantile(csClass, 1.0 - dFailureProbability);
+      ui32PoolSize = (uint32_t) ((double) ui32PoolSize * (100.0 + dHeadroom) / 100.0 + 0.999);
+      csClass->ui32PoolSize = (ui32PoolSize > 65535) ? 65535 : ((ui32PoolSize == 0) ? 1 : ui32PoolSize);
+      printf("  %4u | %8llu | %6u | %6u | %5u | %10u | %9u\n", ui16Counter, (unsigned long long) csClass->ui64AmountOfSamples, csClass->ui32AmountOfErrors, csClass->ui32PeakBlocks, getQuantile(csClass, 0.999), csClass->ui32RegisteredSize, csClass->ui32PoolSize);
+    }
+    else if (csClass->ui32RegisteredSize > 0){                                                        /*!< A registered pool without requests keeps its size. */
+      csClass->ui32PoolSize = (csClass->ui32RegisteredSize > 65535) ? 65535 : csClass->ui32RegisteredSize;
+      printf("  %4u | %8u | %6u | %6u | %5u | %10u | %9u\n", ui16Counter, 0, 0, 0, 0, csClass->ui32RegisteredSize, csClass->ui32PoolSize);
+    }
+  }
+  printf("*/\n#define %s", cpListName);
+  for (ui16Counter = 1 ; ui16Counter < 256 ; ui16Counter++){
+    class_statistics_t* csClass = &csClasses[ui16Counter];
+    if (csClass->ui32PoolSize > 0){
+      if (ui16Counter == 1 || ui16Counter == 2 || ui16Counter == 4 || ui16Counter == 8){
+        printf("\\\n  X(mp%uBitPool, sizeof(uint%u_t), %u)", ui16Counter * 8, ui16Counter * 8, csClass->ui32PoolSize);
+      }
+      else{
+        printf("\\\n  X(mp%uBytePool, %u, %u)", ui16Counter, ui16Counter, csClass->ui32PoolSize);
+      }
+    }
+  }
+  printf("\n");
+  freeHistograms(csClasses);
+  return 0;
+}